@@ -22,6 +22,7 @@
             '../samples/samples.gyp:*',
             '../test/cctest/cctest.gyp:*',
             '../test/fuzzer/fuzzer.gyp:*',
+            '../test/microbenchmarks/microbenchmarks.gyp:*',
             '../test/unittests/unittests.gyp:*',
           ],
         }],
@@ -45,6 +45,16 @@ class V8_EXPORT FastAccessorBuilder {
   void CheckNotZeroOrJump(ValueId value_id, LabelId label_id);
   ValueId Call(v8::FunctionCallback callback, ValueId value_id);
 
+  // A raw getter callback. It receives an untagged machine word (typically a
+  // pointer previously loaded with LoadInternalField) and returns a raw
+  // integer. It is called without any of the FunctionCallbackInfo scaffolding
+  // and therefore must not call back into V8 or allocate on its heap.
+  typedef int32_t (*IntGetterCallback)(void* data);
+
+  // Calls |callback| directly with the raw value behind |value_id|. The
+  // result is an untagged integer; use ToSmi before returning it.
+  ValueId CallIntGetter(IntGetterCallback callback, ValueId value_id);
+
  private:
   FastAccessorBuilder() = delete;
   FastAccessorBuilder(const FastAccessorBuilder&) = delete;
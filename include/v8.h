@@ -156,6 +156,7 @@ template<typename T> class CustomArguments;
 class PropertyCallbackArguments;
 class FunctionCallbackArguments;
 class GlobalHandles;
+class GCTracer;
 }  // namespace internal
 
 
@@ -960,6 +961,44 @@ class V8_EXPORT SealHandleScope {
 };
 
 
+/**
+ * An arena of handles with persistent lifetime and bulk deallocation.
+ *
+ * Handles added to a group survive any number of HandleScopes, like
+ * Persistent handles, but are allocated by bumping an index into
+ * pre-allocated blocks and are all dropped at once by Reset(), which is O(1)
+ * and keeps the blocks for reuse. This fits embedders whose persistents
+ * share one lifetime, e.g. everything created while serving a request.
+ *
+ * The handles are strong roots; there is no weakness support. A group must
+ * be destroyed before its isolate.
+ *
+ * This is an experimental feature.
+ */
+class V8_EXPORT PersistentHandleGroup {
+ public:
+  explicit PersistentHandleGroup(Isolate* isolate);
+  ~PersistentHandleGroup();
+
+  /**
+   * Returns a handle to |value| which remains valid until Reset() is called
+   * or the group is destroyed, independent of any HandleScope.
+   */
+  Local<Value> Add(Local<Value> value);
+
+  /**
+   * Invalidates all handles handed out by Add() at once.
+   */
+  void Reset();
+
+  PersistentHandleGroup(const PersistentHandleGroup&) = delete;
+  void operator=(const PersistentHandleGroup&) = delete;
+
+ private:
+  void* arena_;
+};
+
+
 // --- Special objects ---
 
 
@@ -1103,6 +1142,16 @@ class V8_EXPORT Script {
    * Returns the corresponding context-unbound script.
    */
   Local<UnboundScript> GetUnboundScript();
+
+  /**
+   * Marks the functions whose bodies start at the given source offsets within
+   * this script for eager tier-up: each one is handed to the optimizing
+   * compiler as soon as it is first called, instead of waiting for the
+   * runtime profiler to observe it as hot. The offsets are typically recorded
+   * from a profile of a previous run; offsets that do not correspond to a
+   * function in this script are ignored.
+   */
+  void MarkFunctionsForOptimization(const int* start_positions, size_t count);
 };
 
 
@@ -1134,6 +1183,13 @@ class V8_EXPORT ScriptCompiler {
     // data and guarantees that it stays alive until the CachedData object is
     // destroyed. If the policy is BufferOwned, the given data will be deleted
     // (with delete[]) when the CachedData object is destroyed.
+    //
+    // When consuming cached data, buffers whose start address is aligned to
+    // the pointer size are read in place without an internal copy; unaligned
+    // buffers are copied once into an aligned allocation first. Embedders
+    // passing large caches (e.g. from mmapped files, which are always
+    // sufficiently aligned) should preserve that alignment when slicing
+    // buffers out of larger blobs.
     CachedData(const uint8_t* data, int length,
                BufferPolicy buffer_policy = BufferNotOwned);
     ~CachedData();
@@ -1658,6 +1714,38 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Object> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * A helper to parse JSON that arrives in chunks, e.g. off the network.
+   * Chunks are one-byte (Latin-1) JSON text; payloads with characters
+   * outside Latin-1 must encode them as \uXXXX escapes. Accumulating the
+   * chunks here instead of concatenating them into a string on the embedder
+   * side avoids the extra copy the parser would otherwise pay for
+   * flattening the concatenation.
+   */
+  class V8_EXPORT ChunkedParser {
+   public:
+    explicit ChunkedParser(Isolate* isolate);
+    ~ChunkedParser();
+
+    /**
+     * Appends a chunk of one-byte JSON text. Returns false if the
+     * assembled source would exceed the maximal string length.
+     */
+    bool Append(const uint8_t* chunk, size_t length);
+
+    /**
+     * Parses the assembled source. May only be called once.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context);
+
+   private:
+    ChunkedParser(const ChunkedParser&) = delete;
+    void operator=(const ChunkedParser&) = delete;
+
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 /**
@@ -2563,6 +2651,47 @@ class V8_EXPORT String : public Name {
 };
 
 
+/**
+ * Incrementally assembles a string from many fragments. Unlike repeated
+ * String::Concat calls, which produce deeply nested trees that have to be
+ * flattened when the result is used, the builder accumulates fragments in
+ * pre-sized buffers and produces a result that is cheap to consume.
+ *
+ * A StringBuilder must be created and finished inside the same HandleScope
+ * and must not outlive it.
+ *
+ * This is an experimental feature. Use at your own risk.
+ */
+class V8_EXPORT StringBuilder {
+ public:
+  /**
+   * Creates a builder. When the length of the result can be estimated,
+   * e.g. from a previous run, passing it lets the builder pre-size its
+   * buffers.
+   */
+  explicit StringBuilder(Isolate* isolate, int estimated_length = 0);
+  ~StringBuilder();
+
+  /** Appends a string fragment. */
+  void Append(Local<String> string);
+
+  /**
+   * Returns the assembled string. The builder must not be used afterwards.
+   * Returns an empty MaybeLocal and schedules an exception if the result
+   * would exceed the maximal string length.
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<String> Finish();
+
+  // Disallow copying and assigning.
+  StringBuilder(const StringBuilder&) = delete;
+  void operator=(const StringBuilder&) = delete;
+
+ private:
+  internal::Isolate* isolate_;
+  void* builder_;
+};
+
+
 /**
  * A JavaScript symbol (ECMA-262 edition 6)
  *
@@ -2810,6 +2939,21 @@ class V8_EXPORT Object : public Value {
       Local<Context> context, Local<Name> key, Local<Value> value,
       PropertyAttribute attributes = None);
 
+  // Defines several own data properties in one call, equivalent to calling
+  // DefineOwnProperty for each (name, value, attribute) triple in order but
+  // entering the VM and performing the access check only once. Binding code
+  // that installs many members on freshly created instances should prefer
+  // this; instances receiving the same property sequence share their map
+  // through V8's transition cache, so repeated setup stays cheap.
+  //
+  // |attributes| may be null, in which case all properties are defined with
+  // default attributes. Definition stops at the first failure.
+  //
+  // Returns true if all properties were defined.
+  V8_WARN_UNUSED_RESULT Maybe<bool> DefineProperties(
+      Local<Context> context, size_t count, Local<Name>* names,
+      Local<Value>* values, const PropertyAttribute* attributes = nullptr);
+
   // Sets an own property on this object bypassing interceptors and
   // overriding accessors or read-only properties.
   //
@@ -3146,6 +3290,22 @@ class V8_EXPORT Object : public Value {
 
   static Local<Object> New(Isolate* isolate);
 
+  /**
+   * Creates a JavaScript object with the given properties and the given
+   * prototype_or_null (which can be any JavaScript object or null, or an
+   * empty handle for the default Object prototype).
+   *
+   * Properties are added in the order given, so repeatedly creating
+   * objects from the same property-name sequence lets them share their
+   * final hidden class, which in turn lets optimizing compilers turn
+   * property accesses into direct offset loads. This makes it the
+   * preferred way to convert many identically-shaped native records
+   * into JavaScript objects, replacing a Set call per field.
+   */
+  static Local<Object> New(Isolate* isolate, Local<Value> prototype_or_null,
+                           Local<Name>* names, Local<Value>* values,
+                           size_t length);
+
   V8_INLINE static Object* Cast(Value* obj);
 
  private:
@@ -3173,12 +3333,41 @@ class V8_EXPORT Array : public Object {
                 MaybeLocal<Object> CloneElementAt(Local<Context> context,
                                                   uint32_t index));
 
+  /**
+   * Hint describing the kind of element values an array created via New
+   * will be filled with, so the backing store can be allocated in the
+   * right representation up front instead of transitioning (and copying)
+   * as values arrive.
+   */
+  enum class ElementsHint { kDefault, kSmis, kDoubles };
+
   /**
    * Creates a JavaScript array with the given length. If the length
    * is negative the returned array will have length 0.
    */
   static Local<Array> New(Isolate* isolate, int length = 0);
 
+  /**
+   * Creates a JavaScript array with the given length whose backing store
+   * matches the hinted element representation.
+   */
+  static Local<Array> New(Isolate* isolate, int length, ElementsHint hint);
+
+  /**
+   * Creates a JavaScript array containing the given doubles, backed
+   * directly by a double-typed elements store.
+   */
+  static Local<Array> New(Isolate* isolate, const double* values,
+                          size_t length);
+
+  /**
+   * Creates a JavaScript array containing the given integers. The backing
+   * store holds untagged small integers when every value fits, and doubles
+   * otherwise.
+   */
+  static Local<Array> New(Isolate* isolate, const int32_t* values,
+                          size_t length);
+
   V8_INLINE static Array* Cast(Value* obj);
  private:
   Array();
@@ -3498,6 +3687,36 @@ class V8_EXPORT Function : public Object {
                                                Local<Value> recv, int argc,
                                                Local<Value> argv[]);
 
+  /**
+   * One invocation of a batched call; see Function::CallBatch. Neither
+   * |function| nor |recv| may be empty (pass Undefined as the receiver to
+   * get the usual global-object substitution). |argv| must stay valid for
+   * the duration of the batch call.
+   */
+  struct Invocation {
+    Local<Function> function;
+    Local<Value> recv;
+    int argc;
+    Local<Value>* argv;
+  };
+
+  /**
+   * Calls a batch of functions in one V8 entry. The per-call API overhead —
+   * before/after-call callbacks and the microtask checkpoint triggered when
+   * the call depth returns to zero — is paid once per batch instead of once
+   * per call, which matters for binding layers making many tiny calls.
+   *
+   * |results| must have room for |count| entries; the i-th entry receives
+   * the return value of the i-th invocation, created in the current
+   * HandleScope. The batch stops at the first call that throws: its index
+   * is returned, its result and all following ones are left untouched, and
+   * the exception is reported as it would be for Function::Call. Returns
+   * |count| if every call succeeded.
+   */
+  static size_t CallBatch(Local<Context> context,
+                          const Invocation* invocations, size_t count,
+                          MaybeLocal<Value>* results);
+
   void SetName(Local<String> name);
   Local<Value> GetName() const;
 
@@ -3656,10 +3875,16 @@ class V8_EXPORT Proxy : public Object {
 class V8_EXPORT WasmCompiledModule : public Object {
  public:
   typedef std::pair<std::unique_ptr<const uint8_t[]>, size_t> SerializedModule;
+  // A buffer that is owned by the caller.
+  typedef std::pair<const uint8_t*, size_t> CallerOwnedBuffer;
 
   SerializedModule Serialize();
+
+  // Deserialization fails (returns an empty handle) if |wire_bytes| are not
+  // the bytes the serialized module was compiled from.
   static MaybeLocal<WasmCompiledModule> Deserialize(
-      Isolate* isolate, const SerializedModule& serialized_data);
+      Isolate* isolate, const SerializedModule& serialized_data,
+      const CallerOwnedBuffer& wire_bytes);
   V8_INLINE static WasmCompiledModule* Cast(Value* obj);
 
  private:
@@ -4133,6 +4358,12 @@ class V8_EXPORT SharedArrayBuffer : public Object {
    * array buffer is immediately in externalized state unless otherwise
    * specified. The memory block will not be reclaimed when a created
    * SharedArrayBuffer is garbage-collected.
+   *
+   * With |ArrayBufferCreationMode::kInternalized| the same memory block may
+   * be mapped into several isolates: each resulting SharedArrayBuffer holds a
+   * reference in a process-wide registry, and the block is deallocated only
+   * when the last of them is garbage-collected. This requires that all
+   * participating isolates use the same |ArrayBuffer::Allocator|.
    */
   static Local<SharedArrayBuffer> New(
       Isolate* isolate, void* data, size_t byte_length,
@@ -4872,6 +5103,12 @@ enum class PropertyHandlerFlags {
   // Will not call into interceptor for symbol lookup.  Only meaningful for
   // named interceptors.
   kOnlyInterceptStrings = 1 << 2,
+  // The interceptor's decision whether to handle a given property name never
+  // changes for objects of a single map, and its getter is free of observable
+  // side effects.  This allows inline caches to probe the interceptor once
+  // and, for names it does not handle, cache the property found behind it.
+  // Only meaningful for named interceptors.
+  kStablePerMap = 1 << 3,
 };
 
 
@@ -5292,6 +5529,39 @@ class V8_EXPORT ResourceConstraints {
   void set_code_range_size(size_t limit_in_mb) {
     code_range_size_ = limit_in_mb;
   }
+  int incremental_marking_safety_factor() const {
+    return incremental_marking_safety_factor_;
+  }
+  // Makes incremental marking step sizes track the mutator's allocation
+  // throughput so that marking finishes before allocation reaches the old
+  // generation limit, instead of relying on idle-time heuristics. The value
+  // is a safety margin in percent: 100 sizes steps to finish marking exactly
+  // when the space left at marking start runs out, larger values finish
+  // proportionally earlier. 0 (the default) keeps the idle-time schedule.
+  // Useful for server workloads without an idle loop.
+  void set_incremental_marking_safety_factor(int percent) {
+    incremental_marking_safety_factor_ = percent;
+  }
+  size_t code_space_budget() const { return code_space_budget_; }
+  // Sets a soft budget in MB for the memory occupied by code objects. When a
+  // full garbage collection leaves code space above the budget, optimized
+  // code that has not been executed since the previous full collection is
+  // deoptimized, which makes it and the corresponding unoptimized code
+  // eligible for flushing by later collections; hot code is kept. 0 (the
+  // default) leaves code space unbudgeted.
+  void set_code_space_budget(size_t limit_in_mb) {
+    code_space_budget_ = limit_in_mb;
+  }
+  int scavenge_pause_budget() const { return scavenge_pause_budget_; }
+  // Sets a pause budget in ms for young generation collections. When set,
+  // the semispaces are continuously resized within the configured bounds:
+  // they grow while the promotion ratio is high, shrink when it is low, and
+  // are capped so that evacuating a full semispace at the measured scavenge
+  // speed stays within the budget. 0 (the default) keeps the survival-based
+  // growth heuristic.
+  void set_scavenge_pause_budget(int budget_in_ms) {
+    scavenge_pause_budget_ = budget_in_ms;
+  }
 
  private:
   int max_semi_space_size_;
@@ -5299,6 +5569,9 @@ class V8_EXPORT ResourceConstraints {
   int max_executable_size_;
   uint32_t* stack_limit_;
   size_t code_range_size_;
+  int incremental_marking_safety_factor_;
+  size_t code_space_budget_;
+  int scavenge_pause_budget_;
 };
 
 
@@ -5609,6 +5882,128 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about a single completed garbage collection cycle, delivered
+ * through the callback installed with Isolate::SetGCCycleStatisticsCallback.
+ * Times are in milliseconds on the monotonic clock, sizes in bytes. The
+ * struct is versioned: fields are only ever appended, and version() tells
+ * which revision of the struct the embedder is looking at.
+ */
+class V8_EXPORT GCCycleStatistics {
+ public:
+  enum CycleType {
+    kScavenger = 0,
+    kMarkCompactor = 1,
+    kIncrementalMarkCompactor = 2
+  };
+
+  static const int kCurrentVersion = 1;
+
+  GCCycleStatistics();
+
+  int version() const { return version_; }
+  CycleType cycle_type() const { return cycle_type_; }
+  /** Static string describing why the cycle was started; never NULL. */
+  const char* gc_reason() const { return gc_reason_; }
+  double start_time() const { return start_time_; }
+  double end_time() const { return end_time_; }
+  size_t start_object_size() const { return start_object_size_; }
+  size_t end_object_size() const { return end_object_size_; }
+  size_t start_memory_size() const { return start_memory_size_; }
+  size_t end_memory_size() const { return end_memory_size_; }
+  size_t new_space_object_size() const { return new_space_object_size_; }
+  size_t survived_new_space_object_size() const {
+    return survived_new_space_object_size_;
+  }
+  size_t incremental_marking_bytes() const {
+    return incremental_marking_bytes_;
+  }
+  /** Time spent in incremental marking steps before this cycle finished. */
+  double incremental_marking_time() const { return incremental_marking_time_; }
+  /** Atomic-pause phase times; zero for phases the cycle did not run. */
+  double marking_time() const { return marking_time_; }
+  double clearing_time() const { return clearing_time_; }
+  double sweeping_time() const { return sweeping_time_; }
+  double evacuation_time() const { return evacuation_time_; }
+  /** Time spent in embedder callbacks during the cycle. */
+  double external_time() const { return external_time_; }
+  double scavenger_time() const { return scavenger_time_; }
+
+ private:
+  int version_;
+  CycleType cycle_type_;
+  const char* gc_reason_;
+  double start_time_;
+  double end_time_;
+  size_t start_object_size_;
+  size_t end_object_size_;
+  size_t start_memory_size_;
+  size_t end_memory_size_;
+  size_t new_space_object_size_;
+  size_t survived_new_space_object_size_;
+  size_t incremental_marking_bytes_;
+  double incremental_marking_time_;
+  double marking_time_;
+  double clearing_time_;
+  double sweeping_time_;
+  double evacuation_time_;
+  double external_time_;
+  double scavenger_time_;
+
+  friend class internal::GCTracer;
+};
+
+typedef void (*GCCycleStatisticsCallback)(Isolate* isolate,
+                                          const GCCycleStatistics& statistics);
+
+/**
+ * Interface for iterating the deoptimization statistics V8 aggregates per
+ * function and deoptimization reason (see
+ * Isolate::VisitDeoptimizationStatistics).
+ */
+class V8_EXPORT DeoptStatisticsVisitor {
+ public:
+  virtual ~DeoptStatisticsVisitor() {}
+
+  /**
+   * Called once per function and deoptimization reason with the number of
+   * deoptimizations recorded for that pair. |function_name| is the
+   * function's debug name followed by '@' and its source position; both
+   * strings are only valid during the call.
+   */
+  virtual void VisitDeoptCount(const char* function_name, const char* reason,
+                               int count) = 0;
+};
+
+/**
+ * Callback invoked whenever a function's cumulative deoptimization count
+ * reaches a multiple of the threshold passed to
+ * Isolate::SetHotDeoptCallback. |function_name| is only valid during the
+ * call.
+ */
+typedef void (*HotDeoptCallback)(Isolate* isolate, const char* function_name,
+                                 int deopt_count);
+
+/**
+ * Interface for enumerating functions that V8 has marked unoptimizable
+ * (see Isolate::VisitOptimizationBlockers).
+ */
+class V8_EXPORT OptimizationBlockerVisitor {
+ public:
+  virtual ~OptimizationBlockerVisitor() {}
+
+  /**
+   * Called once per blocked function, hottest first. |function_name| is the
+   * function's debug name and |reason| the bailout reason that disabled
+   * optimization; both strings are only valid during the call.
+   * |profiler_ticks| is the function's current runtime profiler tick count,
+   * a rough measure of how hot the function still is.
+   */
+  virtual void VisitBlockedFunction(const char* function_name,
+                                    const char* reason,
+                                    int profiler_ticks) = 0;
+};
+
 class RetainedObjectInfo;
 
 
@@ -6198,6 +6593,66 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Installs a callback that is invoked at the end of every garbage
+   * collection cycle with a GCCycleStatistics struct, so embedders can feed
+   * GC telemetry into their own monitoring without parsing --trace-gc
+   * output. The callback runs while V8 is still in the garbage collection
+   * epilogue and must not re-enter V8. Pass NULL to remove the callback.
+   */
+  void SetGCCycleStatisticsCallback(GCCycleStatisticsCallback callback);
+
+  /**
+   * Serializes the scripts currently held in this isolate's compilation
+   * cache into a single buffer, so embedders that restart isolates (e.g.
+   * worker pools) can rehydrate the cache in a fresh isolate with
+   * ImportCompilationCache instead of recompiling every script. Entries are
+   * keyed by the same source, script origin and language mode criteria the
+   * compilation cache applies on lookup; entries whose code cannot be
+   * serialized are left out. Returns NULL if there is nothing to export.
+   * The caller owns the returned data.
+   */
+  ScriptCompiler::CachedData* ExportCompilationCache();
+
+  /**
+   * Restores scripts previously serialized with ExportCompilationCache into
+   * this isolate's compilation cache. Entries that fail the code
+   * serializer's sanity checks (produced by a different V8 version, with
+   * different flags, or on a different CPU) are skipped individually. The
+   * data must have been produced by ExportCompilationCache; a context must
+   * be entered when this is called.
+   */
+  void ImportCompilationCache(const ScriptCompiler::CachedData* cached_data);
+
+  /**
+   * Iterates the deoptimization statistics collected so far. V8 counts
+   * every executed deoptimization per function and deoptimization reason,
+   * so embedders can find functions that deoptimize repeatedly (e.g. from
+   * map-thrashing call sites) without parsing --trace-deopt output.
+   */
+  void VisitDeoptimizationStatistics(DeoptStatisticsVisitor* visitor);
+
+  /**
+   * Installs a callback that is invoked whenever a function's cumulative
+   * deoptimization count reaches a multiple of |threshold|, so deopt storms
+   * surface as they happen rather than in after-the-fact CPU profiles. The
+   * callback runs while V8 is processing the deoptimization and must not
+   * re-enter V8. Pass NULL to remove the callback.
+   */
+  void SetHotDeoptCallback(HotDeoptCallback callback, int threshold);
+
+  /**
+   * Enumerates the functions belonging to |context| that V8 has marked
+   * unoptimizable, together with the bailout reason that disabled
+   * optimization (e.g. a with statement) and the function's current runtime
+   * profiler tick count. Functions are reported hottest first; at most
+   * |max_functions| are reported (pass a negative value for no limit). This
+   * walks the heap and is therefore too expensive for hot paths; it is
+   * meant for diagnostic "why is this slow" endpoints.
+   */
+  void VisitOptimizationBlockers(Local<Context> context, int max_functions,
+                                 OptimizationBlockerVisitor* visitor);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -6585,6 +7040,14 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Overrides the cumulative inlining budget (in AST nodes) that the
+   * optimizing compiler may spend per compiled function. Larger budgets
+   * inline hot call chains more deeply at the cost of code size and compile
+   * time. Pass 0 to restore the default budget.
+   */
+  void SetInliningBudget(int budget);
+
   /**
    * Allows the host application to provide the address of a function that is
    * notified each time code is added, moved or removed.
@@ -7585,6 +8048,18 @@ class V8_EXPORT Context {
    */
   void SetAlignedPointerInEmbedderData(int index, void* value);
 
+  /**
+   * Grows the embedder data to hold at least |count| slots. Reserving all
+   * slot indices once, right after context creation, guarantees that the
+   * unchecked inline fast paths of GetEmbedderData and
+   * GetAlignedPointerFromEmbedderData stay within bounds for indices below
+   * |count| and that later calls to SetEmbedderData and
+   * SetAlignedPointerInEmbedderData for those indices never reallocate the
+   * backing store. Reservation only sizes the storage: a slot still has to
+   * be written before it is read as an aligned pointer.
+   */
+  void ReserveEmbedderDataSlots(int count);
+
   /**
    * Control whether code generation from strings is allowed. Calling
    * this method with false will disable 'eval' and the 'Function'
@@ -7618,6 +8093,26 @@ class V8_EXPORT Context {
    */
   size_t EstimatedSize();
 
+  /**
+   * Returns the number of bytes that were allocated on the V8 heap while
+   * this context was the current context. The counter is maintained only
+   * when V8 runs with --track-context-allocation. Attribution happens at
+   * allocation time, so this is an estimate of the context's allocation
+   * volume, not of its retained size.
+   */
+  size_t GetAllocatedBytes();
+
+  /**
+   * Caps the number of bytes this context may allocate on the V8 heap.
+   * Once the counter returned by GetAllocatedBytes reaches the limit,
+   * script execution in this context is terminated as if
+   * Isolate::TerminateExecution had been called; the embedder can observe
+   * the termination with a TryCatch and recover with
+   * Isolate::CancelTerminateExecution. The limit is only enforced when V8
+   * runs with --track-context-allocation. Pass 0 to remove the limit.
+   */
+  void SetAllocationLimit(size_t limit);
+
   /**
    * Stack-allocated class which sets the execution context for all
    * operations executed within a local scope.
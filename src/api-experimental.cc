@@ -129,6 +129,11 @@ void FastAccessorBuilder::CheckNotZeroOrJump(ValueId value_id,
   FromApi(this)->CheckNotZeroOrJump(value_id, label_id);
 }
 
+FastAccessorBuilder::ValueId FastAccessorBuilder::CallIntGetter(
+    IntGetterCallback callback, ValueId value_id) {
+  return FromApi(this)->CallIntGetter(callback, value_id);
+}
+
 FastAccessorBuilder::ValueId FastAccessorBuilder::Call(
     v8::FunctionCallback callback, ValueId value_id) {
   return FromApi(this)->Call(callback, value_id);
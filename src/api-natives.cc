@@ -648,70 +648,87 @@ Handle<JSFunction> ApiNatives::CreateApiFunction(
                           DONT_ENUM);
   }
 
-  int internal_field_count = 0;
-  if (!obj->instance_template()->IsUndefined(isolate)) {
-    Handle<ObjectTemplateInfo> instance_template = Handle<ObjectTemplateInfo>(
-        ObjectTemplateInfo::cast(obj->instance_template()));
-    internal_field_count = instance_template->internal_field_count();
-  }
-
-  // TODO(svenpanne) Kill ApiInstanceType and refactor things by generalizing
-  // JSObject::GetHeaderSize.
-  int instance_size = kPointerSize * internal_field_count;
-  InstanceType type;
-  switch (instance_type) {
-    case JavaScriptObjectType:
-      if (!obj->needs_access_check() &&
-          obj->named_property_handler()->IsUndefined(isolate) &&
-          obj->indexed_property_handler()->IsUndefined(isolate)) {
-        type = JS_API_OBJECT_TYPE;
-      } else {
-        type = JS_SPECIAL_API_OBJECT_TYPE;
-      }
-      instance_size += JSObject::kHeaderSize;
-      break;
-    case GlobalObjectType:
-      type = JS_GLOBAL_OBJECT_TYPE;
-      instance_size += JSGlobalObject::kSize;
-      break;
-    case GlobalProxyType:
-      type = JS_GLOBAL_PROXY_TYPE;
-      instance_size += JSGlobalProxy::kSize;
-      break;
-    default:
-      UNREACHABLE();
-      type = JS_OBJECT_TYPE;  // Keep the compiler happy.
-      break;
-  }
-
-  Handle<Map> map =
-      isolate->factory()->NewMap(type, instance_size, FAST_HOLEY_SMI_ELEMENTS);
-  JSFunction::SetInitialMap(result, map, Handle<JSObject>::cast(prototype));
+  Handle<Map> map;
+  if (instance_type == JavaScriptObjectType &&
+      obj->cached_template_map()->IsMap()) {
+    // The shape was computed by an earlier instantiation, possibly in a
+    // different context. Stamp a copy; the context-dependent prototype and
+    // constructor are hooked up below.
+    map = Map::Copy(handle(Map::cast(obj->cached_template_map()), isolate),
+                    "ApiFunctionTemplateMap");
+  } else {
+    int internal_field_count = 0;
+    if (!obj->instance_template()->IsUndefined(isolate)) {
+      Handle<ObjectTemplateInfo> instance_template = Handle<ObjectTemplateInfo>(
+          ObjectTemplateInfo::cast(obj->instance_template()));
+      internal_field_count = instance_template->internal_field_count();
+    }
 
-  // Mark as undetectable if needed.
-  if (obj->undetectable()) {
-    map->set_is_undetectable();
-  }
+    // TODO(svenpanne) Kill ApiInstanceType and refactor things by generalizing
+    // JSObject::GetHeaderSize.
+    int instance_size = kPointerSize * internal_field_count;
+    InstanceType type;
+    switch (instance_type) {
+      case JavaScriptObjectType:
+        if (!obj->needs_access_check() &&
+            obj->named_property_handler()->IsUndefined(isolate) &&
+            obj->indexed_property_handler()->IsUndefined(isolate)) {
+          type = JS_API_OBJECT_TYPE;
+        } else {
+          type = JS_SPECIAL_API_OBJECT_TYPE;
+        }
+        instance_size += JSObject::kHeaderSize;
+        break;
+      case GlobalObjectType:
+        type = JS_GLOBAL_OBJECT_TYPE;
+        instance_size += JSGlobalObject::kSize;
+        break;
+      case GlobalProxyType:
+        type = JS_GLOBAL_PROXY_TYPE;
+        instance_size += JSGlobalProxy::kSize;
+        break;
+      default:
+        UNREACHABLE();
+        type = JS_OBJECT_TYPE;  // Keep the compiler happy.
+        break;
+    }
 
-  // Mark as needs_access_check if needed.
-  if (obj->needs_access_check()) {
-    map->set_is_access_check_needed(true);
-  }
+    map = isolate->factory()->NewMap(type, instance_size,
+                                     FAST_HOLEY_SMI_ELEMENTS);
 
-  // Set interceptor information in the map.
-  if (!obj->named_property_handler()->IsUndefined(isolate)) {
-    map->set_has_named_interceptor();
-  }
-  if (!obj->indexed_property_handler()->IsUndefined(isolate)) {
-    map->set_has_indexed_interceptor();
-  }
+    // Mark as undetectable if needed.
+    if (obj->undetectable()) {
+      map->set_is_undetectable();
+    }
+
+    // Mark as needs_access_check if needed.
+    if (obj->needs_access_check()) {
+      map->set_is_access_check_needed(true);
+    }
+
+    // Set interceptor information in the map.
+    if (!obj->named_property_handler()->IsUndefined(isolate)) {
+      map->set_has_named_interceptor();
+    }
+    if (!obj->indexed_property_handler()->IsUndefined(isolate)) {
+      map->set_has_indexed_interceptor();
+    }
+
+    // Mark instance as callable in the map.
+    if (!obj->instance_call_handler()->IsUndefined(isolate)) {
+      map->set_is_callable();
+      map->set_is_constructor(true);
+    }
 
-  // Mark instance as callable in the map.
-  if (!obj->instance_call_handler()->IsUndefined(isolate)) {
-    map->set_is_callable();
-    map->set_is_constructor(true);
+    if (instance_type == JavaScriptObjectType && !obj->do_not_cache()) {
+      // Remember the shape before it gets bound to this context's prototype
+      // and constructor, so instantiations in other contexts can reuse it.
+      obj->set_cached_template_map(*map);
+      map = Map::Copy(map, "ApiFunctionTemplateMap");
+    }
   }
 
+  JSFunction::SetInitialMap(result, map, Handle<JSObject>::cast(prototype));
   return result;
 }
 
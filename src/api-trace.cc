@@ -0,0 +1,155 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/api-trace.h"
+
+#include <stdio.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/flags.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+#ifdef V8_ENABLE_API_TRACING
+
+namespace {
+
+base::LazyMutex trace_mutex = LAZY_MUTEX_INITIALIZER;
+FILE* trace_file = NULL;
+bool trace_file_open_failed = false;
+
+// Opens the trace file on first use. Called with trace_mutex held.
+bool EnsureTraceFileOpen() {
+  if (trace_file != NULL) return true;
+  if (trace_file_open_failed || FLAG_api_trace_file == NULL) return false;
+  trace_file = base::OS::FOpen(FLAG_api_trace_file, "wb");
+  if (trace_file == NULL) {
+    PrintF("Could not open API trace file %s\n", FLAG_api_trace_file);
+    trace_file_open_failed = true;
+    return false;
+  }
+  fwrite(&kApiTraceMagic, sizeof(kApiTraceMagic), 1, trace_file);
+  fwrite(&kApiTraceVersion, sizeof(kApiTraceVersion), 1, trace_file);
+  return true;
+}
+
+void AppendInt32(std::vector<uint8_t>* payload, int32_t value) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  payload->insert(payload->end(), bytes, bytes + sizeof(value));
+}
+
+void AppendDouble(std::vector<uint8_t>* payload, double value) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  payload->insert(payload->end(), bytes, bytes + sizeof(value));
+}
+
+void AppendBytes(std::vector<uint8_t>* payload, const char* data,
+                 int length) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  payload->insert(payload->end(), bytes, bytes + length);
+}
+
+// Payloads are assembled outside the lock; only the append to the file is
+// serialized, so records from different threads interleave but never tear.
+void WriteRecord(uint8_t kind, const std::vector<uint8_t>& payload) {
+  base::LockGuard<base::Mutex> lock_guard(trace_mutex.Pointer());
+  if (!EnsureTraceFileOpen()) return;
+  fputc(kind, trace_file);
+  uint32_t length = static_cast<uint32_t>(payload.size());
+  fwrite(&length, sizeof(length), 1, trace_file);
+  if (length > 0) fwrite(&payload[0], 1, length, trace_file);
+}
+
+}  // namespace
+
+
+void ApiTraceWriter::RecordContextNew() {
+  if (FLAG_api_trace_file == NULL) return;
+  WriteRecord(kApiTraceContextNew, std::vector<uint8_t>());
+}
+
+
+void ApiTraceWriter::RecordScriptCompile(int script_id,
+                                         Handle<String> source) {
+  if (FLAG_api_trace_file == NULL) return;
+  int length = 0;
+  source = String::Flatten(source);
+  std::unique_ptr<char[]> utf8 =
+      source->ToCString(DISALLOW_NULLS, FAST_STRING_TRAVERSAL, &length);
+  std::vector<uint8_t> payload;
+  AppendInt32(&payload, script_id);
+  AppendBytes(&payload, utf8.get(), length);
+  WriteRecord(kApiTraceScriptCompile, payload);
+}
+
+
+void ApiTraceWriter::RecordScriptRun(int script_id) {
+  if (FLAG_api_trace_file == NULL) return;
+  std::vector<uint8_t> payload;
+  AppendInt32(&payload, script_id);
+  WriteRecord(kApiTraceScriptRun, payload);
+}
+
+
+void ApiTraceWriter::RecordFunctionCall(Isolate* isolate,
+                                        Handle<Object> function, int argc,
+                                        Handle<Object>* args) {
+  if (FLAG_api_trace_file == NULL) return;
+  std::vector<uint8_t> payload;
+  int name_length = 0;
+  std::unique_ptr<char[]> name;
+  if (function->IsJSFunction()) {
+    Handle<Object> name_obj(Handle<JSFunction>::cast(function)->shared()->name(),
+                            isolate);
+    if (name_obj->IsString()) {
+      Handle<String> name_string =
+          String::Flatten(Handle<String>::cast(name_obj));
+      name = name_string->ToCString(DISALLOW_NULLS, FAST_STRING_TRAVERSAL,
+                                    &name_length);
+    }
+  }
+  AppendInt32(&payload, name_length);
+  if (name_length > 0) AppendBytes(&payload, name.get(), name_length);
+  AppendInt32(&payload, argc);
+  for (int i = 0; i < argc; i++) {
+    Object* arg = *args[i];
+    if (arg->IsUndefined(isolate)) {
+      payload.push_back(kApiTraceValueUndefined);
+    } else if (arg->IsNull(isolate)) {
+      payload.push_back(kApiTraceValueNull);
+    } else if (arg->IsTrue(isolate)) {
+      payload.push_back(kApiTraceValueTrue);
+    } else if (arg->IsFalse(isolate)) {
+      payload.push_back(kApiTraceValueFalse);
+    } else if (arg->IsNumber()) {
+      payload.push_back(kApiTraceValueNumber);
+      AppendDouble(&payload, arg->Number());
+    } else if (arg->IsString()) {
+      payload.push_back(kApiTraceValueString);
+      AppendInt32(&payload, String::cast(arg)->length());
+    } else {
+      payload.push_back(kApiTraceValueOther);
+    }
+  }
+  WriteRecord(kApiTraceFunctionCall, payload);
+}
+
+
+void ApiTraceWriter::TearDown() {
+  base::LockGuard<base::Mutex> lock_guard(trace_mutex.Pointer());
+  if (trace_file == NULL) return;
+  fclose(trace_file);
+  trace_file = NULL;
+}
+
+#endif  // V8_ENABLE_API_TRACING
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,69 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_API_TRACE_H_
+#define V8_API_TRACE_H_
+
+#include <stdint.h>
+
+#include "src/allocation.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Object;
+class String;
+
+// Binary format of API call traces, shared between the recorder behind
+// V8_ENABLE_API_TRACING in api.cc and the replayer in d8. A trace file is
+//   uint32 magic, uint32 version
+// followed by a stream of records, each
+//   uint8 kind, uint32 payload_length, payload bytes.
+// All multi-byte values use host byte order; traces are replayed on the
+// architecture that recorded them.
+static const uint32_t kApiTraceMagic = 0x56384154;  // "V8AT"
+static const uint32_t kApiTraceVersion = 1;
+
+// Record kinds and their payloads.
+enum ApiTraceRecord {
+  kApiTraceContextNew = 0,     // no payload
+  kApiTraceScriptCompile = 1,  // int32 script id, UTF-8 source text
+  kApiTraceScriptRun = 2,      // int32 script id
+  kApiTraceFunctionCall = 3    // int32 name length, UTF-8 name, int32 argc,
+                               // one fingerprint per argument
+};
+
+// Argument fingerprints: a tag byte, followed by the value for numbers and
+// by an int32 length for strings. Other values carry no payload and are
+// replayed as undefined.
+enum ApiTraceValueTag {
+  kApiTraceValueUndefined = 0,
+  kApiTraceValueNull = 1,
+  kApiTraceValueTrue = 2,
+  kApiTraceValueFalse = 3,
+  kApiTraceValueNumber = 4,
+  kApiTraceValueString = 5,
+  kApiTraceValueOther = 6
+};
+
+#ifdef V8_ENABLE_API_TRACING
+// Appends records to the file named by --api-trace-file. The writer is
+// process-global and thread-safe so that the API activity of all isolates
+// of an embedder ends up in a single stream.
+class ApiTraceWriter : public AllStatic {
+ public:
+  static void RecordContextNew();
+  static void RecordScriptCompile(int script_id, Handle<String> source);
+  static void RecordScriptRun(int script_id);
+  static void RecordFunctionCall(Isolate* isolate, Handle<Object> function,
+                                 int argc, Handle<Object>* args);
+  static void TearDown();
+};
+#endif  // V8_ENABLE_API_TRACING
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_API_TRACE_H_
@@ -10,6 +10,8 @@
 #endif  // V8_USE_ADDRESS_SANITIZER
 #include <cmath>  // For isnan.
 #include <limits>
+#include <algorithm>
+#include <set>
 #include <vector>
 #include "include/v8-debug.h"
 #include "include/v8-experimental.h"
@@ -19,6 +21,7 @@
 #include "src/accessors.h"
 #include "src/api-experimental.h"
 #include "src/api-natives.h"
+#include "src/api-trace.h"
 #include "src/assert-scope.h"
 #include "src/background-parsing-task.h"
 #include "src/base/functional.h"
@@ -29,6 +32,7 @@
 #include "src/bootstrapper.h"
 #include "src/char-predicates-inl.h"
 #include "src/code-stubs.h"
+#include "src/compilation-cache.h"
 #include "src/compiler.h"
 #include "src/context-measure.h"
 #include "src/contexts.h"
@@ -41,6 +45,7 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -60,11 +65,13 @@
 #include "src/prototype.h"
 #include "src/runtime-profiler.h"
 #include "src/runtime/runtime.h"
+#include "src/shared-backing-store-registry.h"
 #include "src/simulator.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
 #include "src/startup-data-util.h"
+#include "src/string-builder.h"
 #include "src/tracing/trace-event.h"
 #include "src/unicode-inl.h"
 #include "src/v8.h"
@@ -688,7 +695,10 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       max_executable_size_(0),
       stack_limit_(NULL),
-      code_range_size_(0) { }
+      code_range_size_(0),
+      incremental_marking_safety_factor_(0),
+      code_space_budget_(0),
+      scavenge_pause_budget_(0) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -747,6 +757,18 @@ void SetResourceConstraints(i::Isolate* isolate,
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
     isolate->stack_guard()->SetStackLimit(limit);
   }
+  if (constraints.incremental_marking_safety_factor() > 0) {
+    isolate->heap()->set_incremental_marking_safety_factor(
+        constraints.incremental_marking_safety_factor());
+  }
+  if (constraints.code_space_budget() > 0) {
+    isolate->heap()->set_code_space_budget(constraints.code_space_budget() *
+                                           i::MB);
+  }
+  if (constraints.scavenge_pause_budget() > 0) {
+    isolate->heap()->set_scavenge_pause_budget(
+        constraints.scavenge_pause_budget());
+  }
 }
 
 
@@ -934,6 +956,29 @@ SealHandleScope::~SealHandleScope() {
 }
 
 
+PersistentHandleGroup::PersistentHandleGroup(Isolate* isolate)
+    : arena_(new i::PersistentHandleArena(
+          reinterpret_cast<i::Isolate*>(isolate))) {}
+
+
+PersistentHandleGroup::~PersistentHandleGroup() {
+  delete static_cast<i::PersistentHandleArena*>(arena_);
+}
+
+
+Local<Value> PersistentHandleGroup::Add(Local<Value> value) {
+  i::Handle<i::Object> result =
+      static_cast<i::PersistentHandleArena*>(arena_)->Create(
+          *Utils::OpenHandle(*value));
+  return ToApiHandle<Value>(result);
+}
+
+
+void PersistentHandleGroup::Reset() {
+  static_cast<i::PersistentHandleArena*>(arena_)->Reset();
+}
+
+
 void Context::Enter() {
   i::Handle<i::Context> env = Utils::OpenHandle(this);
   i::Isolate* isolate = env->GetIsolate();
@@ -1034,6 +1079,13 @@ void Context::SetAlignedPointerInEmbedderData(int index, void* value) {
 }
 
 
+void Context::ReserveEmbedderDataSlots(int count) {
+  const char* location = "v8::Context::ReserveEmbedderDataSlots()";
+  if (!Utils::ApiCheck(count >= 1, location, "Non-positive count")) return;
+  EmbedderDataFor(this, count - 1, true, location);
+}
+
+
 // --- T e m p l a t e ---
 
 
@@ -1527,6 +1579,9 @@ static i::Handle<i::InterceptorInfo> CreateInterceptorInfo(
                         static_cast<int>(PropertyHandlerFlags::kAllCanRead));
   obj->set_non_masking(static_cast<int>(flags) &
                        static_cast<int>(PropertyHandlerFlags::kNonMasking));
+  obj->set_stable_per_map(
+      static_cast<int>(flags) &
+      static_cast<int>(PropertyHandlerFlags::kStablePerMap));
 
   if (data.IsEmpty()) {
     data = v8::Undefined(reinterpret_cast<v8::Isolate*>(isolate));
@@ -1842,6 +1897,12 @@ MaybeLocal<Value> Script::Run(Local<Context> context) {
   i::TimerEventScope<i::TimerEventExecute> timer_scope(isolate);
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
   auto fun = i::Handle<i::JSFunction>::cast(Utils::OpenHandle(this));
+#ifdef V8_ENABLE_API_TRACING
+  if (fun->shared()->script()->IsScript()) {
+    i::ApiTraceWriter::RecordScriptRun(
+        i::Script::cast(fun->shared()->script())->id());
+  }
+#endif  // V8_ENABLE_API_TRACING
   i::Handle<i::Object> receiver = isolate->global_proxy();
   Local<Value> result;
   has_pending_exception =
@@ -1868,6 +1929,29 @@ Local<UnboundScript> Script::GetUnboundScript() {
       i::Handle<i::SharedFunctionInfo>(i::JSFunction::cast(*obj)->shared()));
 }
 
+void Script::MarkFunctionsForOptimization(const int* start_positions,
+                                          size_t count) {
+  auto fun = i::Handle<i::JSFunction>::cast(Utils::OpenHandle(this));
+  i::Isolate* isolate = fun->GetIsolate();
+  ENTER_V8(isolate);
+  i::DisallowHeapAllocation no_gc;
+  i::Object* maybe_script = fun->shared()->script();
+  if (!maybe_script->IsScript()) return;
+  i::Script* script = i::Script::cast(maybe_script);
+  if (!script->shared_function_infos()->IsWeakFixedArray()) return;
+  i::WeakFixedArray::Iterator iterator(script->shared_function_infos());
+  i::SharedFunctionInfo* shared;
+  while ((shared = iterator.Next<i::SharedFunctionInfo>())) {
+    if (shared->optimization_disabled()) continue;
+    for (size_t i = 0; i < count; i++) {
+      if (shared->start_position() == start_positions[i]) {
+        shared->set_marked_for_tier_up(true);
+        break;
+      }
+    }
+  }
+}
+
 
 MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     Isolate* v8_isolate, Source* source, CompileOptions options,
@@ -1939,6 +2023,12 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     }
     delete script_data;
   }
+#ifdef V8_ENABLE_API_TRACING
+  if (result->script()->IsScript()) {
+    i::ApiTraceWriter::RecordScriptCompile(
+        i::Script::cast(result->script())->id(), str);
+  }
+#endif  // V8_ENABLE_API_TRACING
   RETURN_ESCAPED(ToApiHandle<UnboundScript>(result));
 }
 
@@ -2835,6 +2925,29 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::ChunkedParser::PrivateData {
+  explicit PrivateData(i::Isolate* i) : assembler(i) {}
+  i::JsonChunkedAssembler assembler;
+};
+
+JSON::ChunkedParser::ChunkedParser(Isolate* isolate)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(isolate))) {}
+
+JSON::ChunkedParser::~ChunkedParser() { delete private_; }
+
+bool JSON::ChunkedParser::Append(const uint8_t* chunk, size_t length) {
+  return private_->assembler.Append(chunk, length);
+}
+
+MaybeLocal<Value> JSON::ChunkedParser::Parse(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  auto maybe = private_->assembler.Parse();
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 struct ValueSerializer::PrivateData {
@@ -3814,6 +3927,44 @@ Maybe<bool> v8::Object::DefineOwnProperty(v8::Local<v8::Context> context,
 }
 
 
+Maybe<bool> v8::Object::DefineProperties(v8::Local<v8::Context> context,
+                                         size_t count, Local<Name>* names,
+                                         Local<Value>* values,
+                                         const PropertyAttribute* attributes) {
+  PREPARE_FOR_EXECUTION_PRIMITIVE(context, Object, DefineProperties, bool);
+  i::Handle<i::JSReceiver> self = Utils::OpenHandle(this);
+
+  // The access check is done once for the whole batch; it cannot change
+  // while we hold the VM.
+  if (self->IsAccessCheckNeeded() &&
+      !isolate->MayAccess(handle(isolate->context()),
+                          i::Handle<i::JSObject>::cast(self))) {
+    isolate->ReportFailedAccessCheck(i::Handle<i::JSObject>::cast(self));
+    return Nothing<bool>();
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*names[i]);
+    i::Handle<i::Object> value_obj = Utils::OpenHandle(*values[i]);
+    PropertyAttribute raw_attributes =
+        attributes == nullptr ? None : attributes[i];
+
+    i::PropertyDescriptor desc;
+    desc.set_writable(!(raw_attributes & v8::ReadOnly));
+    desc.set_enumerable(!(raw_attributes & v8::DontEnum));
+    desc.set_configurable(!(raw_attributes & v8::DontDelete));
+    desc.set_value(value_obj);
+    Maybe<bool> success = i::JSReceiver::DefineOwnProperty(
+        isolate, self, key_obj, &desc, i::Object::DONT_THROW);
+    // Even though we said DONT_THROW, there might be accessors that do throw.
+    has_pending_exception = success.IsNothing();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    if (!success.FromJust()) return success;
+  }
+  return Just(true);
+}
+
+
 MUST_USE_RESULT
 static i::MaybeHandle<i::Object> DefineObjectProperty(
     i::Handle<i::JSObject> js_object, i::Handle<i::Object> key,
@@ -4638,6 +4789,9 @@ MaybeLocal<v8::Value> Function::Call(Local<Context> context,
   i::Handle<i::Object> recv_obj = Utils::OpenHandle(*recv);
   STATIC_ASSERT(sizeof(v8::Local<v8::Value>) == sizeof(i::Object**));
   i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
+#ifdef V8_ENABLE_API_TRACING
+  i::ApiTraceWriter::RecordFunctionCall(isolate, self, argc, args);
+#endif  // V8_ENABLE_API_TRACING
   Local<Value> result;
   has_pending_exception = !ToLocal<Value>(
       i::Execution::Call(isolate, self, recv_obj, argc, args), &result);
@@ -4653,6 +4807,38 @@ Local<v8::Value> Function::Call(v8::Local<v8::Value> recv, int argc,
 }
 
 
+size_t Function::CallBatch(Local<Context> context,
+                           const Invocation* invocations, size_t count,
+                           MaybeLocal<Value>* results) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  if (IsExecutionTerminatingCheck(isolate)) return 0;
+  // No escapable scope here: the result handles are created in the caller's
+  // HandleScope, since a batch produces an arbitrary number of them.
+  CallDepthScope<true> call_depth_scope(isolate, context);
+  LOG_API(isolate, Function, CallBatch);
+  ENTER_V8(isolate);
+  i::TimerEventScope<i::TimerEventExecute> timer_scope(isolate);
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
+  STATIC_ASSERT(sizeof(v8::Local<v8::Value>) == sizeof(i::Object**));
+  for (size_t i = 0; i < count; i++) {
+    const Invocation& invocation = invocations[i];
+    auto self = Utils::OpenHandle(*invocation.function);
+    i::Handle<i::Object> recv_obj = Utils::OpenHandle(*invocation.recv);
+    i::Handle<i::Object>* args =
+        reinterpret_cast<i::Handle<i::Object>*>(invocation.argv);
+    Local<Value> result;
+    if (!ToLocal<Value>(
+            i::Execution::Call(isolate, self, recv_obj, invocation.argc, args),
+            &result)) {
+      call_depth_scope.Escape();
+      return i;
+    }
+    results[i] = result;
+  }
+  return count;
+}
+
+
 void Function::SetName(v8::Local<v8::String> name) {
   auto self = Utils::OpenHandle(this);
   if (!self->IsJSFunction()) return;
@@ -5703,6 +5889,27 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+GCCycleStatistics::GCCycleStatistics()
+    : version_(kCurrentVersion),
+      cycle_type_(kScavenger),
+      gc_reason_(nullptr),
+      start_time_(0),
+      end_time_(0),
+      start_object_size_(0),
+      end_object_size_(0),
+      start_memory_size_(0),
+      end_memory_size_(0),
+      new_space_object_size_(0),
+      survived_new_space_object_size_(0),
+      incremental_marking_bytes_(0),
+      incremental_marking_time_(0),
+      marking_time_(0),
+      clearing_time_(0),
+      sweeping_time_(0),
+      evacuation_time_(0),
+      external_time_(0),
+      scavenger_time_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -5844,6 +6051,9 @@ Local<Context> NewContext(v8::Isolate* external_isolate,
     }
     return Local<Context>();
   }
+#ifdef V8_ENABLE_API_TRACING
+  i::ApiTraceWriter::RecordContextNew();
+#endif  // V8_ENABLE_API_TRACING
   return Utils::ToLocal(scope.CloseAndEscape(env));
 }
 
@@ -5986,6 +6196,16 @@ size_t Context::EstimatedSize() {
 }
 
 
+size_t Context::GetAllocatedBytes() {
+  return Utils::OpenHandle(this)->GetAllocatedBytes();
+}
+
+
+void Context::SetAllocationLimit(size_t limit) {
+  Utils::OpenHandle(this)->SetAllocationLimit(limit);
+}
+
+
 MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   PREPARE_FOR_EXECUTION(context, ObjectTemplate, NewInstance, Object);
   auto self = Utils::OpenHandle(this);
@@ -6215,6 +6435,40 @@ Local<String> v8::String::Concat(Local<String> left, Local<String> right) {
 }
 
 
+v8::StringBuilder::StringBuilder(Isolate* v8_isolate, int estimated_length)
+    : isolate_(reinterpret_cast<i::Isolate*>(v8_isolate)) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8(isolate);
+  LOG_API(isolate, StringBuilder, New);
+  builder_ = new i::IncrementalStringBuilder(isolate, estimated_length);
+}
+
+
+v8::StringBuilder::~StringBuilder() {
+  delete reinterpret_cast<i::IncrementalStringBuilder*>(builder_);
+}
+
+
+void v8::StringBuilder::Append(Local<String> string) {
+  i::IncrementalStringBuilder* builder =
+      reinterpret_cast<i::IncrementalStringBuilder*>(builder_);
+  ENTER_V8(isolate_);
+  builder->AppendString(Utils::OpenHandle(*string));
+}
+
+
+MaybeLocal<String> v8::StringBuilder::Finish() {
+  i::IncrementalStringBuilder* builder =
+      reinterpret_cast<i::IncrementalStringBuilder*>(builder_);
+  ENTER_V8(isolate_);
+  LOG_API(isolate_, StringBuilder, Finish);
+  i::Handle<i::String> result;
+  // On overflow Finish() has scheduled an invalid string length exception.
+  if (!builder->Finish().ToHandle(&result)) return MaybeLocal<String>();
+  return Utils::ToLocal(result);
+}
+
+
 MaybeLocal<String> v8::String::NewExternalTwoByte(
     Isolate* isolate, v8::String::ExternalStringResource* resource) {
   CHECK(resource && resource->data());
@@ -6336,6 +6590,41 @@ Local<v8::Object> v8::Object::New(Isolate* isolate) {
 }
 
 
+Local<v8::Object> v8::Object::New(Isolate* isolate,
+                                  Local<Value> prototype_or_null,
+                                  Local<Name>* names, Local<Value>* values,
+                                  size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Object, New);
+  ENTER_V8(i_isolate);
+  i::Handle<i::JSObject> obj =
+      i_isolate->factory()->NewJSObject(i_isolate->object_function());
+  if (!prototype_or_null.IsEmpty()) {
+    i::Handle<i::Object> proto = Utils::OpenHandle(*prototype_or_null);
+    if (!Utils::ApiCheck(proto->IsNull(i_isolate) || proto->IsJSReceiver(),
+                         "v8::Object::New",
+                         "prototype must be null or object")) {
+      return Local<v8::Object>();
+    }
+    // Going through SetPrototype hits the prototype transition cache, so
+    // all objects created over the same prototype share a map.
+    CHECK(i::JSObject::SetPrototype(obj, proto, false,
+                                    i::Object::THROW_ON_ERROR)
+              .FromJust());
+  }
+  for (size_t i = 0; i < length; ++i) {
+    i::Handle<i::Name> name = Utils::OpenHandle(*names[i]);
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i]);
+    i::LookupIterator it = i::LookupIterator::PropertyOrElement(
+        i_isolate, obj, name, obj, i::LookupIterator::OWN_SKIP_INTERCEPTOR);
+    // Adding a data property to a fresh object cannot fail.
+    CHECK(i::JSObject::CreateDataProperty(&it, value, i::Object::DONT_THROW)
+              .FromJust());
+  }
+  return Utils::ToLocal(obj);
+}
+
+
 Local<v8::Value> v8::NumberObject::New(Isolate* isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   LOG_API(i_isolate, NumberObject, New);
@@ -6532,6 +6821,86 @@ Local<v8::Array> v8::Array::New(Isolate* isolate, int length) {
 }
 
 
+Local<v8::Array> v8::Array::New(Isolate* isolate, int length,
+                                ElementsHint hint) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8(i_isolate);
+  int real_length = length > 0 ? length : 0;
+  i::ElementsKind elements_kind = i::TERMINAL_FAST_ELEMENTS_KIND;
+  switch (hint) {
+    case ElementsHint::kDefault:
+      break;
+    case ElementsHint::kSmis:
+      elements_kind = i::FAST_SMI_ELEMENTS;
+      break;
+    case ElementsHint::kDoubles:
+      elements_kind = i::FAST_DOUBLE_ELEMENTS;
+      break;
+  }
+  i::Handle<i::JSArray> obj =
+      i_isolate->factory()->NewJSArray(real_length, elements_kind);
+  i::Handle<i::Object> length_obj =
+      i_isolate->factory()->NewNumberFromInt(real_length);
+  obj->set_length(*length_obj);
+  return Utils::ToLocal(obj);
+}
+
+
+Local<v8::Array> v8::Array::New(Isolate* isolate, const double* values,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8(i_isolate);
+  Utils::ApiCheck(length <= static_cast<size_t>(i::FixedDoubleArray::kMaxLength),
+                  "v8::Array::New", "Too many elements");
+  int len = static_cast<int>(length);
+  i::Factory* factory = i_isolate->factory();
+  i::Handle<i::FixedArrayBase> elements = factory->NewFixedDoubleArray(len);
+  for (int i = 0; i < len; i++) {
+    i::Handle<i::FixedDoubleArray>::cast(elements)->set(i, values[i]);
+  }
+  i::Handle<i::JSArray> obj =
+      factory->NewJSArrayWithElements(elements, i::FAST_DOUBLE_ELEMENTS, len);
+  return Utils::ToLocal(obj);
+}
+
+
+Local<v8::Array> v8::Array::New(Isolate* isolate, const int32_t* values,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8(i_isolate);
+  Utils::ApiCheck(length <= static_cast<size_t>(i::FixedArray::kMaxLength),
+                  "v8::Array::New", "Too many elements");
+  int len = static_cast<int>(length);
+  bool all_smis = true;
+  for (int i = 0; i < len; i++) {
+    if (!i::Smi::IsValid(values[i])) {
+      all_smis = false;
+      break;
+    }
+  }
+  i::Factory* factory = i_isolate->factory();
+  i::Handle<i::JSArray> obj;
+  if (all_smis) {
+    i::Handle<i::FixedArray> elements = factory->NewFixedArray(len);
+    for (int i = 0; i < len; i++) {
+      elements->set(i, i::Smi::FromInt(values[i]));
+    }
+    obj = factory->NewJSArrayWithElements(elements, i::FAST_SMI_ELEMENTS, len);
+  } else {
+    i::Handle<i::FixedArrayBase> elements = factory->NewFixedDoubleArray(len);
+    for (int i = 0; i < len; i++) {
+      i::Handle<i::FixedDoubleArray>::cast(elements)->set(i, values[i]);
+    }
+    obj =
+        factory->NewJSArrayWithElements(elements, i::FAST_DOUBLE_ELEMENTS, len);
+  }
+  return Utils::ToLocal(obj);
+}
+
+
 uint32_t v8::Array::Length() const {
   i::Handle<i::JSArray> obj = Utils::OpenHandle(this);
   i::Object* length = obj->length();
@@ -6932,12 +7301,16 @@ WasmCompiledModule::SerializedModule WasmCompiledModule::Serialize() {
 
 MaybeLocal<WasmCompiledModule> WasmCompiledModule::Deserialize(
     Isolate* isolate,
-    const WasmCompiledModule::SerializedModule& serialized_data) {
+    const WasmCompiledModule::SerializedModule& serialized_data,
+    const WasmCompiledModule::CallerOwnedBuffer& wire_bytes) {
   int size = static_cast<int>(serialized_data.second);
   i::ScriptData sc(serialized_data.first.get(), size);
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   i::MaybeHandle<i::FixedArray> maybe_compiled_part =
-      i::WasmCompiledModuleSerializer::DeserializeWasmModule(i_isolate, &sc);
+      i::WasmCompiledModuleSerializer::DeserializeWasmModule(
+          i_isolate, &sc,
+          i::Vector<const uint8_t>(wire_bytes.first,
+                                   static_cast<int>(wire_bytes.second)));
   i::Handle<i::FixedArray> compiled_part;
   if (!maybe_compiled_part.ToHandle(&compiled_part)) {
     return MaybeLocal<WasmCompiledModule>();
@@ -7171,6 +7544,11 @@ v8::SharedArrayBuffer::Contents v8::SharedArrayBuffer::Externalize() {
                   "SharedArrayBuffer already externalized");
   self->set_is_external(true);
   isolate->heap()->UnregisterArrayBuffer(*self);
+  // Unregistering takes the buffer out of the tracker's free path, which is
+  // where the registry reference acquired in JSArrayBuffer::Setup would
+  // otherwise be dropped. Release it here; the return value is ignored since
+  // ownership of the memory transfers to the embedder either way.
+  i::SharedBackingStoreRegistry::Release(self->backing_store());
   return GetContents();
 }
 
@@ -7589,6 +7967,15 @@ void Isolate::Dispose() {
                        "Disposing the isolate that is entered by a thread.")) {
     return;
   }
+  // TODO(api): Embedders that cycle through short-lived isolates have asked
+  // for a cheaper "reset to post-snapshot state" instead of a full
+  // Dispose/New round trip. That would require distinguishing
+  // snapshot-reachable objects from everything allocated since
+  // deserialization (roots, builtins and code stubs may point into tenant
+  // state by then, e.g. through caches and the string table), so it cannot
+  // be bolted on here. Until the heap can track that boundary, the
+  // affordable mitigations are reusing contexts within one isolate and
+  // pooled page allocation in MemoryAllocator.
   isolate->TearDown();
 }
 
@@ -7762,6 +8149,122 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::SetGCCycleStatisticsCallback(GCCycleStatisticsCallback callback) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->SetCycleStatisticsCallback(callback);
+}
+
+ScriptCompiler::CachedData* Isolate::ExportCompilationCache() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScope scope(isolate);
+  i::ScriptData* script_data = isolate->compilation_cache()->ExportScriptData();
+  if (script_data == NULL) return NULL;
+  ScriptCompiler::CachedData* result = new ScriptCompiler::CachedData(
+      script_data->data(), script_data->length(),
+      ScriptCompiler::CachedData::BufferOwned);
+  script_data->ReleaseDataOwnership();
+  delete script_data;
+  return result;
+}
+
+void Isolate::ImportCompilationCache(
+    const ScriptCompiler::CachedData* cached_data) {
+  if (cached_data == NULL || cached_data->data == NULL) return;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  // Rehydrated entries are keyed on the current native context.
+  if (isolate->context() == NULL) return;
+  i::HandleScope scope(isolate);
+  isolate->compilation_cache()->ImportScriptData(cached_data->data,
+                                                 cached_data->length);
+}
+
+namespace {
+
+class DeoptStatisticsVisitorAdapter
+    : public i::DeoptimizationStatistics::Visitor {
+ public:
+  explicit DeoptStatisticsVisitorAdapter(DeoptStatisticsVisitor* visitor)
+      : visitor_(visitor) {}
+
+  void VisitDeoptCount(const char* function_name, const char* reason,
+                       int count) override {
+    visitor_->VisitDeoptCount(function_name, reason, count);
+  }
+
+ private:
+  DeoptStatisticsVisitor* visitor_;
+};
+
+}  // namespace
+
+void Isolate::VisitDeoptimizationStatistics(DeoptStatisticsVisitor* visitor) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  DeoptStatisticsVisitorAdapter adapter(visitor);
+  isolate->deoptimizer_data()->statistics()->Visit(&adapter);
+}
+
+void Isolate::SetHotDeoptCallback(HotDeoptCallback callback, int threshold) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->deoptimizer_data()->statistics()->set_hot_deopt_callback(callback,
+                                                                    threshold);
+}
+
+void Isolate::VisitOptimizationBlockers(Local<Context> context,
+                                        int max_functions,
+                                        OptimizationBlockerVisitor* visitor) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScope scope(isolate);
+  i::Handle<i::Context> env = Utils::OpenHandle(*context);
+  i::Context* native_context = env->native_context();
+
+  struct BlockedFunction {
+    i::Handle<i::SharedFunctionInfo> shared;
+    int ticks;
+  };
+  std::vector<BlockedFunction> blocked;
+  {
+    // Walk the heap to find all closures belonging to the context whose
+    // shared function info has optimization disabled, deduplicated by
+    // shared function info.
+    std::set<i::SharedFunctionInfo*> seen;
+    i::HeapIterator iterator(isolate->heap());
+    for (i::HeapObject* obj = iterator.next(); obj != NULL;
+         obj = iterator.next()) {
+      if (!obj->IsJSFunction()) continue;
+      i::JSFunction* function = i::JSFunction::cast(obj);
+      if (function->context()->native_context() != native_context) continue;
+      i::SharedFunctionInfo* shared = function->shared();
+      if (!shared->optimization_disabled()) continue;
+      if (!seen.insert(shared).second) continue;
+      // Profiler ticks live on the shared function info for interpreted
+      // functions and on the unoptimized code for full-codegen functions.
+      int ticks = shared->profiler_ticks();
+      if (shared->code()->kind() == i::Code::FUNCTION) {
+        ticks = i::Max(ticks, shared->code()->profiler_ticks());
+      }
+      BlockedFunction entry = {i::Handle<i::SharedFunctionInfo>(shared,
+                                                               isolate),
+                               ticks};
+      blocked.push_back(entry);
+    }
+  }
+
+  std::sort(blocked.begin(), blocked.end(),
+            [](const BlockedFunction& a, const BlockedFunction& b) {
+              return a.ticks > b.ticks;
+            });
+
+  int count = static_cast<int>(blocked.size());
+  if (max_functions >= 0 && max_functions < count) count = max_functions;
+  for (int i = 0; i < count; i++) {
+    i::Handle<i::SharedFunctionInfo> shared = blocked[i].shared;
+    std::unique_ptr<char[]> name = shared->DebugName()->ToCString();
+    visitor->VisitBlockedFunction(
+        name.get(), i::GetBailoutReason(shared->disable_optimization_reason()),
+        blocked[i].ticks);
+  }
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -7985,6 +8488,11 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetInliningBudget(int budget) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_inlining_budget(budget < 0 ? 0 : budget);
+}
+
 void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
                                      JitCodeEventHandler event_handler) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -8692,13 +9200,12 @@ size_t HeapGraphNode::GetShallowSize() const {
 
 
 int HeapGraphNode::GetChildrenCount() const {
-  return ToInternal(this)->children().length();
+  return ToInternal(this)->children_count();
 }
 
 
 const HeapGraphEdge* HeapGraphNode::GetChild(int index) const {
-  return reinterpret_cast<const HeapGraphEdge*>(
-      ToInternal(this)->children()[index]);
+  return reinterpret_cast<const HeapGraphEdge*>(ToInternal(this)->child(index));
 }
 
 
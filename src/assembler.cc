@@ -1447,6 +1447,20 @@ ExternalReference ExternalReference::re_word_character_map() {
       NativeRegExpMacroAssembler::word_character_map_address());
 }
 
+ExternalReference ExternalReference::re_skip_until_character_latin1(
+    Isolate* isolate) {
+  return ExternalReference(Redirect(
+      isolate,
+      FUNCTION_ADDR(NativeRegExpMacroAssembler::SkipUntilCharacterLatin1)));
+}
+
+ExternalReference ExternalReference::re_skip_until_character_uc16(
+    Isolate* isolate) {
+  return ExternalReference(Redirect(
+      isolate,
+      FUNCTION_ADDR(NativeRegExpMacroAssembler::SkipUntilCharacterUC16)));
+}
+
 ExternalReference ExternalReference::address_of_static_offsets_vector(
     Isolate* isolate) {
   return ExternalReference(
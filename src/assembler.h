@@ -1063,6 +1063,12 @@ class ExternalReference BASE_EMBEDDED {
   // byte NativeRegExpMacroAssembler::word_character_bitmap
   static ExternalReference re_word_character_map();
 
+  // Function NativeRegExpMacroAssembler::SkipUntilCharacterLatin1()
+  static ExternalReference re_skip_until_character_latin1(Isolate* isolate);
+
+  // Function NativeRegExpMacroAssembler::SkipUntilCharacterUC16()
+  static ExternalReference re_skip_until_character_uc16(Isolate* isolate);
+
 #endif
 
   // This lets you register a function that rewrites all external references.
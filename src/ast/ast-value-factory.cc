@@ -28,6 +28,7 @@
 #include "src/ast/ast-value-factory.h"
 
 #include "src/api.h"
+#include "src/global-handles.h"
 #include "src/objects.h"
 #include "src/utils.h"
 
@@ -220,6 +221,31 @@ void AstValue::Internalize(Isolate* isolate) {
 }
 
 
+AstStringConstants::AstStringConstants(Isolate* isolate, uint32_t hash_seed)
+    : zone_(isolate->allocator()), hash_seed_(hash_seed) {
+  DCHECK(ThreadId::Current().Equals(isolate->thread_id()));
+  HandleScope scope(isolate);
+#define F(name, str)                                                      \
+  {                                                                       \
+    /* The string lives in the read-only data segment, so the raw */      \
+    /* string can point at it directly. */                                \
+    const char* data = str;                                               \
+    Vector<const byte> literal(reinterpret_cast<const byte*>(data),       \
+                               static_cast<int>(strlen(data)));           \
+    uint32_t hash = StringHasher::HashSequentialString<uint8_t>(          \
+        literal.start(), literal.length(), hash_seed_);                   \
+    name##_string_ = new (&zone_) AstRawString(true, literal, hash);      \
+    name##_string_->Internalize(isolate);                                 \
+    /* The handle has to survive every parse in this isolate, so turn */  \
+    /* it into a global handle. */                                        \
+    name##_string_->string_ = Handle<String>::cast(                       \
+        isolate->global_handles()->Create(*name##_string_->string_));     \
+  }
+  STRING_CONSTANTS(F)
+#undef F
+}
+
+
 AstRawString* AstValueFactory::GetOneByteStringInternal(
     Vector<const uint8_t> literal) {
   uint32_t hash = StringHasher::HashSequentialString<uint8_t>(
@@ -283,6 +309,17 @@ void AstValueFactory::Internalize(Isolate* isolate) {
     return;
   }
 
+  // Grow the string table once for the whole batch instead of letting it
+  // rehash repeatedly while the strings are added. Functions parsed on a
+  // background thread internalize all of their strings in one batch here,
+  // and those batches can be large.
+  int string_count = 0;
+  for (AstString* current = strings_; current != nullptr;
+       current = current->next()) {
+    string_count++;
+  }
+  StringTable::EnsureCapacityForDeserialization(isolate, string_count);
+
   // Strings need to be internalized before values, because values refer to
   // strings.
   for (AstString* current = strings_; current != nullptr;) {
@@ -31,6 +31,7 @@
 #include "src/api.h"
 #include "src/base/hashmap.h"
 #include "src/utils.h"
+#include "src/zone.h"
 
 // AstString, AstValue and AstValueFactory are for storing strings and values
 // independent of the V8 heap and internalizing them later. During parsing,
@@ -61,6 +62,8 @@ class AstString : public ZoneObject {
   AstString* next() const { return next_; }
 
  protected:
+  friend class AstStringConstants;
+
   // Handle<String>::null() until internalized.
   Handle<String> string_;
   AstString* next_;
@@ -107,6 +110,7 @@ class AstRawString final : public AstString {
  private:
   friend class AstValueFactory;
   friend class AstRawStringInternalizationKey;
+  friend class AstStringConstants;
 
   AstRawString(bool is_one_byte, const Vector<const byte>& literal_bytes,
                uint32_t hash)
@@ -320,9 +324,38 @@ class AstValue : public ZoneObject {
   F(undefined_value)       \
   F(the_hole_value)
 
+// The common AstRawStrings (keywords and well-known identifiers), created
+// once per isolate in a zone that lives as long as the isolate and
+// internalized up front. AstValueFactories seed their string tables with
+// this table, so repeated parses neither re-copy nor re-internalize these
+// strings.
+class AstStringConstants final {
+ public:
+  AstStringConstants(Isolate* isolate, uint32_t hash_seed);
+
+#define F(name, str) \
+  const AstRawString* name##_string() const { return name##_string_; }
+  STRING_CONSTANTS(F)
+#undef F
+
+  uint32_t hash_seed() const { return hash_seed_; }
+
+ private:
+  Zone zone_;
+  uint32_t hash_seed_;
+
+#define F(name, str) AstRawString* name##_string_;
+  STRING_CONSTANTS(F)
+#undef F
+
+  DISALLOW_COPY_AND_ASSIGN(AstStringConstants);
+};
+
+
 class AstValueFactory {
  public:
-  AstValueFactory(Zone* zone, uint32_t hash_seed)
+  AstValueFactory(Zone* zone, const AstStringConstants* string_constants,
+                  uint32_t hash_seed)
       : string_table_(AstRawStringCompare),
         values_(nullptr),
         strings_end_(&strings_),
@@ -330,12 +363,24 @@ class AstValueFactory {
         isolate_(NULL),
         hash_seed_(hash_seed) {
     ResetStrings();
-#define F(name, str) name##_string_ = NULL;
-    STRING_CONSTANTS(F)
-#undef F
 #define F(name) name##_ = NULL;
     OTHER_CONSTANTS(F)
 #undef F
+    if (string_constants != nullptr) {
+      DCHECK_EQ(hash_seed, string_constants->hash_seed());
+#define F(name, str)                                                 \
+  name##_string_ = string_constants->name##_string();                \
+  string_table_                                                      \
+      .LookupOrInsert(const_cast<AstRawString*>(name##_string_),     \
+                      name##_string_->hash())                        \
+      ->value = reinterpret_cast<void*>(1);
+      STRING_CONSTANTS(F)
+#undef F
+    } else {
+#define F(name, str) name##_string_ = NULL;
+      STRING_CONSTANTS(F)
+#undef F
+    }
   }
 
   Zone* zone() const { return zone_; }
@@ -438,7 +483,8 @@ class AstValueFactory {
 }  // namespace internal
 }  // namespace v8
 
-#undef STRING_CONSTANTS
+// STRING_CONSTANTS is also needed by the AstStringConstants constructor in
+// the .cc file.
 #undef OTHER_CONSTANTS
 
 #endif  // V8_AST_AST_VALUE_FACTORY_H_
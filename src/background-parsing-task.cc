@@ -30,6 +30,7 @@ BackgroundParsingTask::BackgroundParsingTask(
   info->set_source_stream_encoding(source->encoding);
   info->set_hash_seed(isolate->heap()->HashSeed());
   info->set_global();
+  info->set_streamed_script();
   info->set_unicode_cache(&source_->unicode_cache);
   info->set_compile_options(options);
   // Parse eagerly with ignition since we will compile eagerly.
@@ -10,11 +10,44 @@
 #include <malloc.h>  // NOLINT
 #endif
 
+#include "src/base/logging.h"
+
 namespace v8 {
 namespace base {
 
+AccountingAllocator::AccountingAllocator()
+    : max_pooled_segments_per_bucket_(kDefaultMaxPooledSegmentsPerBucket) {
+  for (int i = 0; i < kNumberOfBuckets; i++) {
+    pool_[i] = nullptr;
+    pool_counts_[i] = 0;
+  }
+}
+
+AccountingAllocator::~AccountingAllocator() { DropPooledSegments(); }
+
+// static
+int AccountingAllocator::BucketFor(size_t bytes) {
+  if (bytes > BucketSize(kNumberOfBuckets - 1)) return -1;
+  for (int i = 0; i < kNumberOfBuckets; i++) {
+    if (bytes <= BucketSize(i)) return i;
+  }
+  UNREACHABLE();
+  return -1;
+}
+
 void* AccountingAllocator::Allocate(size_t bytes) {
-  void* memory = malloc(bytes);
+  void* memory = nullptr;
+  int bucket = BucketFor(bytes);
+  if (bucket >= 0) {
+    // Poolable sizes are rounded up to the bucket size, so that the segment
+    // can be recycled for any request of the same bucket. Free() performs
+    // the same rounding, keeping the accounting symmetric.
+    bytes = BucketSize(bucket);
+    memory = AllocateFromPool(bucket);
+  }
+  if (memory == nullptr) {
+    memory = malloc(bytes);
+  }
   if (memory) {
     AtomicWord current =
         NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
@@ -27,11 +60,63 @@ void* AccountingAllocator::Allocate(size_t bytes) {
 }
 
 void AccountingAllocator::Free(void* memory, size_t bytes) {
-  free(memory);
+  int bucket = BucketFor(bytes);
+  if (bucket >= 0) {
+    bytes = BucketSize(bucket);
+    if (!ReturnToPool(bucket, memory)) {
+      free(memory);
+    }
+  } else {
+    free(memory);
+  }
   NoBarrier_AtomicIncrement(&current_memory_usage_,
                             -static_cast<AtomicWord>(bytes));
 }
 
+void* AccountingAllocator::AllocateFromPool(int bucket) {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  PooledSegment* segment = pool_[bucket];
+  if (segment == nullptr) return nullptr;
+  pool_[bucket] = segment->next;
+  pool_counts_[bucket]--;
+  return segment;
+}
+
+bool AccountingAllocator::ReturnToPool(int bucket, void* memory) {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  if (pool_counts_[bucket] >= max_pooled_segments_per_bucket_) return false;
+  PooledSegment* segment = static_cast<PooledSegment*>(memory);
+  segment->next = pool_[bucket];
+  pool_[bucket] = segment;
+  pool_counts_[bucket]++;
+  return true;
+}
+
+void AccountingAllocator::ConfigureSegmentPool(
+    size_t max_segments_per_bucket) {
+  {
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    max_pooled_segments_per_bucket_ = max_segments_per_bucket;
+  }
+  if (max_segments_per_bucket == 0) {
+    DropPooledSegments();
+  }
+}
+
+void AccountingAllocator::DropPooledSegments() {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  for (int i = 0; i < kNumberOfBuckets; i++) {
+    PooledSegment* segment = pool_[i];
+    while (segment != nullptr) {
+      PooledSegment* next = segment->next;
+      free(segment);
+      segment = next;
+    }
+    pool_[i] = nullptr;
+    pool_counts_[i] = 0;
+  }
+}
+
 size_t AccountingAllocator::GetCurrentMemoryUsage() const {
   return NoBarrier_Load(&current_memory_usage_);
 }
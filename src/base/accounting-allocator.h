@@ -7,14 +7,15 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace base {
 
 class AccountingAllocator {
  public:
-  AccountingAllocator() = default;
-  virtual ~AccountingAllocator() = default;
+  AccountingAllocator();
+  virtual ~AccountingAllocator();
 
   // Returns nullptr on failed allocation.
   virtual void* Allocate(size_t bytes);
@@ -23,10 +24,48 @@ class AccountingAllocator {
   size_t GetCurrentMemoryUsage() const;
   size_t GetMaxMemoryUsage() const;
 
+  // Sets the maximum number of segments kept per pool bucket. Setting the
+  // limit to zero disables pooling. Existing surplus segments are dropped.
+  void ConfigureSegmentPool(size_t max_segments_per_bucket);
+
+  // Empties the segment pool, returning the pooled memory to the OS.
+  void DropPooledSegments();
+
  private:
+  // Allocations with sizes in (kMinPooledSegmentSize / 2,
+  // kMaxPooledSegmentSize] are rounded up to the next power of two and
+  // recycled through a pool of free segments instead of being returned to
+  // the OS immediately. Zone segment sizes fall into this range.
+  static const size_t kMinPooledSegmentSizeLog2 = 13;  // 8K
+  static const size_t kMaxPooledSegmentSizeLog2 = 18;  // 256K
+  static const int kNumberOfBuckets =
+      static_cast<int>(kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2) +
+      1;
+  static const size_t kDefaultMaxPooledSegmentsPerBucket = 8;
+
+  // Pooled segments are chained through their first word.
+  struct PooledSegment {
+    PooledSegment* next;
+  };
+
+  // Returns the pool bucket index for the given size, or -1 if the size is
+  // not poolable.
+  static int BucketFor(size_t bytes);
+  static size_t BucketSize(int bucket) {
+    return static_cast<size_t>(1) << (kMinPooledSegmentSizeLog2 + bucket);
+  }
+
+  void* AllocateFromPool(int bucket);
+  bool ReturnToPool(int bucket, void* memory);
+
   AtomicWord current_memory_usage_ = 0;
   AtomicWord max_memory_usage_ = 0;
 
+  Mutex pool_mutex_;
+  PooledSegment* pool_[kNumberOfBuckets];
+  size_t pool_counts_[kNumberOfBuckets];
+  size_t max_pooled_segments_per_bucket_;
+
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
 
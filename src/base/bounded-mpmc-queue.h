@@ -0,0 +1,119 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_BOUNDED_MPMC_QUEUE_H_
+#define V8_BASE_BOUNDED_MPMC_QUEUE_H_
+
+#include <stddef.h>
+
+#include "src/base/atomicops.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace base {
+
+// Fixed-capacity lock-free FIFO queue for multiple producers and multiple
+// consumers, implemented after Dmitry Vyukov's bounded MPMC queue. Each cell
+// carries a sequence number that encodes whether the cell is ready for the
+// enqueuer or dequeuer whose cursor maps to it, so producers and consumers
+// only contend on their own cursor. Enqueue and Dequeue never block; they
+// fail when the queue is full respectively empty, and the caller decides how
+// to back off. |kCapacity| must be a power of two. Elements must be small
+// trivially copyable values, e.g. pointers.
+template <typename T, size_t kCapacity>
+class BoundedMpmcQueue {
+ public:
+  BoundedMpmcQueue() {
+    STATIC_ASSERT((kCapacity & (kCapacity - 1)) == 0);
+    NoBarrier_Store(&enqueue_pos_, 0);
+    NoBarrier_Store(&dequeue_pos_, 0);
+    for (size_t i = 0; i < kCapacity; i++) {
+      NoBarrier_Store(&cells_[i].sequence, static_cast<AtomicWord>(i));
+    }
+  }
+
+  // Attempts to append |value| to the queue. Returns false if the queue is
+  // full.
+  bool Enqueue(T value) {
+    Cell* cell;
+    AtomicWord pos = NoBarrier_Load(&enqueue_pos_);
+    for (;;) {
+      cell = &cells_[pos & kMask];
+      AtomicWord seq = Acquire_Load(&cell->sequence);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (NoBarrier_CompareAndSwap(&enqueue_pos_, pos, pos + 1) == pos) {
+          break;
+        }
+        pos = NoBarrier_Load(&enqueue_pos_);
+      } else if (diff < 0) {
+        // The cell still holds an element from the previous lap: full.
+        return false;
+      } else {
+        pos = NoBarrier_Load(&enqueue_pos_);
+      }
+    }
+    cell->value = value;
+    Release_Store(&cell->sequence, pos + 1);
+    return true;
+  }
+
+  // Attempts to remove the oldest element from the queue and store it in
+  // |*value|. Returns false if the queue is empty.
+  bool Dequeue(T* value) {
+    Cell* cell;
+    AtomicWord pos = NoBarrier_Load(&dequeue_pos_);
+    for (;;) {
+      cell = &cells_[pos & kMask];
+      AtomicWord seq = Acquire_Load(&cell->sequence);
+      intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (NoBarrier_CompareAndSwap(&dequeue_pos_, pos, pos + 1) == pos) {
+          break;
+        }
+        pos = NoBarrier_Load(&dequeue_pos_);
+      } else if (diff < 0) {
+        // The cell has not been filled for this lap yet: empty.
+        return false;
+      } else {
+        pos = NoBarrier_Load(&dequeue_pos_);
+      }
+    }
+    *value = cell->value;
+    Release_Store(&cell->sequence, pos + static_cast<AtomicWord>(kCapacity));
+    return true;
+  }
+
+  // The result is only a snapshot when producers or consumers are active.
+  bool IsEmpty() {
+    return NoBarrier_Load(&dequeue_pos_) >= NoBarrier_Load(&enqueue_pos_);
+  }
+
+ private:
+  static const size_t kMask = kCapacity - 1;
+  // Padding keeps the two cursors and the cell array on distinct cache
+  // lines, so producers and consumers do not invalidate each other's lines.
+  static const size_t kPaddingSize = 64;
+
+  struct Cell {
+    AtomicWord sequence;
+    T value;
+  };
+
+  char padding0_[kPaddingSize];
+  Cell cells_[kCapacity];
+  char padding1_[kPaddingSize];
+  AtomicWord enqueue_pos_;
+  char padding2_[kPaddingSize];
+  AtomicWord dequeue_pos_;
+  char padding3_[kPaddingSize];
+
+  DISALLOW_COPY_AND_ASSIGN(BoundedMpmcQueue);
+};
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_BOUNDED_MPMC_QUEUE_H_
@@ -5,6 +5,10 @@
 // The reason we write our own hash map instead of using unordered_map in STL,
 // is that STL containers use a mutex pool on debug build, which will lead to
 // deadlock when we are using async signal handler.
+//
+// The map is laid out as a flat open-addressing table: a single power-of-two
+// sized array of (key, value, hash) entries probed linearly, so lookups scan
+// adjacent cache lines instead of chasing per-entry heap nodes.
 
 #ifndef V8_BASE_HASHMAP_H_
 #define V8_BASE_HASHMAP_H_
@@ -101,6 +105,8 @@ class TemplateHashMapImpl {
 
   Entry* map_end() const { return map_ + capacity_; }
   Entry* Probe(void* key, uint32_t hash) const;
+  Entry* FillEmptyEntry(Entry* entry, void* key, uint32_t hash,
+                        AllocationPolicy allocator);
   void Initialize(uint32_t capacity, AllocationPolicy allocator);
   void Resize(AllocationPolicy allocator);
 };
@@ -130,36 +136,24 @@ template <class AllocationPolicy>
 typename TemplateHashMapImpl<AllocationPolicy>::Entry*
 TemplateHashMapImpl<AllocationPolicy>::LookupOrInsert(
     void* key, uint32_t hash, AllocationPolicy allocator) {
-  // Find a matching entry.
+  // Find a matching entry. On a miss, Probe already leaves p at the empty
+  // entry where the key belongs, so it can be filled in directly instead of
+  // probing a second time.
   Entry* p = Probe(key, hash);
   if (p->key != NULL) {
     return p;
   }
 
-  return InsertNew(key, hash, allocator);
+  return FillEmptyEntry(p, key, hash, allocator);
 }
 
 template <class AllocationPolicy>
 typename TemplateHashMapImpl<AllocationPolicy>::Entry*
 TemplateHashMapImpl<AllocationPolicy>::InsertNew(void* key, uint32_t hash,
                                                  AllocationPolicy allocator) {
-  // Find a matching entry.
   Entry* p = Probe(key, hash);
   DCHECK(p->key == NULL);
-
-  // No entry found; insert one.
-  p->key = key;
-  p->value = NULL;
-  p->hash = hash;
-  occupancy_++;
-
-  // Grow the map if we reached >= 80% occupancy.
-  if (occupancy_ + occupancy_ / 4 >= capacity_) {
-    Resize(allocator);
-    p = Probe(key, hash);
-  }
-
-  return p;
+  return FillEmptyEntry(p, key, hash, allocator);
 }
 
 template <class AllocationPolicy>
@@ -272,6 +266,26 @@ TemplateHashMapImpl<AllocationPolicy>::Probe(void* key, uint32_t hash) const {
   return p;
 }
 
+template <class AllocationPolicy>
+typename TemplateHashMapImpl<AllocationPolicy>::Entry*
+TemplateHashMapImpl<AllocationPolicy>::FillEmptyEntry(
+    Entry* entry, void* key, uint32_t hash, AllocationPolicy allocator) {
+  DCHECK(entry->key == NULL);
+
+  entry->key = key;
+  entry->value = NULL;
+  entry->hash = hash;
+  occupancy_++;
+
+  // Grow the map if we reached >= 80% occupancy.
+  if (occupancy_ + occupancy_ / 4 >= capacity_) {
+    Resize(allocator);
+    entry = Probe(key, hash);
+  }
+
+  return entry;
+}
+
 template <class AllocationPolicy>
 void TemplateHashMapImpl<AllocationPolicy>::Initialize(
     uint32_t capacity, AllocationPolicy allocator) {
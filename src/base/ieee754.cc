@@ -2741,6 +2741,26 @@ double tanh(double x) {
   return (jx >= 0) ? z : -z;
 }
 
+void exp(const double* input, double* output, size_t length) {
+  for (size_t i = 0; i < length; i++) output[i] = exp(input[i]);
+}
+
+void log(const double* input, double* output, size_t length) {
+  for (size_t i = 0; i < length; i++) output[i] = log(input[i]);
+}
+
+void sin(const double* input, double* output, size_t length) {
+  for (size_t i = 0; i < length; i++) output[i] = sin(input[i]);
+}
+
+void cos(const double* input, double* output, size_t length) {
+  for (size_t i = 0; i < length; i++) output[i] = cos(input[i]);
+}
+
+void tan(const double* input, double* output, size_t length) {
+  for (size_t i = 0; i < length; i++) output[i] = tan(input[i]);
+}
+
 }  // namespace ieee754
 }  // namespace base
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_BASE_IEEE754_H_
 #define V8_BASE_IEEE754_H_
 
+#include <stddef.h>
+
 namespace v8 {
 namespace base {
 namespace ieee754 {
@@ -73,6 +75,17 @@ double sinh(double x);
 // Returns the hyperbolic tangent of |x|, where |x| is given radians.
 double tanh(double x);
 
+// Batch variants of the kernels above: store f(input[i]) into output[i] for
+// 0 <= i < length. Input and output may alias. Keeping the loop in the same
+// translation unit as the kernel amortizes the per-call overhead of mapping
+// a kernel over an array and gives the compiler a straight-line loop to
+// pipeline.
+void exp(const double* input, double* output, size_t length);
+void log(const double* input, double* output, size_t length);
+void sin(const double* input, double* output, size_t length);
+void cos(const double* input, double* output, size_t length);
+void tan(const double* input, double* output, size_t length);
+
 }  // namespace ieee754
 }  // namespace base
 }  // namespace v8
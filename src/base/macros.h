@@ -167,6 +167,15 @@ V8_INLINE Dest bit_cast(Source const& source) {
 #endif
 
 
+// Hint to the CPU to fetch the cache line containing |address| ahead of a
+// read. Expands to nothing on toolchains without a prefetch intrinsic.
+#if V8_CC_GNU
+#define V8_PREFETCH_FOR_READ(address) __builtin_prefetch((address), 0, 3)
+#else
+#define V8_PREFETCH_FOR_READ(address) ((void)(address))
+#endif
+
+
 // TODO(all) Replace all uses of this macro with static_assert, remove macro.
 #define STATIC_ASSERT(test) static_assert(test, #test)
 
@@ -6,6 +6,8 @@
 
 #include <errno.h>
 
+#include "src/base/platform/condition-variable.h"
+
 namespace v8 {
 namespace base {
 
@@ -188,5 +190,56 @@ bool RecursiveMutex::TryLock() {
   return true;
 }
 
+
+AdaptiveMutex::AdaptiveMutex()
+    : state_(kUnlocked),
+      num_parked_(0),
+      contended_acquires_(0),
+      cv_(new ConditionVariable()) {}
+
+
+AdaptiveMutex::~AdaptiveMutex() {
+  DCHECK_EQ(kUnlocked, NoBarrier_Load(&state_));
+  delete cv_;
+}
+
+
+bool AdaptiveMutex::TryLock() {
+  return Acquire_CompareAndSwap(&state_, kUnlocked, kLocked) == kUnlocked;
+}
+
+
+void AdaptiveMutex::LockSlow() {
+  Barrier_AtomicIncrement(&contended_acquires_, 1);
+  // Spin briefly before parking: short critical sections usually release the
+  // lock within this window, avoiding the blocking path entirely. Only retry
+  // the compare-and-swap when the lock looks free, so that spinners do not
+  // keep the cache line in exclusive state.
+  for (int i = 0; i < kMaxSpinIterations; i++) {
+    if (NoBarrier_Load(&state_) == kUnlocked &&
+        Acquire_CompareAndSwap(&state_, kUnlocked, kLocked) == kUnlocked) {
+      return;
+    }
+  }
+  // Park on the native mutex until the lock can be taken. The parked counter
+  // is maintained under the native mutex, which serializes with WakeParked.
+  LockGuard<Mutex> guard(&native_mutex_);
+  Barrier_AtomicIncrement(&num_parked_, 1);
+  while (Acquire_CompareAndSwap(&state_, kUnlocked, kLocked) != kUnlocked) {
+    cv_->Wait(&native_mutex_);
+  }
+  Barrier_AtomicIncrement(&num_parked_, -1);
+}
+
+
+void AdaptiveMutex::WakeParked() {
+  // Taking the native mutex serializes with parking threads: any thread that
+  // incremented num_parked_ either already waits on the condition variable
+  // (and is notified below) or still holds the native mutex and will
+  // re-check the lock state before waiting.
+  LockGuard<Mutex> guard(&native_mutex_);
+  cv_->NotifyOne();
+}
+
 }  // namespace base
 }  // namespace v8
@@ -119,6 +119,17 @@ void OS::ProtectCode(void* address, const size_t size) {
 }
 
 
+// Give code allocations their writable permission back for patching.
+void OS::UnprotectCode(void* address, const size_t size) {
+#if V8_OS_CYGWIN
+  DWORD old_protect;
+  VirtualProtect(address, size, PAGE_EXECUTE_READWRITE, &old_protect);
+#else
+  mprotect(address, size, PROT_READ | PROT_WRITE | PROT_EXEC);
+#endif
+}
+
+
 // Create guard pages.
 void OS::Guard(void* address, const size_t size) {
 #if V8_OS_CYGWIN
@@ -220,6 +231,68 @@ size_t OS::AllocateAlignment() {
 }
 
 
+bool OS::BindMemoryToNode(void* address, size_t size, int node) {
+#if V8_OS_LINUX && defined(__NR_mbind)
+  // From linux/mempolicy.h, which not all toolchains ship.
+  const int kMpolBind = 2;
+  if (node < 0 || node >= static_cast<int>(sizeof(unsigned long) * 8)) {
+    return false;
+  }
+  unsigned long nodemask = 1UL << node;  // NOLINT(runtime/int)
+  return syscall(__NR_mbind, address, size, kMpolBind, &nodemask,
+                 sizeof(nodemask) * 8, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+
+bool OS::BindCurrentThreadToNode(int node) {
+#if V8_OS_LINUX && defined(__NR_sched_setaffinity)
+  if (node < 0) return false;
+  char path[128];
+  SNPrintF(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+           node);
+  FILE* file = fopen(path, "r");
+  if (file == NULL) return false;
+  // The cpulist file contains comma-separated ranges, e.g. "0-7,16-23".
+  const size_t kMaxCpus = 1024;
+  unsigned long mask[kMaxCpus / (sizeof(unsigned long) * 8)] = {0};  // NOLINT
+  const size_t kBitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+  bool found_cpu = false;
+  int low;
+  while (fscanf(file, "%d", &low) == 1) {
+    int high = low;
+    int separator = fgetc(file);
+    if (separator == '-') {
+      if (fscanf(file, "%d", &high) != 1) break;
+      separator = fgetc(file);
+    }
+    for (int cpu = low; cpu <= high && cpu < static_cast<int>(kMaxCpus);
+         cpu++) {
+      mask[cpu / kBitsPerWord] |= 1UL << (cpu % kBitsPerWord);
+      found_cpu = true;
+    }
+    if (separator != ',') break;
+  }
+  fclose(file);
+  if (!found_cpu) return false;
+  return syscall(__NR_sched_setaffinity, 0, sizeof(mask), mask) == 0;
+#else
+  return false;
+#endif
+}
+
+
 void OS::Sleep(TimeDelta interval) {
   usleep(static_cast<useconds_t>(interval.InMicroseconds()));
 }
@@ -274,14 +347,21 @@ class PosixMemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
-  if (FILE* file = fopen(name, "r+")) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
+  const char* fopen_mode = (mode == FileMode::kReadOnly) ? "r" : "r+";
+  if (FILE* file = fopen(name, fopen_mode)) {
     if (fseek(file, 0, SEEK_END) == 0) {
       long size = ftell(file);  // NOLINT(runtime/int)
       if (size >= 0) {
-        void* const memory =
-            mmap(OS::GetRandomMmapAddr(), size, PROT_READ | PROT_WRITE,
-                 MAP_SHARED, fileno(file), 0);
+        int prot = PROT_READ;
+        int flags = MAP_PRIVATE;
+        if (mode == FileMode::kReadWrite) {
+          prot |= PROT_WRITE;
+          flags = MAP_SHARED;
+        }
+        void* const memory = mmap(OS::GetRandomMmapAddr(), size, prot, flags,
+                                  fileno(file), 0);
         if (memory != MAP_FAILED) {
           return new PosixMemoryMappedFile(file, memory, size);
         }
@@ -713,6 +713,24 @@ size_t OS::AllocateAlignment() {
 }
 
 
+bool OS::BindMemoryToNode(void* address, size_t size, int node) {
+  // NUMA binding is not implemented on Windows.
+  return false;
+}
+
+
+bool OS::BindCurrentThreadToNode(int node) {
+  // NUMA binding is not implemented on Windows.
+  return false;
+}
+
+
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Transparent huge pages are not available on Windows.
+  return false;
+}
+
+
 static LazyInstance<RandomNumberGenerator>::type
     platform_random_number_generator = LAZY_INSTANCE_INITIALIZER;
 
@@ -816,6 +834,12 @@ void OS::ProtectCode(void* address, const size_t size) {
 }
 
 
+void OS::UnprotectCode(void* address, const size_t size) {
+  DWORD old_protect;
+  VirtualProtect(address, size, PAGE_EXECUTE_READWRITE, &old_protect);
+}
+
+
 void OS::Guard(void* address, const size_t size) {
   DWORD oldprotect;
   VirtualProtect(address, size, PAGE_NOACCESS, &oldprotect);
@@ -872,21 +896,29 @@ class Win32MemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
   // Open a physical file
-  HANDLE file = CreateFileA(name, GENERIC_READ | GENERIC_WRITE,
+  DWORD access = GENERIC_READ;
+  if (mode == FileMode::kReadWrite) access |= GENERIC_WRITE;
+  HANDLE file = CreateFileA(name, access,
       FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
   if (file == INVALID_HANDLE_VALUE) return NULL;
 
   DWORD size = GetFileSize(file, NULL);
 
   // Create a file mapping for the physical file
-  HANDLE file_mapping =
-      CreateFileMapping(file, NULL, PAGE_READWRITE, 0, size, NULL);
+  HANDLE file_mapping = CreateFileMapping(
+      file, NULL,
+      mode == FileMode::kReadOnly ? PAGE_READONLY : PAGE_READWRITE, 0, size,
+      NULL);
   if (file_mapping == NULL) return NULL;
 
   // Map a view of the file into memory
-  void* memory = MapViewOfFile(file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  void* memory = MapViewOfFile(
+      file_mapping,
+      mode == FileMode::kReadOnly ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0,
+      size);
   return new Win32MemoryMappedFile(file, file_mapping, memory, size);
 }
 
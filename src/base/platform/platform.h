@@ -184,6 +184,9 @@ class OS {
   // Mark code segments non-writable.
   static void ProtectCode(void* address, const size_t size);
 
+  // Make code segments writable again for patching.
+  static void UnprotectCode(void* address, const size_t size);
+
   // Assign memory as a guard page so that access will cause an exception.
   static void Guard(void* address, const size_t size);
 
@@ -193,6 +196,23 @@ class OS {
   // Get the Alignment guaranteed by Allocate().
   static size_t AllocateAlignment();
 
+  // Bind the pages of the given region to the given NUMA memory node, so
+  // that their physical memory is allocated node-locally. The region may
+  // still be uncommitted; the policy applies as pages are faulted in.
+  // Returns false if the platform has no NUMA support or binding fails.
+  static bool BindMemoryToNode(void* address, size_t size, int node);
+
+  // Restrict the calling thread to the processors of the given NUMA node.
+  // Returns false if the platform has no NUMA support or the node has no
+  // processors.
+  static bool BindCurrentThreadToNode(int node);
+
+  // Advise the kernel to back the given region with transparent huge pages
+  // to reduce TLB pressure. Best effort: the kernel may collapse the pages
+  // at its leisure or not at all. Returns false if the platform has no
+  // huge page support.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -213,11 +233,16 @@ class OS {
 
   class MemoryMappedFile {
    public:
+    enum class FileMode { kReadOnly, kReadWrite };
+
     virtual ~MemoryMappedFile() {}
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
-    static MemoryMappedFile* open(const char* name);
+    // Read-only mappings are private, so a stray write through the mapping
+    // cannot reach the file, and work for files that are not writable.
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
                                     void* initial);
   };
@@ -601,6 +601,12 @@ bool TimeTicks::IsHighResolutionClockWorking() {
   return high_res_tick_clock.Pointer()->IsHighResolution();
 }
 
+
+TimeTicks TimeTicks::CoarseNow() {
+  // The rollover-protected low-resolution tick clock is already cheap.
+  return Now();
+}
+
 #else  // V8_OS_WIN
 
 TimeTicks TimeTicks::Now() {
@@ -634,6 +640,21 @@ bool TimeTicks::IsHighResolutionClockWorking() {
   return true;
 }
 
+
+TimeTicks TimeTicks::CoarseNow() {
+#if V8_OS_LINUX && defined(CLOCK_MONOTONIC_COARSE)
+  // CLOCK_MONOTONIC_COARSE reads a value that the kernel updates on every
+  // scheduler tick, so it costs a cached load instead of a TSC read plus
+  // scaling. It shares the CLOCK_MONOTONIC epoch but lags it by up to one
+  // tick.
+  int64_t ticks = ClockNow(CLOCK_MONOTONIC_COARSE);
+  // Make sure we never return 0 here.
+  return TimeTicks(ticks + 1);
+#else
+  return Now();
+#endif  // V8_OS_LINUX && defined(CLOCK_MONOTONIC_COARSE)
+}
+
 #endif  // V8_OS_WIN
 
 
@@ -356,6 +356,15 @@ class TimeTicks final : public time_internal::TimeBase<TimeTicks> {
   // This method never returns a null TimeTicks.
   static TimeTicks HighResolutionNow();
 
+  // Returns a coarse tick count that is considerably cheaper to read than
+  // Now() on platforms with a cached kernel clock, at the price of
+  // millisecond granularity (one scheduler tick). Intended for consumers
+  // that sample time frequently but tolerate millisecond resolution. Falls
+  // back to Now() where no cheap coarse clock is available. May lag Now()
+  // by up to one scheduler tick, but is monotonic and never returns a null
+  // TimeTicks.
+  static TimeTicks CoarseNow();
+
   // Returns true if the high-resolution clock is working on this system.
   static bool IsHighResolutionClockWorking();
 
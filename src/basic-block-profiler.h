@@ -21,6 +21,8 @@ class BasicBlockProfiler {
    public:
     size_t n_blocks() const { return n_blocks_; }
     const uint32_t* counts() const { return &counts_[0]; }
+    size_t block_id(size_t offset) const { return block_ids_[offset]; }
+    const std::string& function_name() const { return function_name_; }
 
     void SetCode(std::ostringstream* os);
     void SetFunctionName(std::ostringstream* os);
@@ -13,6 +13,7 @@
 #include "src/extensions/free-buffer-extension.h"
 #include "src/extensions/gc-extension.h"
 #include "src/extensions/ignition-statistics-extension.h"
+#include "src/extensions/regexp-flat-exec-extension.h"
 #include "src/extensions/statistics-extension.h"
 #include "src/extensions/trigger-failure-extension.h"
 #include "src/heap/heap.h"
@@ -75,6 +76,7 @@ v8::Extension* Bootstrapper::externalize_string_extension_ = NULL;
 v8::Extension* Bootstrapper::statistics_extension_ = NULL;
 v8::Extension* Bootstrapper::trigger_failure_extension_ = NULL;
 v8::Extension* Bootstrapper::ignition_statistics_extension_ = NULL;
+v8::Extension* Bootstrapper::regexp_flat_exec_extension_ = NULL;
 
 void Bootstrapper::InitializeOncePerProcess() {
   free_buffer_extension_ = new FreeBufferExtension;
@@ -89,6 +91,8 @@ void Bootstrapper::InitializeOncePerProcess() {
   v8::RegisterExtension(trigger_failure_extension_);
   ignition_statistics_extension_ = new IgnitionStatisticsExtension;
   v8::RegisterExtension(ignition_statistics_extension_);
+  regexp_flat_exec_extension_ = new RegExpFlatExecExtension;
+  v8::RegisterExtension(regexp_flat_exec_extension_);
 }
 
 
@@ -105,6 +109,8 @@ void Bootstrapper::TearDownExtensions() {
   trigger_failure_extension_ = NULL;
   delete ignition_statistics_extension_;
   ignition_statistics_extension_ = NULL;
+  delete regexp_flat_exec_extension_;
+  regexp_flat_exec_extension_ = NULL;
 }
 
 
@@ -3350,6 +3356,8 @@ bool Genesis::InstallExperimentalNatives() {
   static const char* harmony_regexp_property_natives[] = {nullptr};
   static const char* harmony_function_sent_natives[] = {nullptr};
   static const char* intl_extra_natives[] = {"native intl-extra.js", nullptr};
+  static const char* experimental_array_pipeline_natives[] = {
+      "native array-pipeline.js", nullptr};
   static const char* harmony_object_values_entries_natives[] = {nullptr};
   static const char* harmony_object_own_property_descriptors_natives[] = {
       nullptr};
@@ -3383,6 +3391,7 @@ bool Genesis::InstallExperimentalNatives() {
     HARMONY_STAGED(INSTALL_EXPERIMENTAL_NATIVES);
     HARMONY_SHIPPING(INSTALL_EXPERIMENTAL_NATIVES);
     INSTALL_EXPERIMENTAL_NATIVES(intl_extra, "");
+    INSTALL_EXPERIMENTAL_NATIVES(experimental_array_pipeline, "");
 #undef INSTALL_EXPERIMENTAL_NATIVES
   }
 
@@ -3585,6 +3594,9 @@ bool Genesis::InstallExtensions(Handle<Context> native_context,
          (!(FLAG_ignition && FLAG_trace_ignition_dispatches) ||
           InstallExtension(isolate, "v8/ignition-statistics",
                            &extension_states)) &&
+         (!FLAG_expose_regexp_flat_exec ||
+          InstallExtension(isolate, "v8/regexp-flat-exec",
+                           &extension_states)) &&
          InstallRequestedExtensions(isolate, extensions, &extension_states);
 }
 
@@ -3974,9 +3986,10 @@ Genesis::Genesis(Isolate* isolate,
     if (!ConfigureGlobalObjects(global_proxy_template)) return;
 
     isolate->counters()->contexts_created_from_scratch()->Increment();
-    // Re-initialize the counter because it got incremented during snapshot
+    // Re-initialize the counters because they got incremented during snapshot
     // creation.
     isolate->native_context()->set_errors_thrown(Smi::FromInt(0));
+    isolate->native_context()->set_allocated_bytes(Smi::FromInt(0));
   }
 
   // Install experimental natives. Do not include them into the
@@ -141,6 +141,7 @@ class Bootstrapper final {
   static v8::Extension* statistics_extension_;
   static v8::Extension* trigger_failure_extension_;
   static v8::Extension* ignition_statistics_extension_;
+  static v8::Extension* regexp_flat_exec_extension_;
 
   DISALLOW_COPY_AND_ASSIGN(Bootstrapper);
 };
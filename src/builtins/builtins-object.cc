@@ -7,6 +7,7 @@
 
 #include "src/code-factory.h"
 #include "src/property-descriptor.h"
+#include "src/prototype.h"
 
 namespace v8 {
 namespace internal {
@@ -62,6 +63,88 @@ void Builtins::Generate_ObjectHasOwnProperty(CodeStubAssembler* assembler) {
 
 namespace {
 
+// Tries to turn |to| into a clone of |from| by reusing the source map:
+// |to| takes over the map of |from| and the property fields are copied in
+// bulk instead of being added one at a time. This is only unobservable when
+// the target is a freshly created empty object with the same prototype,
+// every source property is an enumerable data property, and none of the
+// copied keys can hit an accessor or a read-only property somewhere on the
+// shared prototype chain. Returns false if any of that does not hold; the
+// caller then copies property by property.
+bool TryAssignByCloning(Isolate* isolate, Handle<JSReceiver> to,
+                        Handle<JSObject> from, Handle<Map> from_map,
+                        Handle<DescriptorArray> descriptors, int length) {
+  if (length == 0) return false;
+  if (!to->IsJSObject()) return false;
+  Handle<JSObject> target = Handle<JSObject>::cast(to);
+  Map* to_map = target->map();
+  if (to_map->instance_type() != JS_OBJECT_TYPE) return false;
+  if (from_map->instance_type() != JS_OBJECT_TYPE) return false;
+  if (to_map->NumberOfOwnDescriptors() != 0) return false;
+  if (!to_map->OnlyHasSimpleProperties()) return false;
+  if (!to_map->is_extensible()) return false;
+  if (to_map->is_prototype_map()) return false;
+  if (to_map->prototype() != from_map->prototype()) return false;
+  if (to_map->instance_size() != from_map->instance_size()) return false;
+  if (from_map->is_deprecated()) return false;
+  if (target->elements() != isolate->heap()->empty_fixed_array()) return false;
+  if (target->properties() != isolate->heap()->empty_fixed_array()) {
+    return false;
+  }
+
+  // All source properties must be enumerable data properties. Double fields
+  // are boxed in mutable heap numbers that must not be shared between
+  // objects, so they disqualify the raw copy as well.
+  for (int i = 0; i < length; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (!details.IsEnumerable()) return false;
+    if (details.kind() != kData) return false;
+    if (details.location() == kField && details.representation().IsDouble()) {
+      return false;
+    }
+  }
+
+  // A store through Object.assign hits an accessor or fails on a read-only
+  // property found on the prototype chain instead of creating an own
+  // property. The chain is shared with the source, so scan it for keys that
+  // would divert one of the stores.
+  for (PrototypeIterator iter(to_map); !iter.IsAtEnd(); iter.Advance()) {
+    Object* current = iter.GetCurrent();
+    if (!current->IsJSObject()) return false;
+    Map* proto_map = JSObject::cast(current)->map();
+    if (!proto_map->OnlyHasSimpleProperties()) return false;
+    DescriptorArray* proto_descriptors = proto_map->instance_descriptors();
+    int proto_length = proto_map->NumberOfOwnDescriptors();
+    for (int i = 0; i < proto_length; i++) {
+      PropertyDetails details = proto_descriptors->GetDetails(i);
+      if (details.kind() == kData && !details.IsReadOnly()) continue;
+      if (descriptors->Search(proto_descriptors->GetKey(i), length) !=
+          DescriptorArray::kNotFound) {
+        return false;
+      }
+    }
+  }
+
+  // Clone: share the map, copy the out-of-object backing store and the
+  // in-object fields. Constant properties live in the shared descriptor
+  // array and need no per-instance storage.
+  Handle<FixedArray> properties(from->properties(), isolate);
+  if (properties->length() > 0) {
+    properties = isolate->factory()->CopyFixedArray(properties);
+  }
+  DisallowHeapAllocation no_gc;
+  target->set_properties(*properties);
+  target->synchronized_set_map(*from_map);
+  for (int i = 0; i < length; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.location() != kField) continue;
+    FieldIndex index = FieldIndex::ForDescriptor(*from_map, i);
+    if (!index.is_inobject()) continue;  // Copied with the backing store.
+    target->RawFastPropertyAtPut(index, from->RawFastPropertyAt(index));
+  }
+  return true;
+}
+
 MUST_USE_RESULT Maybe<bool> FastAssign(Handle<JSReceiver> to,
                                        Handle<Object> next_source) {
   // Non-empty strings are the only non-JSReceivers that need to be handled
@@ -93,6 +176,13 @@ MUST_USE_RESULT Maybe<bool> FastAssign(Handle<JSReceiver> to,
   Handle<DescriptorArray> descriptors(map->instance_descriptors(), isolate);
   int length = map->NumberOfOwnDescriptors();
 
+  // Middleware-style code clones objects into a fresh empty target on every
+  // hop; serve that shape with a map-reusing bulk copy when it cannot be
+  // observed.
+  if (TryAssignByCloning(isolate, to, from, map, descriptors, length)) {
+    return Just(true);
+  }
+
   bool stable = true;
 
   for (int i = 0; i < length; i++) {
@@ -111,6 +111,16 @@ Code* BuildWithCodeStubAssemblerCS(Isolate* isolate,
 }
 }  // anonymous namespace
 
+// TODO(builtins): Every isolate builds (or deserializes) its own copy of all
+// builtins into its code space; embedders running hundreds of isolates pay
+// for identical executable memory per isolate plus the icache pollution of
+// the duplicates. Sharing one read-only, position-independent builtins page
+// across isolates is blocked on three properties of the current code base:
+// builtin code objects embed isolate-specific absolute addresses (roots,
+// external references, embedded handles) at assembly time, they live in the
+// GC-managed code space and may move, and isolate-specific data access would
+// need a reserved root register scheme on all architectures. Each of those
+// has to change before builtin_address dispatch can target a shared mapping.
 void Builtins::SetUp(Isolate* isolate, bool create_heap_objects) {
   DCHECK(!initialized_);
 
@@ -598,6 +598,12 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ Assert(equal, kFunctionDataShouldBeBytecodeArrayOnInterpreterEntry);
   }
 
+  // Reset the bytecode age so that the bytecode is not flushed while the
+  // function is being executed.
+  __ mov_b(FieldOperand(kInterpreterBytecodeArrayRegister,
+                        BytecodeArray::kBytecodeAgeOffset),
+           Immediate(BytecodeArray::kNoAgeBytecodeAge));
+
   // Push bytecode array.
   __ push(kInterpreterBytecodeArrayRegister);
   // Push Smi tagged initial bytecode array offset.
@@ -620,17 +626,32 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ CallRuntime(Runtime::kThrowStackOverflow);
     __ bind(&ok);
 
-    // If ok, push undefined as the initial value for all register file entries.
-    Label loop_header;
-    Label loop_check;
+    // If ok, push undefined as the initial value for all register file
+    // entries. Peel off the remainder of dividing the register count by
+    // four, then initialize four registers per loop iteration to keep the
+    // loop overhead small; entry cost is hot for call-heavy interpreted
+    // code.
+    Label loop_header, loop_check, after_odd, after_pair;
     __ mov(eax, Immediate(masm->isolate()->factory()->undefined_value()));
+    __ test(ebx, Immediate(kPointerSize));
+    __ j(zero, &after_odd, Label::kNear);
+    __ push(eax);
+    __ bind(&after_odd);
+    __ test(ebx, Immediate(2 * kPointerSize));
+    __ j(zero, &after_pair, Label::kNear);
+    __ push(eax);
+    __ push(eax);
+    __ bind(&after_pair);
+    __ and_(ebx, Immediate(-4 * kPointerSize));
     __ jmp(&loop_check);
     __ bind(&loop_header);
-    // TODO(rmcilroy): Consider doing more than one push per loop iteration.
+    __ push(eax);
+    __ push(eax);
+    __ push(eax);
     __ push(eax);
     // Continue loop if not done.
     __ bind(&loop_check);
-    __ sub(ebx, Immediate(kPointerSize));
+    __ sub(ebx, Immediate(4 * kPointerSize));
     __ j(greater_equal, &loop_header);
   }
 
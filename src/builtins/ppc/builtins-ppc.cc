@@ -1094,6 +1094,12 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ Assert(eq, kFunctionDataShouldBeBytecodeArrayOnInterpreterEntry);
   }
 
+  // Reset the bytecode age so that the bytecode is not flushed while the
+  // function is being executed.
+  __ li(r8, Operand(BytecodeArray::kNoAgeBytecodeAge));
+  __ stb(r8, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                             BytecodeArray::kBytecodeAgeOffset));
+
   // Load initial bytecode offset.
   __ mov(kInterpreterBytecodeOffsetRegister,
          Operand(BytecodeArray::kHeaderSize - kHeapObjectTag));
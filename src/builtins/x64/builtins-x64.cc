@@ -680,6 +680,12 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ Assert(equal, kFunctionDataShouldBeBytecodeArrayOnInterpreterEntry);
   }
 
+  // Reset the bytecode age so that the bytecode is not flushed while the
+  // function is being executed.
+  __ movb(FieldOperand(kInterpreterBytecodeArrayRegister,
+                       BytecodeArray::kBytecodeAgeOffset),
+          Immediate(BytecodeArray::kNoAgeBytecodeAge));
+
   // Load initial bytecode offset.
   __ movp(kInterpreterBytecodeOffsetRegister,
           Immediate(BytecodeArray::kHeaderSize - kHeapObjectTag));
@@ -704,17 +710,32 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
     __ CallRuntime(Runtime::kThrowStackOverflow);
     __ bind(&ok);
 
-    // If ok, push undefined as the initial value for all register file entries.
-    Label loop_header;
-    Label loop_check;
+    // If ok, push undefined as the initial value for all register file
+    // entries. Peel off the remainder of dividing the register count by
+    // four, then initialize four registers per loop iteration to keep the
+    // loop overhead small; entry cost is hot for call-heavy interpreted
+    // code.
+    Label loop_header, loop_check, after_odd, after_pair;
     __ LoadRoot(rdx, Heap::kUndefinedValueRootIndex);
+    __ testl(rcx, Immediate(kPointerSize));
+    __ j(zero, &after_odd, Label::kNear);
+    __ Push(rdx);
+    __ bind(&after_odd);
+    __ testl(rcx, Immediate(2 * kPointerSize));
+    __ j(zero, &after_pair, Label::kNear);
+    __ Push(rdx);
+    __ Push(rdx);
+    __ bind(&after_pair);
+    __ andl(rcx, Immediate(-4 * kPointerSize));
     __ j(always, &loop_check);
     __ bind(&loop_header);
-    // TODO(rmcilroy): Consider doing more than one push per loop iteration.
+    __ Push(rdx);
+    __ Push(rdx);
+    __ Push(rdx);
     __ Push(rdx);
     // Continue loop if not done.
     __ bind(&loop_check);
-    __ subp(rcx, Immediate(kPointerSize));
+    __ subp(rcx, Immediate(4 * kPointerSize));
     __ j(greater_equal, &loop_header, Label::kNear);
   }
 
@@ -3305,14 +3305,25 @@ void CodeStubAssembler::HandlePolymorphicCase(
     Label* if_miss, int unroll_count) {
   DCHECK_EQ(MachineRepresentation::kTagged, var_handler->rep());
 
+  // Polymorphic feedback stores the maps as weak cells obtained from
+  // Map::WeakCellForMap, which canonicalizes cells through the map's weak
+  // cell cache. Comparing the receiver map's canonical cell against the
+  // cells in the feedback array therefore matches exactly the same entries
+  // as comparing the maps themselves, but without the dependent load of
+  // every cell's value: the probe loop only touches the contiguous feedback
+  // array. A map without a cached weak cell cannot have a feedback entry.
+  Node* receiver_cell =
+      LoadObjectField(receiver_map, Map::kWeakCellCacheOffset);
+  GotoIf(WordIsSmi(receiver_cell), if_miss);
+
   // Iterate {feedback} array.
   const int kEntrySize = 2;
 
   for (int i = 0; i < unroll_count; i++) {
     Label next_entry(this);
-    Node* cached_map = LoadWeakCellValue(
-        LoadFixedArrayElement(feedback, Int32Constant(i * kEntrySize)));
-    GotoIf(WordNotEqual(receiver_map, cached_map), &next_entry);
+    Node* cached_cell =
+        LoadFixedArrayElement(feedback, Int32Constant(i * kEntrySize));
+    GotoIf(WordNotEqual(receiver_cell, cached_cell), &next_entry);
 
     // Found, now call handler.
     Node* handler =
@@ -3334,11 +3345,10 @@ void CodeStubAssembler::HandlePolymorphicCase(
     Node* index = var_index.value();
     GotoIf(Int32GreaterThanOrEqual(index, length), if_miss);
 
-    Node* cached_map =
-        LoadWeakCellValue(LoadFixedArrayElement(feedback, index));
+    Node* cached_cell = LoadFixedArrayElement(feedback, index);
 
     Label next_entry(this);
-    GotoIf(WordNotEqual(receiver_map, cached_map), &next_entry);
+    GotoIf(WordNotEqual(receiver_cell, cached_cell), &next_entry);
 
     // Found, now call handler.
     Node* handler = LoadFixedArrayElement(feedback, index, kPointerSize);
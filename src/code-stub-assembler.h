@@ -569,6 +569,10 @@ class CodeStubAssembler : public compiler::CodeAssembler {
                                   FixedArray::kHeaderSize);
   }
 
+  compiler::Node* ElementOffsetFromIndex(compiler::Node* index,
+                                         ElementsKind kind, ParameterMode mode,
+                                         int base_size = 0);
+
  private:
   enum ElementSupport { kOnlyProperties, kSupportElements };
 
@@ -584,10 +588,6 @@ class CodeStubAssembler : public compiler::CodeAssembler {
                        Label* if_hole, Label* rebox_double,
                        Variable* var_double_value, Label* miss);
 
-  compiler::Node* ElementOffsetFromIndex(compiler::Node* index,
-                                         ElementsKind kind, ParameterMode mode,
-                                         int base_size = 0);
-
   compiler::Node* AllocateRawAligned(compiler::Node* size_in_bytes,
                                      AllocationFlags flags,
                                      compiler::Node* top_address,
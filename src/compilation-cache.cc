@@ -7,14 +7,21 @@
 #include "src/counters.h"
 #include "src/factory.h"
 #include "src/globals.h"
+#include "src/isolate-inl.h"
 #include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/snapshot/snapshot-source-sink.h"
 
 namespace v8 {
 namespace internal {
 
 
 // The number of generations for each sub cache.
-static const int kRegExpGenerations = 2;
+// RegExp entries hold the shared data array, including compiled irregexp
+// code, so keeping them across more full GCs means fresh contexts reuse
+// compiled regexps instead of recompiling them.
+static const int kRegExpGenerations = 4;
 
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
@@ -23,8 +30,9 @@ static const int kInitialCacheSize = 64;
 CompilationCache::CompilationCache(Isolate* isolate)
     : isolate_(isolate),
       script_(isolate, 1),
-      eval_global_(isolate, 1),
-      eval_contextual_(isolate, 1),
+      eval_global_(isolate, Max(1, FLAG_compilation_cache_eval_generations)),
+      eval_contextual_(isolate,
+                       Max(1, FLAG_compilation_cache_eval_generations)),
       reg_exp_(isolate, kRegExpGenerations),
       enabled_(true) {
   CompilationSubCache* subcaches[kSubCacheCount] =
@@ -363,6 +371,173 @@ void CompilationCache::PutRegExp(Handle<String> source,
 }
 
 
+// Guards ImportScriptData against data that was not produced by
+// ExportScriptData. The code serializer's own sanity checks cover version,
+// flag and CPU feature mismatches per entry.
+static const byte kExportedScriptDataTag[] = {'V', '8', 'S', 'C'};
+
+// How a string is stored in an exported script cache entry. The undefined
+// script name is stored as kAbsentString.
+enum SerializedStringEncoding {
+  kAbsentString = 0,
+  kOneByteString = 1,
+  kTwoByteString = 2
+};
+
+
+static void PutStringTo(SnapshotByteSink* sink, Handle<Object> object) {
+  if (!object->IsString()) {
+    sink->PutSection(kAbsentString, "encoding");
+    return;
+  }
+  Handle<String> string = String::Flatten(Handle<String>::cast(object));
+  int length = string->length();
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = string->GetFlatContent();
+  if (content.IsOneByte()) {
+    sink->PutSection(kOneByteString, "encoding");
+    sink->PutInt(length, "length");
+    sink->PutRaw(content.ToOneByteVector().start(), length, "chars");
+  } else {
+    sink->PutSection(kTwoByteString, "encoding");
+    sink->PutInt(length, "length");
+    sink->PutRaw(reinterpret_cast<const byte*>(content.ToUC16Vector().start()),
+                 length * kUC16Size, "chars");
+  }
+}
+
+
+static MaybeHandle<String> ReadStringFrom(Isolate* isolate,
+                                          SnapshotByteSource* source) {
+  int encoding = source->Get();
+  if (encoding == kAbsentString) return MaybeHandle<String>();
+  int length = source->GetInt();
+  if (encoding == kOneByteString) {
+    ScopedVector<uint8_t> chars(length);
+    source->CopyRaw(chars.start(), length);
+    return isolate->factory()->NewStringFromOneByte(
+        Vector<const uint8_t>(chars.start(), length));
+  }
+  DCHECK_EQ(kTwoByteString, encoding);
+  ScopedVector<uc16> chars(length);
+  source->CopyRaw(reinterpret_cast<byte*>(chars.start()), length * kUC16Size);
+  return isolate->factory()->NewStringFromTwoByte(
+      Vector<const uc16>(chars.start(), length));
+}
+
+
+// The code serializer only handles bytecode and full-codegen code compiled
+// with relocation info for serialization; anything else is left out of the
+// export.
+static bool CanSerializeForExport(SharedFunctionInfo* function_info) {
+  if (!function_info->is_compiled()) return false;
+  if (!function_info->script()->IsScript()) return false;
+  if (!Script::cast(function_info->script())->source()->IsString()) {
+    return false;
+  }
+  if (function_info->HasBytecodeArray()) return true;
+  Code* code = function_info->code();
+  return code->kind() == Code::FUNCTION &&
+         code->has_reloc_info_for_serialization();
+}
+
+
+ScriptData* CompilationCache::ExportScriptData() {
+  if (!IsEnabled()) return NULL;
+
+  HandleScope scope(isolate());
+  Handle<CompilationCacheTable> table = script_.GetFirstTable();
+  SnapshotByteSink entries;
+  int count = 0;
+  int capacity = table->Capacity();
+  for (int entry = 0; entry < capacity; entry++) {
+    HandleScope entry_scope(isolate());
+    Object* value = table->get(CompilationCacheTable::EntryToIndex(entry) + 1);
+    // Skip empty entries as well as the hash-only entries the table keeps
+    // until a script is put for the second time (see the class comment on
+    // CompilationCacheTable).
+    if (!value->IsSharedFunctionInfo()) continue;
+    if (!CanSerializeForExport(SharedFunctionInfo::cast(value))) continue;
+    Handle<SharedFunctionInfo> function_info(SharedFunctionInfo::cast(value),
+                                             isolate());
+    Handle<Script> script(Script::cast(function_info->script()), isolate());
+    Handle<String> source(String::cast(script->source()), isolate());
+    ScriptData* blob =
+        CodeSerializer::Serialize(isolate(), function_info, source);
+    entries.PutSection(function_info->language_mode(), "language mode");
+    entries.PutInt(script->line_offset(), "line offset");
+    entries.PutInt(script->column_offset(), "column offset");
+    entries.PutInt(script->origin_options().Flags(), "origin options");
+    PutStringTo(&entries, Handle<Object>(script->name(), isolate()));
+    PutStringTo(&entries, source);
+    entries.PutInt(blob->length(), "code blob length");
+    entries.PutRaw(blob->data(), blob->length(), "code blob");
+    delete blob;
+    count++;
+  }
+  if (count == 0) return NULL;
+
+  SnapshotByteSink header;
+  header.PutRaw(kExportedScriptDataTag,
+                static_cast<int>(sizeof(kExportedScriptDataTag)), "tag");
+  header.PutInt(count, "script count");
+
+  int total = header.data()->length() + entries.data()->length();
+  byte* data = NewArray<byte>(total);
+  CopyBytes(data, header.data()->begin(),
+            static_cast<size_t>(header.data()->length()));
+  CopyBytes(data + header.data()->length(), entries.data()->begin(),
+            static_cast<size_t>(entries.data()->length()));
+  ScriptData* result = new ScriptData(data, total);
+  result->AcquireDataOwnership();
+  return result;
+}
+
+
+void CompilationCache::ImportScriptData(const byte* data, int length) {
+  if (!IsEnabled()) return;
+  if (length < static_cast<int>(sizeof(kExportedScriptDataTag))) return;
+  if (memcmp(data, kExportedScriptDataTag, sizeof(kExportedScriptDataTag)) !=
+      0) {
+    return;
+  }
+
+  HandleScope scope(isolate());
+  Handle<Context> context = isolate()->native_context();
+  SnapshotByteSource source(Vector<const byte>(data, length));
+  source.Advance(static_cast<int>(sizeof(kExportedScriptDataTag)));
+  int count = source.GetInt();
+  for (int i = 0; i < count && source.HasMore(); i++) {
+    HandleScope entry_scope(isolate());
+    LanguageMode language_mode = static_cast<LanguageMode>(source.Get());
+    int line_offset = source.GetInt();
+    int column_offset = source.GetInt();
+    int origin_options = source.GetInt();
+    Handle<String> name;
+    bool has_name = ReadStringFrom(isolate(), &source).ToHandle(&name);
+    Handle<String> source_string =
+        ReadStringFrom(isolate(), &source).ToHandleChecked();
+    const byte* blob_data;
+    int blob_length = source.GetBlob(&blob_data);
+    ScriptData script_data(blob_data, blob_length);
+    Handle<SharedFunctionInfo> function_info;
+    if (!CodeSerializer::Deserialize(isolate(), &script_data, source_string)
+             .ToHandle(&function_info)) {
+      // The blob was produced by an incompatible build; skip the entry.
+      continue;
+    }
+    // Restore the origin information CompilationCacheScript::Lookup checks
+    // against, so rehydrated entries match the same lookups as the originals.
+    Handle<Script> script(Script::cast(function_info->script()), isolate());
+    if (has_name) script->set_name(*name);
+    script->set_line_offset(line_offset);
+    script->set_column_offset(column_offset);
+    script->set_origin_options(ScriptOriginOptions(origin_options));
+    script_.Put(source_string, context, language_mode, function_info);
+  }
+}
+
+
 void CompilationCache::Clear() {
   for (int i = 0; i < kSubCacheCount; i++) {
     subcaches_[i]->Clear();
@@ -12,6 +12,8 @@
 namespace v8 {
 namespace internal {
 
+class ScriptData;
+
 // The compilation cache consists of several generational sub-caches which uses
 // this class as a base class. A sub-cache contains a compilation cache tables
 // for each generation of the sub-cache. Since the same source code string has
@@ -99,7 +101,9 @@ class CompilationCacheScript : public CompilationSubCache {
 // in native contexts and one for eval calls in other contexts. The cache
 // considers the following pieces of information when checking for matching
 // entries:
-// 1. The source string.
+// 1. The source string, compared by content (hash and character-wise
+//    equality), so generated eval strings hit the cache regardless of
+//    string identity.
 // 2. The shared function info of the calling function.
 // 3. Whether the source should be compiled as strict code or as sloppy code.
 //    Note: Currently there are clients of CompileEval that always compile
@@ -186,6 +190,22 @@ class CompilationCache {
                  JSRegExp::Flags flags,
                  Handle<FixedArray> data);
 
+  // Serializes the compiled scripts currently held in the script sub-cache
+  // into a single buffer of CodeSerializer blobs, so embedders can carry the
+  // cache across an isolate restart (see Isolate::ExportCompilationCache).
+  // Entries whose code cannot be serialized (e.g. full-codegen code compiled
+  // without serialization support) are left out. Returns NULL if there is
+  // nothing to export; otherwise the caller owns the returned ScriptData.
+  ScriptData* ExportScriptData();
+
+  // Restores scripts previously serialized with ExportScriptData into the
+  // script sub-cache, keyed by the same (source, origin, language mode)
+  // criteria the cache applies on lookup. Entries rejected by the code
+  // serializer's sanity checks (version, flags or CPU feature mismatch) are
+  // skipped individually. The data must have been produced by
+  // ExportScriptData; a context must be entered.
+  void ImportScriptData(const byte* data, int length);
+
   // Clear the cache - also used to initialize the cache at startup.
   void Clear();
 
@@ -152,5 +152,79 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   return os;
 }
 
+static void WriteJSONString(std::ostream& os, const char* string) {
+  os << '"';
+  for (const char* c = string; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      os << '\\' << *c;
+    } else if (*c == '\n') {
+      os << "\\n";
+    } else {
+      os << *c;
+    }
+  }
+  os << '"';
+}
+
+
+static void WriteJSONStats(std::ostream& os,
+                           const CompilationStatistics::BasicStats& stats) {
+  os << "\"time_ms\": " << stats.delta_.InMillisecondsF()
+     << ", \"total_allocated_bytes\": " << stats.total_allocated_bytes_
+     << ", \"max_allocated_bytes\": " << stats.max_allocated_bytes_
+     << ", \"absolute_max_allocated_bytes\": "
+     << stats.absolute_max_allocated_bytes_ << ", \"function\": ";
+  WriteJSONString(os, stats.function_name_.c_str());
+}
+
+
+std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& js) {
+  const CompilationStatistics& s = js.s;
+
+  // Emit the phases and phase kinds in insertion order, like the table.
+  typedef std::vector<CompilationStatistics::PhaseKindMap::const_iterator>
+      SortedPhaseKinds;
+  SortedPhaseKinds sorted_phase_kinds(s.phase_kind_map_.size());
+  for (auto it = s.phase_kind_map_.begin(); it != s.phase_kind_map_.end();
+       ++it) {
+    sorted_phase_kinds[it->second.insert_order_] = it;
+  }
+
+  typedef std::vector<CompilationStatistics::PhaseMap::const_iterator>
+      SortedPhases;
+  SortedPhases sorted_phases(s.phase_map_.size());
+  for (auto it = s.phase_map_.begin(); it != s.phase_map_.end(); ++it) {
+    sorted_phases[it->second.insert_order_] = it;
+  }
+
+  os << "{\n  \"phases\": [";
+  bool first = true;
+  for (auto phase_it : sorted_phases) {
+    os << (first ? "\n" : ",\n") << "    { \"name\": ";
+    first = false;
+    WriteJSONString(os, phase_it->first.c_str());
+    os << ", \"kind\": ";
+    WriteJSONString(os, phase_it->second.phase_kind_name_.c_str());
+    os << ", ";
+    WriteJSONStats(os, phase_it->second);
+    os << " }";
+  }
+  os << "\n  ],\n  \"phase_kinds\": [";
+  first = true;
+  for (auto phase_kind_it : sorted_phase_kinds) {
+    os << (first ? "\n" : ",\n") << "    { \"name\": ";
+    first = false;
+    WriteJSONString(os, phase_kind_it->first.c_str());
+    os << ", ";
+    WriteJSONStats(os, phase_kind_it->second);
+    os << " }";
+  }
+  os << "\n  ],\n  \"totals\": { ";
+  WriteJSONStats(os, s.total_stats_);
+  os << " }\n}\n";
+
+  return os;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -22,6 +22,13 @@ struct AsPrintableStatistics {
   const bool machine_output;
 };
 
+// Writes the statistics as a single JSON object with per-phase records, so
+// that tooling can attribute compile time to individual passes without
+// parsing the human-readable table.
+struct AsJSONStatistics {
+  const CompilationStatistics& s;
+};
+
 class CompilationStatistics final : public Malloced {
  public:
   CompilationStatistics() {}
@@ -72,6 +79,7 @@ class CompilationStatistics final : public Malloced {
 
   friend std::ostream& operator<<(std::ostream& os,
                                   const AsPrintableStatistics& s);
+  friend std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& s);
 
   typedef OrderedStats PhaseKindStats;
   typedef std::map<std::string, PhaseKindStats> PhaseKindMap;
@@ -85,6 +93,7 @@ class CompilationStatistics final : public Malloced {
 };
 
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& s);
+std::ostream& operator<<(std::ostream& os, const AsJSONStatistics& s);
 
 }  // namespace internal
 }  // namespace v8
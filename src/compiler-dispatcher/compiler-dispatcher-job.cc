@@ -19,26 +19,36 @@ namespace v8 {
 namespace internal {
 
 CompilerDispatcherJob::CompilerDispatcherJob(Isolate* isolate,
-                                             Handle<JSFunction> function,
+                                             Handle<SharedFunctionInfo> shared,
+                                             Handle<Context> context,
                                              size_t max_stack_size)
     : isolate_(isolate),
-      function_(Handle<JSFunction>::cast(
-          isolate_->global_handles()->Create(*function))),
+      shared_(Handle<SharedFunctionInfo>::cast(
+          isolate_->global_handles()->Create(*shared))),
+      context_(Handle<Context>::cast(
+          isolate_->global_handles()->Create(*context))),
       max_stack_size_(max_stack_size),
       can_compile_on_background_thread_(false) {
   HandleScope scope(isolate_);
-  Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
-  Handle<Script> script(Script::cast(shared->script()), isolate_);
+  Handle<Script> script(Script::cast(shared_->script()), isolate_);
   Handle<String> source(String::cast(script->source()), isolate_);
   can_parse_on_background_thread_ =
       source->IsExternalTwoByteString() || source->IsExternalOneByteString();
 }
 
+CompilerDispatcherJob::CompilerDispatcherJob(Isolate* isolate,
+                                             Handle<JSFunction> function,
+                                             size_t max_stack_size)
+    : CompilerDispatcherJob(isolate, handle(function->shared(), isolate),
+                            handle(function->context(), isolate),
+                            max_stack_size) {}
+
 CompilerDispatcherJob::~CompilerDispatcherJob() {
   DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
   DCHECK(status_ == CompileJobStatus::kInitial ||
          status_ == CompileJobStatus::kDone);
-  i::GlobalHandles::Destroy(Handle<Object>::cast(function_).location());
+  i::GlobalHandles::Destroy(Handle<Object>::cast(shared_).location());
+  i::GlobalHandles::Destroy(Handle<Object>::cast(context_).location());
 }
 
 void CompilerDispatcherJob::PrepareToParseOnMainThread() {
@@ -47,25 +57,20 @@ void CompilerDispatcherJob::PrepareToParseOnMainThread() {
   HandleScope scope(isolate_);
   unicode_cache_.reset(new UnicodeCache());
   zone_.reset(new Zone(isolate_->allocator()));
-  Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
+  Handle<SharedFunctionInfo> shared = shared_;
   Handle<Script> script(Script::cast(shared->script()), isolate_);
   DCHECK(script->type() != Script::TYPE_NATIVE);
 
   Handle<String> source(String::cast(script->source()), isolate_);
-  if (source->IsExternalTwoByteString()) {
-    character_stream_.reset(new ExternalTwoByteStringUtf16CharacterStream(
-        Handle<ExternalTwoByteString>::cast(source), shared->start_position(),
-        shared->end_position()));
-  } else if (source->IsExternalOneByteString()) {
-    character_stream_.reset(new ExternalOneByteStringUtf16CharacterStream(
-        Handle<ExternalOneByteString>::cast(source), shared->start_position(),
-        shared->end_position()));
+  if (source->IsExternalTwoByteString() || source->IsExternalOneByteString()) {
+    character_stream_.reset(ScannerStream::For(source, shared->start_position(),
+                                               shared->end_position()));
   } else {
     source = String::Flatten(source);
     // Have to globalize the reference here, so it survives between function
     // calls.
     source_ = Handle<String>::cast(isolate_->global_handles()->Create(*source));
-    character_stream_.reset(new GenericStringUtf16CharacterStream(
+    character_stream_.reset(ScannerStream::For(
         source_, shared->start_position(), shared->end_position()));
   }
   parse_info_.reset(new ParseInfo(zone_.get()));
@@ -83,7 +88,7 @@ void CompilerDispatcherJob::PrepareToParseOnMainThread() {
 
   parser_.reset(new Parser(parse_info_.get()));
   parser_->DeserializeScopeChain(
-      parse_info_.get(), handle(function_->context(), isolate_),
+      parse_info_.get(), context_,
       Scope::DeserializationMode::kDeserializeOffHeap);
 
   Handle<String> name(String::cast(shared->name()));
@@ -143,12 +148,11 @@ bool CompilerDispatcherJob::FinalizeParsingOnMainThread() {
     std::unique_ptr<CanonicalHandleScope> canonical;
     if (FLAG_ignition) canonical.reset(new CanonicalHandleScope(isolate_));
 
-    Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
-    Handle<Script> script(Script::cast(shared->script()), isolate_);
+    Handle<Script> script(Script::cast(shared_->script()), isolate_);
 
     parse_info_->set_script(script);
-    parse_info_->set_context(handle(function_->context(), isolate_));
-    parse_info_->set_shared_info(handle(function_->shared(), isolate_));
+    parse_info_->set_context(context_);
+    parse_info_->set_shared_info(shared_);
 
     // Do the parsing tasks which need to be done on the main thread. This will
     // also handle parse errors.
@@ -170,7 +174,10 @@ bool CompilerDispatcherJob::PrepareToCompileOnMainThread() {
   DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
   DCHECK(status() == CompileJobStatus::kReadyToAnalyse);
 
-  compile_info_.reset(new CompilationInfo(parse_info_.get(), function_));
+  // The job does not necessarily have a closure; the code is installed on
+  // the shared function info, like eagerly compiled inner functions.
+  compile_info_.reset(
+      new CompilationInfo(parse_info_.get(), Handle<JSFunction>::null()));
 
   DeferredHandleScope scope(isolate_);
   {
@@ -259,5 +266,10 @@ void CompilerDispatcherJob::ResetOnMainThread() {
   status_ = CompileJobStatus::kInitial;
 }
 
+bool CompilerDispatcherJob::IsAssociatedWith(
+    Handle<SharedFunctionInfo> shared) const {
+  return *shared_ == *shared;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -16,10 +16,12 @@ namespace internal {
 
 class CompilationInfo;
 class CompilationJob;
+class Context;
 class Isolate;
 class JSFunction;
 class ParseInfo;
 class Parser;
+class SharedFunctionInfo;
 class String;
 class UnicodeCache;
 class Utf16CharacterStream;
@@ -36,8 +38,18 @@ enum class CompileJobStatus {
   kDone,
 };
 
+// Lanes for background scheduling. Urgent jobs are functions that are
+// expected to be called soon, e.g. freshly instantiated closures; idle jobs
+// are speculative parses of a script's lazy functions.
+enum class CompileJobPriority { kIdle, kUrgent };
+
 class CompilerDispatcherJob {
  public:
+  // |context| is the context the function's outer scope chain is deserialized
+  // from; functions that have not been instantiated yet are enqueued with the
+  // context their script is being compiled in.
+  CompilerDispatcherJob(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                        Handle<Context> context, size_t max_stack_size);
   CompilerDispatcherJob(Isolate* isolate, Handle<JSFunction> function,
                         size_t max_stack_size);
   ~CompilerDispatcherJob();
@@ -52,6 +64,20 @@ class CompilerDispatcherJob {
     return can_compile_on_background_thread_;
   }
 
+  // Whether the job is stepped through bytecode generation as soon as the
+  // background parse finishes, instead of waiting for the function's first
+  // call.
+  bool pipeline_to_bytecode() const { return pipeline_to_bytecode_; }
+  void set_pipeline_to_bytecode() { pipeline_to_bytecode_ = true; }
+
+  CompileJobPriority priority() const { return priority_; }
+  void set_priority(CompileJobPriority priority) { priority_ = priority; }
+
+  // Absolute time (Platform::MonotonicallyIncreasingTime) after which a
+  // pending job is overdue and runs ahead of both lanes.
+  double deadline() const { return deadline_; }
+  void set_deadline(double deadline) { deadline_ = deadline; }
+
   // Transition from kInitial to kReadyToParse.
   void PrepareToParseOnMainThread();
 
@@ -76,13 +102,17 @@ class CompilerDispatcherJob {
   // Transition from any state to kInitial and free all resources.
   void ResetOnMainThread();
 
+  // Returns true if this job is associated with the given function.
+  bool IsAssociatedWith(Handle<SharedFunctionInfo> shared) const;
+
  private:
   FRIEND_TEST(CompilerDispatcherJobTest, ScopeChain);
 
   CompileJobStatus status_ = CompileJobStatus::kInitial;
   Isolate* isolate_;
-  Handle<JSFunction> function_;  // Global handle.
-  Handle<String> source_;        // Global handle.
+  Handle<SharedFunctionInfo> shared_;  // Global handle.
+  Handle<Context> context_;            // Global handle.
+  Handle<String> source_;              // Global handle.
   size_t max_stack_size_;
 
   // Members required for parsing.
@@ -99,6 +129,9 @@ class CompilerDispatcherJob {
 
   bool can_parse_on_background_thread_;
   bool can_compile_on_background_thread_;
+  bool pipeline_to_bytecode_ = false;
+  CompileJobPriority priority_ = CompileJobPriority::kIdle;
+  double deadline_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(CompilerDispatcherJob);
 };
@@ -0,0 +1,326 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
+
+#include <algorithm>
+
+#include "src/cancelable-task.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class CompilerDispatcher::BackgroundTask : public CancelableTask {
+ public:
+  BackgroundTask(Isolate* isolate, CompilerDispatcher* dispatcher)
+      : CancelableTask(isolate), dispatcher_(dispatcher) {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { dispatcher_->DoBackgroundWork(); }
+
+  CompilerDispatcher* dispatcher_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundTask);
+};
+
+class CompilerDispatcher::ForegroundTask : public CancelableTask {
+ public:
+  ForegroundTask(Isolate* isolate, CompilerDispatcher* dispatcher,
+                 CompilerDispatcherJob* job)
+      : CancelableTask(isolate), dispatcher_(dispatcher), job_(job) {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { dispatcher_->DoForegroundStep(job_); }
+
+  CompilerDispatcher* dispatcher_;
+  CompilerDispatcherJob* job_;
+
+  DISALLOW_COPY_AND_ASSIGN(ForegroundTask);
+};
+
+CompilerDispatcher::CompilerDispatcher(Isolate* isolate, size_t max_stack_size)
+    : isolate_(isolate), max_stack_size_(max_stack_size) {}
+
+CompilerDispatcher::~CompilerDispatcher() { AbortAll(); }
+
+bool CompilerDispatcher::Enqueue(Handle<SharedFunctionInfo> shared,
+                                 Handle<Context> context,
+                                 bool pipeline_to_bytecode,
+                                 CompileJobPriority priority) {
+  if (!FLAG_compiler_dispatcher) return false;
+  if (IsEnqueued(shared)) return true;
+  std::unique_ptr<CompilerDispatcherJob> job(
+      new CompilerDispatcherJob(isolate_, shared, context, max_stack_size_));
+  // Only sources backed by external strings can be parsed off-thread.
+  if (!job->can_parse_on_background_thread()) return false;
+  if (pipeline_to_bytecode) job->set_pipeline_to_bytecode();
+  job->set_priority(priority);
+  job->set_deadline(V8::GetCurrentPlatform()->MonotonicallyIncreasingTime() +
+                    FLAG_compiler_dispatcher_deadline_ms / 1000.0);
+  job->PrepareToParseOnMainThread();
+  CompilerDispatcherJob* raw_job = job.get();
+  jobs_.push_back(std::move(job));
+  ScheduleBackgroundParse(raw_job);
+  return true;
+}
+
+bool CompilerDispatcher::Enqueue(Handle<JSFunction> function) {
+  // A freshly instantiated closure is likely to be called soon; schedule it
+  // ahead of the speculative parses of a just-compiled script.
+  return Enqueue(handle(function->shared(), isolate_),
+                 handle(function->context(), isolate_), false,
+                 CompileJobPriority::kUrgent);
+}
+
+bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> shared) const {
+  for (const std::unique_ptr<CompilerDispatcherJob>& job : jobs_) {
+    if (job->IsAssociatedWith(shared)) return true;
+  }
+  return false;
+}
+
+bool CompilerDispatcher::IsEnqueued(Handle<JSFunction> function) const {
+  return IsEnqueued(handle(function->shared(), isolate_));
+}
+
+bool CompilerDispatcher::FinishNow(Handle<JSFunction> function) {
+  JobList::iterator it = GetJobFor(handle(function->shared(), isolate_));
+  CHECK(it != jobs_.end());
+  CompilerDispatcherJob* job = it->get();
+  {
+    // Steal the job if it is still waiting for a background thread; all of
+    // its remaining steps run on the main thread below instead of behind
+    // whatever else is queued.
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    std::vector<CompilerDispatcherJob*>::iterator pending =
+        std::find(pending_background_jobs_.begin(),
+                  pending_background_jobs_.end(), job);
+    if (pending != pending_background_jobs_.end()) {
+      pending_background_jobs_.erase(pending);
+    }
+  }
+  WaitForBackgroundStep(job);
+  bool success = StepToCompletionOnMainThread(job);
+  job->ResetOnMainThread();
+  jobs_.erase(it);
+  return success;
+}
+
+void CompilerDispatcher::AbortAll() {
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    pending_background_jobs_.clear();
+    while (!running_background_jobs_.empty()) {
+      background_step_finished_.Wait(&mutex_);
+    }
+  }
+  for (std::unique_ptr<CompilerDispatcherJob>& job : jobs_) {
+    job->ResetOnMainThread();
+  }
+  jobs_.clear();
+}
+
+CompilerDispatcher::JobList::iterator CompilerDispatcher::GetJobFor(
+    Handle<SharedFunctionInfo> shared) {
+  JobList::iterator it = jobs_.begin();
+  for (; it != jobs_.end(); ++it) {
+    if ((*it)->IsAssociatedWith(shared)) break;
+  }
+  return it;
+}
+
+void CompilerDispatcher::ScheduleBackgroundParse(CompilerDispatcherJob* job) {
+  DCHECK(job->can_parse_on_background_thread());
+  ScheduleBackgroundStep(job);
+}
+
+void CompilerDispatcher::ScheduleBackgroundCompile(CompilerDispatcherJob* job) {
+  DCHECK(job->can_compile_on_background_thread());
+  ScheduleBackgroundStep(job);
+}
+
+void CompilerDispatcher::ScheduleBackgroundStep(CompilerDispatcherJob* job) {
+  bool post_task = false;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    pending_background_jobs_.push_back(job);
+    if (num_background_tasks_ < MaxBackgroundTasks()) {
+      num_background_tasks_++;
+      post_task = true;
+    }
+  }
+  if (post_task) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new BackgroundTask(isolate_, this), v8::Platform::kShortRunningTask);
+  }
+}
+
+size_t CompilerDispatcher::MaxBackgroundTasks() const {
+  size_t threads =
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads();
+  return threads == 0 ? 1 : threads;
+}
+
+CompilerDispatcherJob* CompilerDispatcher::TakeHighestPriorityPendingJob(
+    double now) {
+  // Overdue jobs run first regardless of lane, so that a burst of urgent
+  // enqueues cannot starve the idle lane forever; then the more urgent lane,
+  // and within a lane the earliest deadline, i.e. enqueue order.
+  std::vector<CompilerDispatcherJob*>::iterator best =
+      pending_background_jobs_.end();
+  for (std::vector<CompilerDispatcherJob*>::iterator it =
+           pending_background_jobs_.begin();
+       it != pending_background_jobs_.end(); ++it) {
+    if (best == pending_background_jobs_.end()) {
+      best = it;
+      continue;
+    }
+    bool it_overdue = now >= (*it)->deadline();
+    bool best_overdue = now >= (*best)->deadline();
+    if (it_overdue != best_overdue) {
+      if (it_overdue) best = it;
+      continue;
+    }
+    if ((*it)->priority() != (*best)->priority()) {
+      if ((*it)->priority() > (*best)->priority()) best = it;
+      continue;
+    }
+    if ((*it)->deadline() < (*best)->deadline()) best = it;
+  }
+  if (best == pending_background_jobs_.end()) return NULL;
+  CompilerDispatcherJob* job = *best;
+  pending_background_jobs_.erase(best);
+  return job;
+}
+
+void CompilerDispatcher::DoBackgroundWork() {
+  for (;;) {
+    CompilerDispatcherJob* job = NULL;
+    {
+      base::LockGuard<base::Mutex> lock(&mutex_);
+      job = TakeHighestPriorityPendingJob(
+          V8::GetCurrentPlatform()->MonotonicallyIncreasingTime());
+      if (job == NULL) {
+        num_background_tasks_--;
+        return;
+      }
+      running_background_jobs_.insert(job);
+    }
+    bool post_foreground_step;
+    if (job->status() == CompileJobStatus::kReadyToParse) {
+      job->Parse();
+      post_foreground_step = job->pipeline_to_bytecode();
+    } else {
+      DCHECK(job->status() == CompileJobStatus::kReadyToCompile);
+      job->Compile();
+      post_foreground_step = true;
+    }
+    {
+      base::LockGuard<base::Mutex> lock(&mutex_);
+      running_background_jobs_.erase(job);
+      background_step_finished_.NotifyAll();
+    }
+    // The next steps of a pipelined job have to happen on the main thread.
+    if (post_foreground_step) {
+      V8::GetCurrentPlatform()->CallOnForegroundThread(
+          reinterpret_cast<v8::Isolate*>(isolate_),
+          new ForegroundTask(isolate_, this, job));
+    }
+  }
+}
+
+void CompilerDispatcher::DoForegroundStep(CompilerDispatcherJob* job) {
+  JobList::iterator it = jobs_.begin();
+  for (; it != jobs_.end(); ++it) {
+    if (it->get() == job) break;
+  }
+  // The job may have been finished by FinishNow or freed by AbortAll before
+  // this task got to run.
+  if (it == jobs_.end()) return;
+
+  // Unlike FinishNow, this does not run under a caller's handle scope.
+  HandleScope scope(isolate_);
+  bool done = false;
+  bool success = true;
+  while (!done && success) {
+    switch (job->status()) {
+      case CompileJobStatus::kParsed:
+        success = job->FinalizeParsingOnMainThread();
+        break;
+      case CompileJobStatus::kReadyToAnalyse:
+        success = job->PrepareToCompileOnMainThread();
+        break;
+      case CompileJobStatus::kReadyToCompile:
+        if (job->can_compile_on_background_thread()) {
+          ScheduleBackgroundCompile(job);
+          return;
+        }
+        job->Compile();
+        break;
+      case CompileJobStatus::kCompiled:
+        success = job->FinalizeCompilingOnMainThread();
+        done = true;
+        break;
+      default:
+        // Nothing to do until the next background step finishes or the
+        // function's first call picks the job up through FinishNow.
+        return;
+    }
+  }
+  // The job either finished or failed. Failures cannot be reported from a
+  // posted task, so the pending exception is dropped; the function still has
+  // the lazy compile stub installed and simply compiles (and throws) on its
+  // first call instead.
+  if (!success && isolate_->has_pending_exception()) {
+    isolate_->clear_pending_exception();
+  }
+  job->ResetOnMainThread();
+  jobs_.erase(it);
+}
+
+void CompilerDispatcher::WaitForBackgroundStep(CompilerDispatcherJob* job) {
+  base::LockGuard<base::Mutex> lock(&mutex_);
+  while (running_background_jobs_.find(job) != running_background_jobs_.end()) {
+    background_step_finished_.Wait(&mutex_);
+  }
+}
+
+// static
+bool CompilerDispatcher::StepToCompletionOnMainThread(
+    CompilerDispatcherJob* job) {
+  for (;;) {
+    switch (job->status()) {
+      case CompileJobStatus::kInitial:
+        UNREACHABLE();
+        break;
+      case CompileJobStatus::kReadyToParse:
+        job->Parse();
+        break;
+      case CompileJobStatus::kParsed:
+        if (!job->FinalizeParsingOnMainThread()) return false;
+        break;
+      case CompileJobStatus::kReadyToAnalyse:
+        if (!job->PrepareToCompileOnMainThread()) return false;
+        break;
+      case CompileJobStatus::kReadyToCompile:
+        job->Compile();
+        break;
+      case CompileJobStatus::kCompiled:
+        if (!job->FinalizeCompilingOnMainThread()) return false;
+        break;
+      case CompileJobStatus::kFailed:
+        return false;
+      case CompileJobStatus::kDone:
+        return true;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
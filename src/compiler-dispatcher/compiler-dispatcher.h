@@ -0,0 +1,106 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+#define V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/compiler-dispatcher/compiler-dispatcher-job.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Context;
+class Isolate;
+class JSFunction;
+class SharedFunctionInfo;
+
+// Drives CompilerDispatcherJobs: functions enqueued here are parsed on a
+// background thread ahead of their first call and stepped through bytecode
+// generation on the main thread once the function is actually needed.
+//
+// Jobs queue up in two priority lanes and a bounded number of worker tasks
+// always picks the most urgent pending job, so that after a burst of
+// enqueues the functions most likely to be called next do not wait behind
+// cold ones. Overdue jobs (see --compiler-dispatcher-deadline-ms) preempt
+// both lanes, and FinishNow steals a job that is still waiting for a
+// background thread and completes it on the main thread.
+class CompilerDispatcher {
+ public:
+  CompilerDispatcher(Isolate* isolate, size_t max_stack_size);
+  ~CompilerDispatcher();
+
+  // Returns true if the function was enqueued for background parsing.
+  // |context| is the context the function's outer scope chain will be
+  // deserialized from; for functions that have not been instantiated yet this
+  // is the context their script is being compiled in. With
+  // |pipeline_to_bytecode| the job is carried on through bytecode generation
+  // as soon as the background parse finishes, alternating between background
+  // threads and posted foreground tasks, instead of waiting for the
+  // function's first call.
+  bool Enqueue(Handle<SharedFunctionInfo> shared, Handle<Context> context,
+               bool pipeline_to_bytecode = false,
+               CompileJobPriority priority = CompileJobPriority::kIdle);
+  bool Enqueue(Handle<JSFunction> function);
+
+  bool IsEnqueued(Handle<SharedFunctionInfo> shared) const;
+  bool IsEnqueued(Handle<JSFunction> function) const;
+
+  // Performs the outstanding steps of the job for the given function on the
+  // main thread, waiting for a pending background step to finish first.
+  // Returns false if the compilation failed; in that case an exception is
+  // pending.
+  bool FinishNow(Handle<JSFunction> function);
+
+  // Waits for running background steps and frees all jobs.
+  void AbortAll();
+
+ private:
+  class BackgroundTask;
+  class ForegroundTask;
+
+  typedef std::vector<std::unique_ptr<CompilerDispatcherJob> > JobList;
+
+  JobList::iterator GetJobFor(Handle<SharedFunctionInfo> shared);
+  void ScheduleBackgroundParse(CompilerDispatcherJob* job);
+  void ScheduleBackgroundCompile(CompilerDispatcherJob* job);
+  void ScheduleBackgroundStep(CompilerDispatcherJob* job);
+  void DoBackgroundWork();
+  void DoForegroundStep(CompilerDispatcherJob* job);
+  void WaitForBackgroundStep(CompilerDispatcherJob* job);
+  size_t MaxBackgroundTasks() const;
+  // Must be called with mutex_ held.
+  CompilerDispatcherJob* TakeHighestPriorityPendingJob(double now);
+  static bool StepToCompletionOnMainThread(CompilerDispatcherJob* job);
+
+  Isolate* isolate_;
+  size_t max_stack_size_;
+
+  // Only accessed on the main thread.
+  JobList jobs_;
+
+  // Protects pending_background_jobs_, running_background_jobs_ and
+  // num_background_tasks_.
+  mutable base::Mutex mutex_;
+  base::ConditionVariable background_step_finished_;
+  std::vector<CompilerDispatcherJob*> pending_background_jobs_;
+  std::set<CompilerDispatcherJob*> running_background_jobs_;
+  // Worker tasks posted but not yet exited; each drains the pending queue in
+  // priority order until it is empty.
+  size_t num_background_tasks_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilerDispatcher);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
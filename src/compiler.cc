@@ -15,6 +15,7 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/compiler/pipeline.h"
 #include "src/crankshaft/hydrogen.h"
@@ -630,6 +631,24 @@ CompilationJob::Status FinalizeUnoptimizedCompilationJob(CompilationJob* job) {
   return status;
 }
 
+// For OSR from bytecode the entry id is derived from the bytecode offset of
+// the loop back edge and might overlap with an actual AST-based BailoutId of
+// the same function (see TODO(4764)). Shift such ids into their own (negative)
+// number space when they are used as keys in the optimized code map, so that
+// repeated OSR at the same loop can reuse the code object without ever
+// aliasing an AST-keyed entry.
+BailoutId CodeMapKeyForBytecodeOsr(BailoutId osr_ast_id) {
+  DCHECK_LE(0, osr_ast_id.ToInt());
+  return BailoutId(-2 - osr_ast_id.ToInt());
+}
+
+BailoutId CodeMapKey(CompilationInfo* info) {
+  if (info->is_osr() && info->is_optimizing_from_bytecode()) {
+    return CodeMapKeyForBytecodeOsr(info->osr_ast_id());
+  }
+  return info->osr_ast_id();
+}
+
 MUST_USE_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeMap(
     Handle<JSFunction> function, BailoutId osr_ast_id) {
   Handle<SharedFunctionInfo> shared(function->shared());
@@ -656,17 +675,14 @@ void InsertCodeIntoOptimizedCodeMap(CompilationInfo* info) {
   // Frame specialization implies function context specialization.
   DCHECK(!info->is_frame_specializing());
 
-  // TODO(4764): When compiling for OSR from bytecode, BailoutId might derive
-  // from bytecode offset and overlap with actual BailoutId. No caching!
-  if (info->is_osr() && info->is_optimizing_from_bytecode()) return;
-
-  // Cache optimized context-specific code.
+  // Cache optimized context-specific code. OSR code compiled from bytecode is
+  // keyed in its own id space, see CodeMapKey above.
   Handle<JSFunction> function = info->closure();
   Handle<SharedFunctionInfo> shared(function->shared());
   Handle<LiteralsArray> literals(function->literals());
   Handle<Context> native_context(function->context()->native_context());
   SharedFunctionInfo::AddToOptimizedCodeMap(shared, native_context, code,
-                                            literals, info->osr_ast_id());
+                                            literals, CodeMapKey(info));
 
   // Do not cache (native) context-independent code compiled for OSR.
   if (code->is_turbofanned() && info->is_osr()) return;
@@ -820,10 +836,9 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   if (ignition_osr && !FLAG_turbo_from_bytecode) return MaybeHandle<Code>();
 
   Handle<Code> cached_code;
-  // TODO(4764): When compiling for OSR from bytecode, BailoutId might derive
-  // from bytecode offset and overlap with actual BailoutId. No lookup!
-  if (!ignition_osr &&
-      GetCodeFromOptimizedCodeMap(function, osr_ast_id)
+  BailoutId code_map_key =
+      ignition_osr ? CodeMapKeyForBytecodeOsr(osr_ast_id) : osr_ast_id;
+  if (GetCodeFromOptimizedCodeMap(function, code_map_key)
           .ToHandle(&cached_code)) {
     if (FLAG_trace_opt) {
       PrintF("[found optimized code for ");
@@ -948,7 +963,7 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
       RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG, info);
       if (shared
               ->SearchOptimizedCodeMap(info->context()->native_context(),
-                                       info->osr_ast_id())
+                                       CodeMapKey(info))
               .code == nullptr) {
         InsertCodeIntoOptimizedCodeMap(info);
       }
@@ -1350,6 +1365,23 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag) {
   Isolate* isolate = function->GetIsolate();
   DCHECK(AllowCompilation::IsAllowed(isolate));
 
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (dispatcher->IsEnqueued(function)) {
+    // The function was parsed on a background thread ahead of time; finish
+    // the remaining steps now.
+    if (!dispatcher->FinishNow(function)) {
+      if (flag == CLEAR_EXCEPTION) {
+        isolate->clear_pending_exception();
+      }
+      return false;
+    }
+    // Install code on closure.
+    function->ReplaceCode(function->shared()->code());
+    JSFunction::EnsureLiterals(function);
+    DCHECK(function->is_compiled());
+    return true;
+  }
+
   // Start a compilation.
   Handle<Code> code;
   if (!GetLazyCode(function).ToHandle(&code)) {
@@ -1363,6 +1395,24 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag) {
   function->ReplaceCode(*code);
   JSFunction::EnsureLiterals(function);
 
+  // Functions hinted for eager tier-up by the embedder are handed to the
+  // optimizing compiler right away instead of waiting for the runtime
+  // profiler to observe them as hot.
+  if (function->shared()->marked_for_tier_up() &&
+      !function->shared()->optimization_disabled() &&
+      !function->IsOptimized() && !function->IsInOptimizationQueue()) {
+    function->shared()->set_marked_for_tier_up(false);
+    ConcurrencyMode mode = isolate->concurrent_recompilation_enabled()
+                               ? CONCURRENT
+                               : NOT_CONCURRENT;
+    if (!CompileOptimized(function, mode)) {
+      if (flag == CLEAR_EXCEPTION) {
+        isolate->clear_pending_exception();
+      }
+      return false;
+    }
+  }
+
   // Check postconditions on success.
   DCHECK(!isolate->has_pending_exception());
   DCHECK(function->shared()->is_compiled());
@@ -1966,8 +2016,35 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
   std::unique_ptr<CanonicalHandleScope> canonical;
   if (FLAG_ignition) canonical.reset(new CanonicalHandleScope(info.isolate()));
 
-  if (lazy) {
+  // For streamed scripts, hand eagerly-compiled inner functions to the
+  // compiler dispatcher, which pipelines them through bytecode generation on
+  // background threads while the main thread finishes the top level. This
+  // overlaps download, parse and codegen for the part of the script that does
+  // not have to be runnable before the first statement executes. Functions
+  // the dispatcher cannot take (e.g. when the source is not an external
+  // string) fall back to synchronous code generation below.
+  bool compile_in_background =
+      !lazy && allow_lazy && outer_info->shared_info()->is_toplevel() &&
+      outer_info->parse_info()->is_streamed_script() &&
+      !outer_info->parse_info()->context().is_null() &&
+      isolate->compiler_dispatcher()->Enqueue(
+          result, outer_info->parse_info()->context(), true,
+          CompileJobPriority::kUrgent);
+
+  if (lazy || compile_in_background) {
     info.SetCode(isolate->builtins()->CompileLazy());
+    // Farm the body out to a background thread, so that the lazy functions
+    // of a large script are parsed by the time they are first called. Only
+    // functions directly inside the top-level scope are enqueued here: their
+    // outer scope chain is fully described by the compiling context, whereas
+    // functions nested inside closures need the instantiating context and
+    // are enqueued from PostInstantiation instead.
+    if (lazy && FLAG_compiler_dispatcher &&
+        outer_info->shared_info()->is_toplevel() &&
+        !outer_info->parse_info()->context().is_null()) {
+      isolate->compiler_dispatcher()->Enqueue(
+          result, outer_info->parse_info()->context());
+    }
   } else if (Renumber(info.parse_info()) && GenerateUnoptimizedCode(&info)) {
     // Code generation will ensure that the feedback vector is present and
     // appropriately sized.
@@ -2078,6 +2155,13 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
     // TODO(mvstanton): pass pretenure flag to EnsureLiterals.
     JSFunction::EnsureLiterals(function);
   }
+
+  if (FLAG_compiler_dispatcher && !shared->is_compiled() &&
+      shared->allows_lazy_compilation()) {
+    // Try to parse the function on a background thread, so that the work is
+    // done by the time it is first called.
+    function->GetIsolate()->compiler_dispatcher()->Enqueue(function);
+  }
 }
 
 }  // namespace internal
@@ -384,6 +384,18 @@ FieldAccess AccessBuilder::ForDescriptorArrayEnumCacheBridgeCache() {
 }
 
 
+// static
+FieldAccess AccessBuilder::ForLiteralsArrayFeedbackVector() {
+  FieldAccess access = {kTaggedBase,
+                        LiteralsArray::kFeedbackVectorOffset,
+                        Handle<Name>(),
+                        Type::TaggedPointer(),
+                        MachineType::TaggedPointer(),
+                        kPointerWriteBarrier};
+  return access;
+}
+
+
 // static
 FieldAccess AccessBuilder::ForMapBitField() {
   FieldAccess access = {kTaggedBase,          Map::kBitFieldOffset,
@@ -122,6 +122,9 @@ class AccessBuilder final : public AllStatic {
   // Provides access to DescriptorArray::enum_cache_bridge_cache() field.
   static FieldAccess ForDescriptorArrayEnumCacheBridgeCache();
 
+  // Provides access to LiteralsArray::feedback_vector() field.
+  static FieldAccess ForLiteralsArrayFeedbackVector();
+
   // Provides access to Map::bit_field() byte.
   static FieldAccess ForMapBitField();
 
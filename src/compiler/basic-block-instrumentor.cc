@@ -104,6 +104,78 @@ BasicBlockProfiler::Data* BasicBlockInstrumentor::Instrument(
   return data;
 }
 
+void BasicBlockInstrumentor::MarkColdBlocks(CompilationInfo* info,
+                                            Schedule* schedule) {
+  BasicBlockProfiler* profiler = info->isolate()->basic_block_profiler();
+  if (profiler == nullptr) return;
+  if (!info->has_shared_info() || !info->shared_info()->name()->IsString()) {
+    return;
+  }
+  std::ostringstream os;
+  String::cast(info->shared_info()->name())->PrintUC16(os);
+  std::string function_name = os.str();
+  if (function_name.empty()) return;
+  // Find profile data from a previous run of the same function. The data is
+  // only usable if the schedule didn't change, which we conservatively
+  // approximate by requiring the block ids to match exactly.
+  size_t n_blocks = static_cast<size_t>(schedule->RpoBlockCount()) - 1;
+  BasicBlockVector* blocks = schedule->rpo_order();
+  const BasicBlockProfiler::Data* data = nullptr;
+  for (const BasicBlockProfiler::Data* candidate : *profiler->data_list()) {
+    if (candidate->n_blocks() != n_blocks) continue;
+    if (candidate->function_name() != function_name) continue;
+    bool blocks_match = true;
+    for (size_t i = 0; i < n_blocks; ++i) {
+      if (candidate->block_id(i) != (*blocks)[i]->id().ToSize()) {
+        blocks_match = false;
+        break;
+      }
+    }
+    if (blocks_match) {
+      data = candidate;
+      break;
+    }
+  }
+  if (data == nullptr) return;
+  // Mark the blocks the profile never saw executed as deferred, except for
+  // the entry block, which trivially always runs.
+  std::vector<BasicBlock*> marked;
+  for (size_t i = 1; i < n_blocks; ++i) {
+    BasicBlock* block = (*blocks)[i];
+    if (data->counts()[i] == 0 && !block->deferred()) {
+      block->set_deferred(true);
+      marked.push_back(block);
+    }
+  }
+  // Unmark blocks again where the marking would violate the invariants the
+  // register allocator relies on for deferred code: a deferred block with
+  // multiple successors or multiple predecessors must only have deferred
+  // ones. Unmarking a block can invalidate others we marked, so iterate to a
+  // fixed point; originally deferred blocks satisfied the invariants before
+  // and marking additional blocks cannot break them.
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (BasicBlock* block : marked) {
+      if (!block->deferred()) continue;
+      bool valid = true;
+      if (block->SuccessorCount() > 1) {
+        for (BasicBlock* successor : block->successors()) {
+          if (!successor->deferred()) valid = false;
+        }
+      }
+      if (valid && block->PredecessorCount() > 1) {
+        for (BasicBlock* predecessor : block->predecessors()) {
+          if (!predecessor->deferred()) valid = false;
+        }
+      }
+      if (!valid) {
+        block->set_deferred(false);
+        changed = true;
+      }
+    }
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
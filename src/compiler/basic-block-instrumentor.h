@@ -22,6 +22,11 @@ class BasicBlockInstrumentor : public AllStatic {
  public:
   static BasicBlockProfiler::Data* Instrument(CompilationInfo* info,
                                               Graph* graph, Schedule* schedule);
+
+  // Marks blocks that a previous profiling run of the same function never
+  // executed as deferred, so that code generation places them out of line,
+  // after the hot code.
+  static void MarkColdBlocks(CompilationInfo* info, Schedule* schedule);
 };
 
 }  // namespace compiler
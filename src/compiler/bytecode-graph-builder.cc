@@ -1607,7 +1607,9 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
       jsgraph()->Constant(bytecode_iterator().current_offset() +
                           (BytecodeArray::kHeaderSize - kHeapObjectTag));
 
-  int register_count = environment()->register_count();
+  // Only registers below the suspend watermark can be live here; the operand
+  // stack array is sized accordingly.
+  int register_count = bytecode_array()->suspended_register_count();
   int value_input_count = 3 + register_count;
 
   Node** value_inputs = local_zone()->NewArray<Node*>(value_input_count);
@@ -1630,8 +1632,9 @@ void BytecodeGraphBuilder::VisitResumeGenerator() {
       bytecode_iterator().GetRegisterOperand(0));
 
   // Bijection between registers and array indices must match that used in
-  // InterpreterAssembler::ExportRegisterFile.
-  for (int i = 0; i < environment()->register_count(); ++i) {
+  // InterpreterAssembler::ExportRegisterFile. Registers above the suspend
+  // watermark are dead and keep their prologue values.
+  for (int i = 0; i < bytecode_array()->suspended_register_count(); ++i) {
     Node* value = NewNode(javascript()->GeneratorRestoreRegister(i), generator);
     environment()->BindRegister(interpreter::Register(i), value);
   }
@@ -799,6 +799,13 @@ Node* CodeAssembler::TailCallBytecodeDispatch(
   return raw_assembler_->TailCallN(descriptor, code_target_address, args);
 }
 
+Node* CodeAssembler::CallCFunction1(MachineType return_type,
+                                    MachineType arg0_type, Node* function,
+                                    Node* arg0) {
+  return raw_assembler_->CallCFunction1(return_type, arg0_type, function,
+                                        arg0);
+}
+
 Node* CodeAssembler::CallJS(Callable const& callable, Node* context,
                             Node* function, Node* receiver,
                             size_t result_size) {
@@ -399,6 +399,10 @@ class CodeAssembler {
   Node* TailCallBytecodeDispatch(const CallInterfaceDescriptor& descriptor,
                                  Node* code_target_address, Node** args);
 
+  // Call to a C function with one argument.
+  Node* CallCFunction1(MachineType return_type, MachineType arg0_type,
+                       Node* function, Node* arg0);
+
   Node* CallJS(Callable const& callable, Node* context, Node* function,
                Node* receiver, size_t result_size = 1);
   Node* CallJS(Callable const& callable, Node* context, Node* function,
@@ -6,6 +6,7 @@
 
 #include "src/address-map.h"
 #include "src/base/adapters.h"
+#include "src/base/functional.h"
 #include "src/compiler/code-generator-impl.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/pipeline.h"
@@ -51,6 +52,7 @@ CodeGenerator::CodeGenerator(Frame* frame, Linkage* linkage,
       deoptimization_literals_(code->zone()),
       inlined_function_count_(0),
       translations_(code->zone()),
+      translation_cache_(code->zone()),
       last_lazy_deopt_pc_(0),
       jump_tables_(nullptr),
       ools_(nullptr),
@@ -797,10 +799,42 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, &translation,
                                           state_combine);
 
+  // Identical frame states serialize to identical translations, since the
+  // deoptimization literals are deduplicated as well. Reuse a previously
+  // emitted translation in that case instead of growing the translation
+  // buffer; deopt points sharing a checkpoint are common, so this shrinks
+  // the deoptimization data considerably.
+  int translation_index = translation.index();
+  {
+    int const length = translations_.CurrentIndex() - translation_index;
+    size_t hash = base::hash_value(length);
+    for (int i = 0; i < length; ++i) {
+      hash = base::hash_combine(hash, translations_.at(translation_index + i));
+    }
+    auto it = translation_cache_.find(hash);
+    if (it == translation_cache_.end()) {
+      translation_cache_.insert({hash, {translation_index, length}});
+    } else if (it->second.second == length) {
+      int const cached_index = it->second.first;
+      bool identical = true;
+      for (int i = 0; i < length; ++i) {
+        if (translations_.at(cached_index + i) !=
+            translations_.at(translation_index + i)) {
+          identical = false;
+          break;
+        }
+      }
+      if (identical) {
+        translations_.Rewind(translation_index);
+        translation_index = cached_index;
+      }
+    }
+  }
+
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset,
+      descriptor->bailout_id(), translation_index, pc_offset,
       entry.reason()));
 
   return deoptimization_id;
@@ -275,6 +275,9 @@ class CodeGenerator final : public GapResolver::Assembler {
   ZoneDeque<Handle<Object>> deoptimization_literals_;
   size_t inlined_function_count_;
   TranslationBuffer translations_;
+  // Maps the hash of a translation's byte sequence to its start index and
+  // length in {translations_}, for deduplication.
+  ZoneMap<size_t, std::pair<int, int>> translation_cache_;
   int last_lazy_deopt_pc_;
   JumpTable* jump_tables_;
   OutOfLineCode* ools_;
@@ -402,10 +402,49 @@ Reduction JSCallReducer::ReduceJSCallConstruct(Node* node) {
         NodeProperties::ChangeOp(node, javascript()->CreateArray(arity, site));
         return Changed(node);
       }
+    } else if (m.Value()->IsJSBoundFunction()) {
+      Handle<JSBoundFunction> function =
+          Handle<JSBoundFunction>::cast(m.Value());
+      Handle<JSReceiver> bound_target_function(
+          function->bound_target_function(), isolate());
+      Handle<FixedArray> bound_arguments(function->bound_arguments(),
+                                         isolate());
+
+      // Raise a TypeError if the {target} is not a constructor.
+      if (!function->IsConstructor()) {
+        NodeProperties::ReplaceValueInputs(node, target);
+        NodeProperties::ChangeOp(
+            node, javascript()->CallRuntime(Runtime::kThrowCalledNonCallable));
+        return Changed(node);
+      }
+
+      // Patch {node} to use [[BoundTargetFunction]].
+      NodeProperties::ReplaceValueInput(
+          node, jsgraph()->Constant(bound_target_function), 0);
+      // Insert the [[BoundArguments]] for {node}.
+      for (int i = 0; i < bound_arguments->length(); ++i) {
+        node->InsertInput(
+            graph()->zone(), i + 1,
+            jsgraph()->Constant(handle(bound_arguments->get(i), isolate())));
+      }
+      // If {new_target} was the bound function itself, it refers to the
+      // [[BoundTargetFunction]] now (ES6 section 9.4.1.2 [[Construct]]).
+      if (target == new_target) {
+        NodeProperties::ReplaceValueInput(
+            node, jsgraph()->Constant(bound_target_function),
+            arity + bound_arguments->length() + 1);
+      }
+      NodeProperties::ChangeOp(
+          node,
+          javascript()->CallConstruct(p.arity() + bound_arguments->length(),
+                                      p.feedback()));
+      // Try to further reduce the JSCallConstruct {node}.
+      Reduction const reduction = ReduceJSCallConstruct(node);
+      return reduction.Changed() ? reduction : Changed(node);
     }
 
     // Don't mess with other {node}s that have a constant {target}.
-    // TODO(bmeurer): Also support optimizing bound functions and proxies here.
+    // TODO(bmeurer): Also support optimizing proxies here.
     return NoChange();
   }
 
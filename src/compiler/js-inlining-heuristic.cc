@@ -95,6 +95,10 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     }
   }
 
+  // Don't burn inlining budget on call sites that the feedback says are
+  // cold; they only bloat code and instruction cache.
+  if (calls >= 0 && calls < FLAG_min_inlining_calls) return NoChange();
+
   // ---------------------------------------------------------------------------
   // Everything above this line is part of the inlining heuristic.
   // ---------------------------------------------------------------------------
@@ -109,15 +113,28 @@ void JSInliningHeuristic::Finalize() {
   if (candidates_.empty()) return;  // Nothing to do without candidates.
   if (FLAG_trace_turbo_inlining) PrintCandidates();
 
+  // The embedder can override the cumulative budget per isolate.
+  int const budget = info_->isolate()->inlining_budget() > 0
+                         ? info_->isolate()->inlining_budget()
+                         : FLAG_max_inlined_nodes_cumulative;
+
   // We inline at most one candidate in every iteration of the fixpoint.
   // This is to ensure that we don't consume the full inlining budget
   // on things that aren't called very often.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
-    if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) return;
     auto i = candidates_.begin();
     Candidate candidate = *i;
     candidates_.erase(i);
+    // Once the cumulative budget is exhausted, only tiny helpers are still
+    // inlined. For those the call overhead — in particular re-boxing
+    // unboxed arguments such as float64 values into HeapNumbers at the call
+    // boundary — outweighs the code size of the body.
+    if (cumulative_count_ > budget &&
+        candidate.function->shared()->ast_node_count() >
+            FLAG_max_inlined_nodes_small) {
+      continue;
+    }
     // Make sure we don't try to inline dead candidate nodes.
     if (!candidate.node->IsDead()) {
       Reduction r = inliner_.ReduceJSCall(candidate.node, candidate.function);
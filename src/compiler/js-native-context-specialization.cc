@@ -105,7 +105,7 @@ Reduction JSNativeContextSpecialization::ReduceJSLoadContext(Node* node) {
 Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     Node* node, Node* value, MapHandleList const& receiver_maps,
     Handle<Name> name, AccessMode access_mode, LanguageMode language_mode,
-    Node* index) {
+    Node* index, VectorSlotPair const& feedback) {
   DCHECK(node->opcode() == IrOpcode::kJSLoadNamed ||
          node->opcode() == IrOpcode::kJSStoreNamed ||
          node->opcode() == IrOpcode::kJSLoadProperty ||
@@ -154,6 +154,19 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     effect = graph()->NewNode(simplified()->CheckIf(), check, effect, control);
   }
 
+  // Decide whether a failing polymorphic map check should call the generic
+  // IC, which probes the megamorphic stub cache inline, instead of
+  // deoptimizing the whole code object. This keeps the fast paths for the
+  // maps seen so far valid when new maps show up late (e.g. from lazily
+  // loaded code), at the cost of an out-of-line call for those receivers.
+  // The exceptional control projection of the original node cannot be
+  // rewired to the slow-path call, so such sites keep deoptimizing.
+  bool use_stub_cache_fallback =
+      FLAG_turbo_stub_cache_fallback && feedback.IsValid() &&
+      (node->opcode() == IrOpcode::kJSLoadNamed ||
+       node->opcode() == IrOpcode::kJSStoreNamed) &&
+      !NodeProperties::IsExceptionalCall(node);
+
   // Check for the monomorphic cases.
   if (access_infos.size() == 1) {
     PropertyAccessInfo access_info = access_infos.front();
@@ -236,7 +249,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
           Node* check =
               graph()->NewNode(simplified()->ReferenceEqual(), receiver_map,
                                jsgraph()->Constant(map));
-          if (--num_classes == 0 && j == access_infos.size() - 1) {
+          if (--num_classes == 0 && j == access_infos.size() - 1 &&
+              !use_stub_cache_fallback) {
             check = graph()->NewNode(simplified()->CheckIf(), check,
                                      this_effect, fallthrough_control);
             this_controls.push_back(fallthrough_control);
@@ -293,6 +307,57 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
       controls.push_back(continuation.control());
     }
 
+    if (use_stub_cache_fallback) {
+      // Receivers with a map that was not seen by the IC take the slow path
+      // through the generic IC, which probes the megamorphic stub cache,
+      // instead of deoptimizing. This keeps the optimized code alive when
+      // new receiver maps show up after optimization.
+      Node* slow_control = fallthrough_control;
+      Node* slow_effect = effect;
+      fallthrough_control = nullptr;
+
+      // Load the type feedback vector from the closure.
+      Node* closure = NodeProperties::GetValueInput(
+          node, node->opcode() == IrOpcode::kJSLoadNamed ? 1 : 2);
+      Node* literals = slow_effect = graph()->NewNode(
+          simplified()->LoadField(AccessBuilder::ForJSFunctionLiterals()),
+          closure, slow_effect, slow_control);
+      Node* vector = slow_effect = graph()->NewNode(
+          simplified()->LoadField(
+              AccessBuilder::ForLiteralsArrayFeedbackVector()),
+          literals, slow_effect, slow_control);
+      Node* slot = jsgraph()->SmiConstant(feedback.index());
+      Node* name_constant = jsgraph()->HeapConstant(name);
+
+      Node* slow_value;
+      if (access_mode == AccessMode::kLoad) {
+        Callable callable = CodeFactory::LoadICInOptimizedCode(isolate());
+        CallDescriptor* desc = Linkage::GetStubCallDescriptor(
+            isolate(), graph()->zone(), callable.descriptor(), 0,
+            CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+        Node* stub_code = jsgraph()->HeapConstant(callable.code());
+        slow_value = slow_effect = graph()->NewNode(
+            common()->Call(desc), stub_code, receiver, name_constant, slot,
+            vector, context, frame_state_lazy, slow_effect, slow_control);
+      } else {
+        DCHECK_EQ(AccessMode::kStore, access_mode);
+        Callable callable =
+            CodeFactory::StoreICInOptimizedCode(isolate(), language_mode);
+        CallDescriptor* desc = Linkage::GetStubCallDescriptor(
+            isolate(), graph()->zone(), callable.descriptor(), 0,
+            CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+        Node* stub_code = jsgraph()->HeapConstant(callable.code());
+        slow_effect = graph()->NewNode(common()->Call(desc), stub_code,
+                                       receiver, name_constant, value, slot,
+                                       vector, context, frame_state_lazy,
+                                       slow_effect, slow_control);
+        slow_value = value;
+      }
+      values.push_back(slow_value);
+      effects.push_back(slow_effect);
+      controls.push_back(slow_control);
+    }
+
     DCHECK_NULL(fallthrough_control);
 
     // Generate the final merge point for all (polymorphic) branches.
@@ -354,7 +419,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccessFromNexus(
 
   // Try to lower the named access based on the {receiver_maps}.
   return ReduceNamedAccess(node, value, receiver_maps, name, access_mode,
-                           language_mode);
+                           language_mode, nullptr,
+                           VectorSlotPair(nexus.vector_handle(), nexus.slot()));
 }
 
 
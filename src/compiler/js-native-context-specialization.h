@@ -7,6 +7,7 @@
 
 #include "src/base/flags.h"
 #include "src/compiler/graph-reducer.h"
+#include "src/compiler/js-operator.h"
 #include "src/deoptimize-reason.h"
 
 namespace v8 {
@@ -78,7 +79,8 @@ class JSNativeContextSpecialization final : public AdvancedReducer {
                               MapHandleList const& receiver_maps,
                               Handle<Name> name, AccessMode access_mode,
                               LanguageMode language_mode,
-                              Node* index = nullptr);
+                              Node* index = nullptr,
+                              VectorSlotPair const& feedback = VectorSlotPair());
 
   Reduction ReduceSoftDeoptimize(Node* node, DeoptimizeReason reason);
 
@@ -59,7 +59,8 @@ void CreateSplinter(TopLevelLiveRange *range, RegisterAllocationData *data,
 }
 
 
-void SplinterLiveRange(TopLevelLiveRange *range, RegisterAllocationData *data) {
+void SplinterLiveRange(TopLevelLiveRange *range, RegisterAllocationData *data,
+                       const ZoneVector<int> &deferred_prefix_count) {
   const InstructionSequence *code = data->code();
   UseInterval *interval = range->first_interval();
 
@@ -74,6 +75,21 @@ void SplinterLiveRange(TopLevelLiveRange *range, RegisterAllocationData *data) {
         code->GetInstructionBlock(interval->LastGapIndex());
     int first_block_nr = first_block->rpo_number().ToInt();
     int last_block_nr = last_block->rpo_number().ToInt();
+    if (deferred_prefix_count[last_block_nr + 1] ==
+        deferred_prefix_count[first_block_nr]) {
+      // The interval spans no deferred code at all. The only effect walking
+      // its blocks could have is to cut off a splinter pending from an
+      // earlier interval, so do just that and move on. This turns the
+      // common case - long ranges in large functions with few deferred
+      // blocks - from a walk over all covered blocks into a single lookup.
+      if (first_cut.IsValid()) {
+        CreateSplinter(range, data, first_cut, last_cut);
+        first_cut = LifetimePosition::Invalid();
+        last_cut = LifetimePosition::Invalid();
+      }
+      interval = next_interval;
+      continue;
+    }
     for (int block_id = first_block_nr; block_id <= last_block_nr; ++block_id) {
       const InstructionBlock *current_block =
           code->InstructionBlockAt(RpoNumber::FromInt(block_id));
@@ -104,6 +120,21 @@ void SplinterLiveRange(TopLevelLiveRange *range, RegisterAllocationData *data) {
 
 
 void LiveRangeSeparator::Splinter() {
+  const InstructionSequence *code = data()->code();
+  int const block_count = code->InstructionBlockCount();
+  // Compute the number of deferred blocks preceding each block in RPO order,
+  // so that intervals covering no deferred code can be detected with two
+  // lookups instead of a walk over all their blocks.
+  ZoneVector<int> deferred_prefix_count(block_count + 1, 0, zone());
+  for (int block_id = 0; block_id < block_count; ++block_id) {
+    const InstructionBlock *block =
+        code->InstructionBlockAt(RpoNumber::FromInt(block_id));
+    deferred_prefix_count[block_id + 1] =
+        deferred_prefix_count[block_id] + (block->IsDeferred() ? 1 : 0);
+  }
+  // Without any deferred blocks there is nothing to splinter.
+  if (deferred_prefix_count[block_count] == 0) return;
+
   size_t virt_reg_count = data()->live_ranges().size();
   for (size_t vreg = 0; vreg < virt_reg_count; ++vreg) {
     TopLevelLiveRange *range = data()->live_ranges()[vreg];
@@ -111,8 +142,8 @@ void LiveRangeSeparator::Splinter() {
       continue;
     }
     int first_instr = range->first_interval()->FirstGapIndex();
-    if (!data()->code()->GetInstructionBlock(first_instr)->IsDeferred()) {
-      SplinterLiveRange(range, data());
+    if (!code->GetInstructionBlock(first_instr)->IsDeferred()) {
+      SplinterLiveRange(range, data(), deferred_prefix_count);
     }
   }
 }
@@ -527,7 +527,8 @@ PipelineStatistics* CreatePipelineStatistics(CompilationInfo* info,
                                              ZonePool* zone_pool) {
   PipelineStatistics* pipeline_statistics = nullptr;
 
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+      FLAG_turbo_stats_json_file != nullptr) {
     pipeline_statistics = new PipelineStatistics(info, zone_pool);
     pipeline_statistics->BeginPhaseKind("initializing");
   }
@@ -1636,7 +1637,8 @@ Handle<Code> Pipeline::GenerateCodeForCodeStub(Isolate* isolate,
   ZonePool zone_pool(isolate->allocator());
   PipelineData data(&zone_pool, &info, graph, schedule);
   std::unique_ptr<PipelineStatistics> pipeline_statistics;
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+      FLAG_turbo_stats_json_file != nullptr) {
     pipeline_statistics.reset(new PipelineStatistics(&info, &zone_pool));
     pipeline_statistics->BeginPhaseKind("stub codegen");
   }
@@ -1690,7 +1692,8 @@ Handle<Code> Pipeline::GenerateCodeForTesting(CompilationInfo* info,
   ZonePool zone_pool(info->isolate()->allocator());
   PipelineData data(&zone_pool, info, graph, schedule);
   std::unique_ptr<PipelineStatistics> pipeline_statistics;
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+      FLAG_turbo_stats_json_file != nullptr) {
     pipeline_statistics.reset(new PipelineStatistics(info, &zone_pool));
     pipeline_statistics->BeginPhaseKind("test codegen");
   }
@@ -1743,6 +1746,10 @@ bool PipelineImpl::ScheduleAndSelectInstructions(Linkage* linkage) {
   if (data->schedule() == nullptr) Run<ComputeSchedulePhase>();
   TraceSchedule(data->info(), data->schedule());
 
+  if (FLAG_turbo_profile_guided_layout) {
+    BasicBlockInstrumentor::MarkColdBlocks(info(), data->schedule());
+  }
+
   if (FLAG_turbo_profiling) {
     data->set_profiler_data(BasicBlockInstrumentor::Instrument(
         info(), data->graph(), data->schedule()));
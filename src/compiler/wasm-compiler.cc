@@ -2721,6 +2721,14 @@ void WasmGraphBuilder::BoundsCheckMem(MachineType memtype, Node* index,
                                       uint32_t offset,
                                       wasm::WasmCodePosition position) {
   DCHECK(module_ && module_->instance);
+  if (wasm::EnableGuardRegions() &&
+      module_->module->origin == wasm::kWasmOrigin) {
+    // The memory is allocated inside a full guard region (see
+    // wasm::NewArrayBuffer): any 32-bit index plus 32-bit constant offset
+    // computes an address within the reservation, so out-of-bounds accesses
+    // fault on the uncommitted pages instead of needing an explicit check.
+    return;
+  }
   uint32_t size = module_->instance->mem_size;
   byte memsize = wasm::WasmOpcodes::MemSize(memtype);
 
@@ -560,5 +560,39 @@ void Context::IncrementErrorsThrown() {
 
 int Context::GetErrorsThrown() { return errors_thrown()->value(); }
 
+
+void Context::AddAllocatedBytes(int size_in_bytes) {
+  DCHECK(IsNativeContext());
+  DCHECK_GE(size_in_bytes, 0);
+
+  int previous_value = allocated_bytes()->value();
+  if (previous_value > Smi::kMaxValue - size_in_bytes) {
+    set_allocated_bytes(Smi::FromInt(Smi::kMaxValue));
+  } else {
+    set_allocated_bytes(Smi::FromInt(previous_value + size_in_bytes));
+  }
+}
+
+
+size_t Context::GetAllocatedBytes() {
+  DCHECK(IsNativeContext());
+  return static_cast<size_t>(allocated_bytes()->value());
+}
+
+
+void Context::SetAllocationLimit(size_t limit) {
+  DCHECK(IsNativeContext());
+  if (limit > static_cast<size_t>(Smi::kMaxValue)) {
+    limit = static_cast<size_t>(Smi::kMaxValue);
+  }
+  set_allocation_limit(Smi::FromInt(static_cast<int>(limit)));
+}
+
+
+size_t Context::GetAllocationLimit() {
+  DCHECK(IsNativeContext());
+  return static_cast<size_t>(allocation_limit()->value());
+}
+
 }  // namespace internal
 }  // namespace v8
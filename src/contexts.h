@@ -105,6 +105,8 @@ enum ContextLookupFlags {
   /* Below is alpha-sorted */                                                  \
   V(ACCESSOR_PROPERTY_DESCRIPTOR_MAP_INDEX, Map,                               \
     accessor_property_descriptor_map)                                          \
+  V(ALLOCATED_BYTES_INDEX, Smi, allocated_bytes)                               \
+  V(ALLOCATION_LIMIT_INDEX, Smi, allocation_limit)                             \
   V(ALLOW_CODE_GEN_FROM_STRINGS_INDEX, Object, allow_code_gen_from_strings)    \
   V(ARRAY_BUFFER_FUN_INDEX, JSFunction, array_buffer_fun)                      \
   V(ARRAY_BUFFER_MAP_INDEX, Map, array_buffer_map)                             \
@@ -370,6 +372,14 @@ class Context: public FixedArray {
   void IncrementErrorsThrown();
   int GetErrorsThrown();
 
+  // Per-native-context allocation accounting. The counter is maintained by
+  // Heap::OnAllocationEvent when --track-context-allocation is on and
+  // saturates at Smi::kMaxValue. The limit is 0 when unset.
+  void AddAllocatedBytes(int size_in_bytes);
+  size_t GetAllocatedBytes();
+  void SetAllocationLimit(size_t limit);
+  size_t GetAllocationLimit();
+
   // Direct slot access.
   inline JSFunction* closure();
   inline void set_closure(JSFunction* closure);
@@ -494,6 +494,122 @@ double InternalStringToInt(UnicodeCache* unicode_cache,
 }
 
 
+// Returns a pointer to the first character in [cursor, end) that is not a
+// decimal digit. Checks eight characters at a time so that long digit runs
+// do not pay the per-character dispatch of the generic conversion loop.
+inline const uint8_t* ScanDecimalDigits(const uint8_t* cursor,
+                                        const uint8_t* end) {
+  while (end - cursor >= 8) {
+    uint64_t chunk;
+    memcpy(&chunk, cursor, sizeof(chunk));
+    // All eight bytes are in ['0'..'9'] exactly when every high nibble is 3
+    // and adding 6 to the low nibbles does not carry into the high ones.
+    if (((chunk & V8_2PART_UINT64_C(0xF0F0F0F0, F0F0F0F0)) |
+         (((chunk + V8_2PART_UINT64_C(0x06060606, 06060606)) &
+           V8_2PART_UINT64_C(0xF0F0F0F0, F0F0F0F0)) >>
+          4)) != V8_2PART_UINT64_C(0x33333333, 33333333)) {
+      break;
+    }
+    cursor += 8;
+  }
+  while (cursor != end && *cursor >= '0' && *cursor <= '9') cursor++;
+  return cursor;
+}
+
+
+// Fast case of InternalStringToDouble for flat one-byte input of the shape
+// an optional sign, decimal digits, an optional fraction and an optional
+// exponent, with no whitespace, no redundant leading zeros in the integer
+// part and nothing else before the end of the string. Digit runs are scanned
+// eight characters at a time and handed to Strtod in one piece, whose fast
+// case then converts short mantissas exactly via powers of ten. Returns
+// false when the input does not have this shape, in which case the caller
+// takes the generic path. The result is flag-independent: inputs for which
+// ALLOW_HEX and friends could matter do not match the shape.
+inline bool FastStringToDouble(const uint8_t* current, const uint8_t* end,
+                               double* result) {
+  // Beyond this many digits the conversion needs the bignum fallback anyway.
+  const int kMaxFastDigits = 32;
+
+  if (current == end) return false;
+  bool negative = false;
+  if (*current == '+' || *current == '-') {
+    negative = (*current == '-');
+    ++current;
+    if (current == end) return false;
+  }
+
+  const uint8_t* integer_start = current;
+  current = ScanDecimalDigits(current, end);
+  int integer_digits = static_cast<int>(current - integer_start);
+  // A redundant leading zero is either junk or the start of a hex, octal,
+  // binary or implicit-octal form; all need the checks of the generic path.
+  if (integer_digits > 1 && *integer_start == '0') return false;
+
+  const uint8_t* fraction_start = NULL;
+  int fraction_digits = 0;
+  if (current != end && *current == '.') {
+    ++current;
+    fraction_start = current;
+    current = ScanDecimalDigits(current, end);
+    fraction_digits = static_cast<int>(current - fraction_start);
+    if (fraction_digits == 0) return false;
+  }
+
+  int significant_digits = integer_digits + fraction_digits;
+  if (significant_digits == 0 || significant_digits > kMaxFastDigits) {
+    return false;
+  }
+
+  int exponent = 0;
+  if (current != end && (*current == 'e' || *current == 'E')) {
+    ++current;
+    bool exponent_negative = false;
+    if (current != end && (*current == '+' || *current == '-')) {
+      exponent_negative = (*current == '-');
+      ++current;
+    }
+    const uint8_t* exponent_start = current;
+    while (current != end && *current >= '0' && *current <= '9') {
+      exponent = exponent * 10 + (*current - '0');
+      // Exponents this large need the clamping of the generic path.
+      if (exponent > 100000) return false;
+      ++current;
+    }
+    if (current == exponent_start) return false;
+    if (exponent_negative) exponent = -exponent;
+  }
+
+  // Anything left over (trailing junk, whitespace, a base prefix) is for the
+  // generic path to decide on.
+  if (current != end) return false;
+
+  char digits[kMaxFastDigits];
+  MemCopy(digits, integer_start, integer_digits);
+  if (fraction_digits > 0) {
+    MemCopy(digits + integer_digits, fraction_start, fraction_digits);
+    exponent -= fraction_digits;
+  }
+
+  // Strtod expects the significant digits without leading zeros; dropping
+  // them does not change the value.
+  const char* digits_start = digits;
+  const char* digits_end = digits + significant_digits;
+  while (digits_start != digits_end && *digits_start == '0') ++digits_start;
+  if (digits_start == digits_end) {
+    *result = SignedZero(negative);
+    return true;
+  }
+
+  double converted =
+      Strtod(Vector<const char>(digits_start,
+                                static_cast<int>(digits_end - digits_start)),
+             exponent);
+  *result = negative ? -converted : converted;
+  return true;
+}
+
+
 // Converts a string to a double value. Assumes the Iterator supports
 // the following operations:
 // 1. current == end (other ops are not allowed), current != end.
@@ -74,6 +74,8 @@ double StringToDouble(UnicodeCache* unicode_cache,
   // InternalStringToDouble() template for const char* as well.
   const uint8_t* start = reinterpret_cast<const uint8_t*>(str);
   const uint8_t* end = start + StrLength(str);
+  double result;
+  if (FastStringToDouble(start, end, &result)) return result;
   return InternalStringToDouble(unicode_cache, start, end, flags,
                                 empty_string_val);
 }
@@ -87,6 +89,8 @@ double StringToDouble(UnicodeCache* unicode_cache,
   // InternalStringToDouble() template for const char* as well.
   const uint8_t* start = reinterpret_cast<const uint8_t*>(str.start());
   const uint8_t* end = start + str.length();
+  double result;
+  if (FastStringToDouble(start, end, &result)) return result;
   return InternalStringToDouble(unicode_cache, start, end, flags,
                                 empty_string_val);
 }
@@ -25,9 +25,67 @@ int* StatsCounter::FindLocationInStatsTable() const {
 }
 
 
+void StatsCounter::AddDelta(int value) {
+  if (GetPtr() == NULL) return;
+  // Accumulate into a per-thread cell instead of the embedder's cell so
+  // counter traffic from GC and compiler threads does not bounce a shared
+  // cache line; FlushShards folds the deltas back.
+  int shard = ThreadId::Current().ToInteger() & (kShardCount - 1);
+  base::NoBarrier_AtomicIncrement(&shards_[shard].value, value);
+}
+
+
+void StatsCounter::FlushShards() {
+  int* loc = GetPtr();
+  if (loc == NULL) return;
+  int sum = 0;
+  for (int i = 0; i < kShardCount; i++) {
+    sum += base::NoBarrier_AtomicExchange(&shards_[i].value, 0);
+  }
+  if (sum != 0) *loc += sum;
+}
+
+
+int Histogram::TakeBufferedSamples(int* samples) {
+  while (base::Acquire_CompareAndSwap(&sample_buffer_lock_, 0, 1) != 0) {
+    // Spin; the buffer is only held for a few stores.
+  }
+  int count = sample_buffer_count_;
+  MemCopy(samples, sample_buffer_, count * sizeof(*samples));
+  sample_buffer_count_ = 0;
+  base::Release_Store(&sample_buffer_lock_, 0);
+  return count;
+}
+
+
 void Histogram::AddSample(int sample) {
-  if (Enabled()) {
-    isolate()->stats_table()->AddHistogramSample(histogram_, sample);
+  if (!Enabled()) return;
+  int samples[kSampleBufferSize];
+  int count = 0;
+  while (base::Acquire_CompareAndSwap(&sample_buffer_lock_, 0, 1) != 0) {
+    // Spin; the buffer is only held for a few stores.
+  }
+  sample_buffer_[sample_buffer_count_++] = sample;
+  if (sample_buffer_count_ == kSampleBufferSize) {
+    count = sample_buffer_count_;
+    MemCopy(samples, sample_buffer_, count * sizeof(*samples));
+    sample_buffer_count_ = 0;
+  }
+  base::Release_Store(&sample_buffer_lock_, 0);
+  // Forward a full batch outside the lock; the embedder callback dominates
+  // the cost and must not be invoked while other threads wait to record.
+  for (int i = 0; i < count; i++) {
+    isolate()->stats_table()->AddHistogramSample(histogram_, samples[i]);
+  }
+}
+
+
+void Histogram::FlushSampleBuffer() {
+  if (histogram_ == NULL) return;
+  int samples[kSampleBufferSize];
+  int count = TakeBufferedSamples(samples);
+  for (int i = 0; i < count; i++) {
+    isolate()->stats_table()->AddHistogramSample(histogram_, samples[i]);
   }
 }
 
@@ -196,6 +254,59 @@ void Counters::ResetHistograms() {
 #undef HM
 }
 
+
+void Counters::FlushPendingStats() {
+#define SC(name, caption) name##_.FlushShards();
+  STATS_COUNTER_LIST_1(SC)
+  STATS_COUNTER_LIST_2(SC)
+#undef SC
+
+#define SC(name)                    \
+  count_of_##name##_.FlushShards(); \
+  size_of_##name##_.FlushShards();
+  INSTANCE_TYPE_LIST(SC)
+#undef SC
+
+#define SC(name)                              \
+  count_of_CODE_TYPE_##name##_.FlushShards(); \
+  size_of_CODE_TYPE_##name##_.FlushShards();
+  CODE_KIND_LIST(SC)
+#undef SC
+
+#define SC(name)                                \
+  count_of_FIXED_ARRAY_##name##_.FlushShards(); \
+  size_of_FIXED_ARRAY_##name##_.FlushShards();
+  FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(SC)
+#undef SC
+
+#define SC(name)                             \
+  count_of_CODE_AGE_##name##_.FlushShards(); \
+  size_of_CODE_AGE_##name##_.FlushShards();
+  CODE_AGE_LIST_COMPLETE(SC)
+#undef SC
+
+#define HR(name, caption, min, max, num_buckets) name##_.FlushSampleBuffer();
+  HISTOGRAM_RANGE_LIST(HR)
+#undef HR
+
+#define HT(name, caption, max, res) name##_.FlushSampleBuffer();
+  HISTOGRAM_TIMER_LIST(HT)
+#undef HT
+
+#define AHT(name, caption) name##_.FlushSampleBuffer();
+  AGGREGATABLE_HISTOGRAM_TIMER_LIST(AHT)
+#undef AHT
+
+#define HP(name, caption) name##_.FlushSampleBuffer();
+  HISTOGRAM_PERCENTAGE_LIST(HP)
+#undef HP
+
+#define HM(name, caption) name##_.FlushSampleBuffer();
+  HISTOGRAM_LEGACY_MEMORY_LIST(HM)
+  HISTOGRAM_MEMORY_LIST(HM)
+#undef HM
+}
+
 class RuntimeCallStatEntries {
  public:
   void Print(std::ostream& os) {
@@ -7,6 +7,7 @@
 
 #include "include/v8.h"
 #include "src/allocation.h"
+#include "src/base/atomicops.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
 #include "src/builtins/builtins.h"
@@ -98,38 +99,35 @@ class StatsTable {
 // thread-specific, this class cannot be shared across threads.
 class StatsCounter {
  public:
-  StatsCounter() { }
+  StatsCounter() { ClearShards(); }
   explicit StatsCounter(Isolate* isolate, const char* name)
-      : isolate_(isolate), name_(name), ptr_(NULL), lookup_done_(false) { }
+      : isolate_(isolate), name_(name), ptr_(NULL), lookup_done_(false) {
+    ClearShards();
+  }
 
   // Sets the counter to a specific value.
   void Set(int value) {
     int* loc = GetPtr();
-    if (loc) *loc = value;
+    if (loc == NULL) return;
+    // Pending per-thread deltas are superseded by the absolute value.
+    ClearShards();
+    *loc = value;
   }
 
   // Increments the counter.
-  void Increment() {
-    int* loc = GetPtr();
-    if (loc) (*loc)++;
-  }
+  void Increment() { AddDelta(1); }
 
-  void Increment(int value) {
-    int* loc = GetPtr();
-    if (loc)
-      (*loc) += value;
-  }
+  void Increment(int value) { AddDelta(value); }
 
   // Decrements the counter.
-  void Decrement() {
-    int* loc = GetPtr();
-    if (loc) (*loc)--;
-  }
+  void Decrement() { AddDelta(-1); }
 
-  void Decrement(int value) {
-    int* loc = GetPtr();
-    if (loc) (*loc) -= value;
-  }
+  void Decrement(int value) { AddDelta(-value); }
+
+  // Fold the pending per-thread deltas into the embedder's counter cell.
+  // Called periodically from the main thread and whenever the raw cell is
+  // handed out, so readers of the cell observe an up-to-date value.
+  void FlushShards();
 
   // Is this counter enabled?
   // Returns false if table is full.
@@ -143,6 +141,7 @@ class StatsCounter {
   int* GetInternalPointer() {
     int* loc = GetPtr();
     DCHECK(loc != NULL);
+    FlushShards();
     return loc;
   }
 
@@ -159,19 +158,38 @@ class StatsCounter {
   }
 
  private:
+  // Counter updates are accumulated in one of a few cache-line-padded cells
+  // selected by the calling thread, so that GC and compiler threads do not
+  // bounce the embedder's cell between caches. The deltas are folded into
+  // the embedder's cell by FlushShards.
+  static const int kShardCount = 4;  // Must be a power of two.
+  struct Shard {
+    base::Atomic32 value;
+    char padding[PROCESSOR_CACHE_LINE_SIZE - sizeof(base::Atomic32)];
+  };
+
+  void AddDelta(int value);
+
+  void ClearShards() {
+    for (int i = 0; i < kShardCount; i++) {
+      base::NoBarrier_Store(&shards_[i].value, 0);
+    }
+  }
+
   int* FindLocationInStatsTable() const;
 
   Isolate* isolate_;
   const char* name_;
   int* ptr_;
   bool lookup_done_;
+  Shard shards_[kShardCount];
 };
 
 // A Histogram represents a dynamically created histogram in the StatsTable.
 // It will be registered with the histogram system on first use.
 class Histogram {
  public:
-  Histogram() { }
+  Histogram() : sample_buffer_lock_(0), sample_buffer_count_(0) {}
   Histogram(const char* name,
             int min,
             int max,
@@ -183,11 +201,19 @@ class Histogram {
         num_buckets_(num_buckets),
         histogram_(NULL),
         lookup_done_(false),
-        isolate_(isolate) { }
+        isolate_(isolate),
+        sample_buffer_lock_(0),
+        sample_buffer_count_(0) {}
 
-  // Add a single sample to this histogram.
+  // Add a single sample to this histogram. Samples are buffered and only
+  // forwarded to the embedder in batches, so the callback crossing is paid
+  // once per batch instead of once per sample.
   void AddSample(int sample);
 
+  // Forward any buffered samples to the embedder. Called periodically from
+  // the main thread so buffered samples do not go stale.
+  void FlushSampleBuffer();
+
   // Returns true if this histogram is enabled.
   bool Enabled() {
     return GetHistogram() != NULL;
@@ -213,8 +239,14 @@ class Histogram {
   Isolate* isolate() const { return isolate_; }
 
  private:
+  static const int kSampleBufferSize = 16;
+
   void* CreateHistogram() const;
 
+  // Drain the sample buffer into |samples| under the buffer lock. Returns
+  // the number of samples drained.
+  int TakeBufferedSamples(int* samples);
+
   const char* name_;
   int min_;
   int max_;
@@ -222,6 +254,11 @@ class Histogram {
   void* histogram_;
   bool lookup_done_;
   Isolate* isolate_;
+  // Buffered samples not yet forwarded to the embedder, guarded by the
+  // spinlock below (a full mutex would make the class non-assignable).
+  base::Atomic32 sample_buffer_lock_;
+  int sample_buffer_count_;
+  int sample_buffer_[kSampleBufferSize];
 };
 
 // A HistogramTimer allows distributions of results to be created.
@@ -544,6 +581,7 @@ class RuntimeCallTimer {
   V(Float32Array_New)                                      \
   V(Float64Array_New)                                      \
   V(Function_Call)                                         \
+  V(Function_CallBatch)                                    \
   V(Function_New)                                          \
   V(Function_NewInstance)                                  \
   V(FunctionTemplate_GetFunction)                          \
@@ -572,6 +610,7 @@ class RuntimeCallTimer {
   V(Object_CallAsFunction)                                 \
   V(Object_CreateDataProperty)                             \
   V(Object_DefineOwnProperty)                              \
+  V(Object_DefineProperties)                               \
   V(Object_Delete)                                         \
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
@@ -638,6 +677,8 @@ class RuntimeCallTimer {
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
+  V(StringBuilder_Finish)                                  \
+  V(StringBuilder_New)                                     \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
@@ -740,6 +781,14 @@ class RuntimeCallTimer {
   V(StoreIC_StoreTransition)                    \
   V(StoreIC_StoreViaSetter)
 
+// Per-isolate table of call counts and self-times, bucketed per runtime
+// function, C++ builtin, API entry point and IC handler. Activated with
+// --runtime-call-stats; when the flag is off the scopes compile down to a
+// single predicted-untaken branch, so the instrumentation can ship enabled.
+// Embedders that want a per-request breakdown can call the intrinsic
+// %GetAndResetRuntimeCallStats with --allow-natives-syntax. Timings come
+// from ElapsedTimer, i.e. the monotonic clock, which on the relevant
+// platforms is itself a scaled TSC read in user space.
 class RuntimeCallStats {
  public:
   typedef RuntimeCallCounter RuntimeCallStats::*CounterId;
@@ -932,6 +981,8 @@ class RuntimeCallTimerScope {
   SC(global_handles, V8.GlobalHandles)                                \
   /* OS Memory allocated */                                           \
   SC(memory_allocated, V8.OsMemoryAllocated)                          \
+  /* Heap memory advised for huge page backing, in KB */              \
+  SC(huge_pages_advised_kb, V8.HugePagesAdvisedKB)                    \
   SC(maps_normalized, V8.MapsNormalized)                            \
   SC(maps_created, V8.MapsCreated)                                  \
   SC(elements_transitions, V8.ObjectElementsTransitions)            \
@@ -1169,6 +1220,11 @@ class Counters {
 
   void ResetCounters();
   void ResetHistograms();
+
+  // Fold the per-thread stats counter deltas into the embedder's cells and
+  // forward buffered histogram samples. Called periodically from the main
+  // thread so pending telemetry does not go stale.
+  void FlushPendingStats();
   RuntimeCallStats* runtime_call_stats() { return &runtime_call_stats_; }
 
  private:
@@ -8313,6 +8313,55 @@ int HOptimizedGraphBuilder::InliningAstSize(Handle<JSFunction> target) {
   return nodes_added;
 }
 
+
+HValue* HOptimizedGraphBuilder::BuildInlinedRestArray(
+    HEnvironment* arguments_env, int formal_parameter_count,
+    Handle<JSFunction> target) {
+  NoObservableSideEffectsScope no_effects(this);
+
+  // Arguments in the environment start after the receiver at index 1.
+  int first_rest_index = 1 + formal_parameter_count;
+  int length = arguments_env->parameter_count() - first_rest_index;
+  if (length < 0) length = 0;
+
+  // Allocate and initialize the elements backing store.
+  HValue* elements;
+  if (length == 0) {
+    elements = Add<HConstant>(isolate()->factory()->empty_fixed_array());
+  } else {
+    elements =
+        Add<HAllocate>(Add<HConstant>(FixedArray::SizeFor(length)),
+                       HType::HeapObject(), NOT_TENURED, FIXED_ARRAY_TYPE,
+                       graph()->GetConstant0());
+    AddStoreMapConstant(elements, isolate()->factory()->fixed_array_map());
+    Add<HStoreNamedField>(elements, HObjectAccess::ForFixedArrayLength(),
+                          Add<HConstant>(length));
+    for (int i = 0; i < length; i++) {
+      Add<HStoreKeyed>(elements, Add<HConstant>(i),
+                       arguments_env->Lookup(first_rest_index + i), nullptr,
+                       FAST_ELEMENTS);
+    }
+  }
+
+  // Allocate the JSArray. The map is statically known from the target's
+  // native context.
+  HValue* result =
+      Add<HAllocate>(Add<HConstant>(JSArray::kSize), HType::JSArray(),
+                     NOT_TENURED, JS_ARRAY_TYPE, graph()->GetConstant0());
+  Handle<Map> array_map(
+      target->context()->native_context()->js_array_fast_elements_map_index(),
+      isolate());
+  AddStoreMapConstant(result, array_map);
+  Add<HStoreNamedField>(
+      result, HObjectAccess::ForPropertiesPointer(),
+      Add<HConstant>(isolate()->factory()->empty_fixed_array()));
+  Add<HStoreNamedField>(result, HObjectAccess::ForElementsPointer(), elements);
+  Add<HStoreNamedField>(result, HObjectAccess::ForArrayLength(FAST_ELEMENTS),
+                        Add<HConstant>(length));
+  return result;
+}
+
+
 bool HOptimizedGraphBuilder::TryInline(Handle<JSFunction> target,
                                        int arguments_count,
                                        HValue* implicit_return_value,
@@ -8404,8 +8453,12 @@ bool HOptimizedGraphBuilder::TryInline(Handle<JSFunction> target,
     return false;
   }
 
-  if (target_info.scope()->rest_parameter() != nullptr) {
-    TraceInline(target, caller, "target uses rest parameters");
+  // Rest parameters are supported by materializing the rest array at the
+  // call site (see BuildInlinedRestArray), but only when the rest variable
+  // lives on the stack.
+  if (target_info.scope()->rest_parameter() != nullptr &&
+      !target_info.scope()->rest_parameter()->IsStackAllocated()) {
+    TraceInline(target, caller, "target has allocated rest parameter");
     return false;
   }
 
@@ -8513,6 +8566,16 @@ bool HOptimizedGraphBuilder::TryInline(Handle<JSFunction> target,
     inner_env->Bind(function->scope()->arguments(), arguments_object);
   }
 
+  // If the function has a rest parameter, materialize the rest array from
+  // the statically known surplus arguments and bind it. The allocation is
+  // removed again by the escape analysis phase if the array does not escape.
+  if (function->scope()->rest_parameter() != nullptr) {
+    DCHECK(function->scope()->rest_parameter()->IsStackAllocated());
+    HValue* rest_array = BuildInlinedRestArray(
+        arguments_env, function->scope()->num_parameters(), target);
+    inner_env->Bind(function->scope()->rest_parameter(), rest_array);
+  }
+
   // Capture the state before invoking the inlined function for deopt in the
   // inlined function. This simulate has no bailout-id since it's not directly
   // reachable for deopt, and is only used to capture the state. If the simulate
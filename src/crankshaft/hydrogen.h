@@ -2458,6 +2458,15 @@ class HOptimizedGraphBuilder : public HGraphBuilder,
       BailoutId ast_id, BailoutId return_id, HValue* object, HValue* value,
       SmallMapList* types, Handle<Name> name);
 
+  // Materializes the rest array for an inlined function with a rest
+  // parameter. The argument count is statically known at an inlined call
+  // site, so the array and its backing store are allocated inline; when the
+  // array does not escape, the escape analysis phase removes the allocation
+  // again, making the rest parameter effectively stack allocated.
+  HValue* BuildInlinedRestArray(HEnvironment* arguments_env,
+                                int formal_parameter_count,
+                                Handle<JSFunction> target);
+
   HValue* BuildAllocateExternalElements(
       ExternalArrayType array_type,
       bool is_zero_byte_offset,
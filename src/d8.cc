@@ -9,6 +9,7 @@
 #endif
 
 #include <errno.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
@@ -20,6 +21,7 @@
 #ifndef V8_SHARED
 #include <algorithm>
 #include <fstream>
+#include <map>
 #include <vector>
 #endif  // !V8_SHARED
 
@@ -37,6 +39,7 @@
 #include "include/libplatform/libplatform.h"
 #include "include/libplatform/v8-tracing.h"
 #ifndef V8_SHARED
+#include "src/api-trace.h"
 #include "src/api.h"
 #include "src/base/cpu.h"
 #include "src/base/debug/stack_trace.h"
@@ -376,6 +379,7 @@ base::OS::MemoryMappedFile* Shell::counters_file_ = NULL;
 CounterCollection Shell::local_counters_;
 CounterCollection* Shell::counters_ = &local_counters_;
 base::LazyMutex Shell::context_mutex_;
+base::LazyMutex Shell::counter_mutex_;
 const base::TimeTicks Shell::kInitialTicks =
     base::TimeTicks::HighResolutionNow();
 Global<Function> Shell::stringify_function_;
@@ -1147,6 +1151,7 @@ int CounterMap::Hash(const char* name) {
 
 
 Counter* Shell::GetCounter(const char* name, bool is_histogram) {
+  base::LockGuard<base::Mutex> lock_guard(counter_mutex_.Pointer());
   Counter* counter = counter_map_->Lookup(name);
 
   if (counter == NULL) {
@@ -2122,6 +2127,40 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
       options.trace_config = argv[i] + 15;
       argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark-manifest=", 21) == 0) {
+      options.benchmark_manifest = argv[i] + 21;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark-runs=", 17) == 0) {
+      options.benchmark_runs = atoi(argv[i] + 17);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark-warmup=", 19) == 0) {
+      options.benchmark_warmup = atoi(argv[i] + 19);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--load-script=", 14) == 0) {
+#ifdef V8_SHARED
+      printf("D8 with shared library does not support multi-threading\n");
+      return false;
+#else
+      options.load_script = argv[i] + 14;
+      argv[i] = NULL;
+#endif  // V8_SHARED
+    } else if (strncmp(argv[i], "--load-isolates=", 16) == 0) {
+      options.load_isolates = atoi(argv[i] + 16);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--load-requests=", 16) == 0) {
+      options.load_requests = atoi(argv[i] + 16);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--load-rate=", 12) == 0) {
+      options.load_rate = strtod(argv[i] + 12, NULL);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--replay-trace=", 15) == 0) {
+#ifdef V8_SHARED
+      printf("D8 with shared library does not support trace replay\n");
+      return false;
+#else
+      options.replay_trace = argv[i] + 15;
+      argv[i] = NULL;
+#endif  // V8_SHARED
     }
   }
 
@@ -2192,6 +2231,704 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
 }
 
 
+namespace {
+
+// Totals accumulated by the GC cycle statistics callback while a benchmark
+// run is being timed.
+int benchmark_gc_cycles = 0;
+double benchmark_gc_total_ms = 0;
+
+void BenchmarkGCCycleCallback(Isolate* isolate,
+                              const GCCycleStatistics& statistics) {
+  benchmark_gc_cycles++;
+  benchmark_gc_total_ms += statistics.end_time() - statistics.start_time();
+}
+
+void PrintJSONString(const char* string) {
+  putchar('"');
+  for (const char* p = string; *p != '\0'; p++) {
+    if (*p == '"' || *p == '\\') putchar('\\');
+    putchar(*p);
+  }
+  putchar('"');
+}
+
+}  // namespace
+
+
+int Shell::RunBenchmarkSuite(Isolate* isolate) {
+  int manifest_size = 0;
+  char* manifest =
+      ReadChars(isolate, options.benchmark_manifest, &manifest_size);
+  if (manifest == NULL) {
+    printf("Error reading benchmark manifest '%s'\n",
+           options.benchmark_manifest);
+    return 1;
+  }
+  const int runs = options.benchmark_runs < 1 ? 1 : options.benchmark_runs;
+  const int warmup =
+      options.benchmark_warmup < 0 ? 0 : options.benchmark_warmup;
+  isolate->SetGCCycleStatisticsCallback(BenchmarkGCCycleCallback);
+  printf("{\n");
+  printf("  \"benchmark_runs\": %d,\n", runs);
+  printf("  \"benchmark_warmup\": %d,\n", warmup);
+  printf("  \"benchmarks\": [");
+  int exit_code = 0;
+  bool first_benchmark = true;
+  char* cursor = manifest;
+  while (cursor < manifest + manifest_size) {
+    char* line = cursor;
+    char* line_end = strchr(line, '\n');
+    if (line_end == NULL) line_end = manifest + manifest_size;
+    cursor = line_end + 1;
+    *line_end = '\0';
+    while (*line == ' ' || *line == '\t') line++;
+    while (line_end > line && (line_end[-1] == ' ' || line_end[-1] == '\t' ||
+                               line_end[-1] == '\r')) {
+      *--line_end = '\0';
+    }
+    // Manifest lines are "<name> <path>"; '#' starts a comment, and a line
+    // with a single token names the benchmark after its script file.
+    if (*line == '\0' || *line == '#') continue;
+    char* name = line;
+    char* path = name;
+    while (*path != '\0' && *path != ' ' && *path != '\t') path++;
+    if (*path != '\0') {
+      *path++ = '\0';
+      while (*path == ' ' || *path == '\t') path++;
+    }
+    if (*path == '\0') path = name;
+
+    std::vector<double> samples;
+#ifndef V8_SHARED
+    std::vector<std::pair<const char*, int32_t>> counters_before;
+#endif  // !V8_SHARED
+    bool failed = false;
+    int gc_cycles = 0;
+    double gc_total_ms = 0;
+    for (int run = 0; run < warmup + runs && !failed; run++) {
+#ifndef V8_SHARED
+      if (run == warmup && i::FLAG_dump_counters) {
+        for (CounterMap::Iterator it(counter_map_); it.More(); it.Next()) {
+          if (it.CurrentValue()->is_histogram()) continue;
+          counters_before.push_back(
+              std::make_pair(it.CurrentKey(), it.CurrentValue()->count()));
+        }
+      }
+#endif  // !V8_SHARED
+      // Give every run a fresh context and a clean heap so that the runs are
+      // independent samples.
+      CollectGarbage(isolate);
+      HandleScope scope(isolate);
+      Local<Context> context = CreateEvaluationContext(isolate);
+      Context::Scope cscope(context);
+      PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+      Local<String> source = ReadFile(isolate, path);
+      if (source.IsEmpty()) {
+        printf("Error reading '%s'\n", path);
+        failed = true;
+        break;
+      }
+      Local<String> file_name =
+          String::NewFromUtf8(isolate, path, NewStringType::kNormal)
+              .ToLocalChecked();
+      benchmark_gc_cycles = 0;
+      benchmark_gc_total_ms = 0;
+      double start = g_platform->MonotonicallyIncreasingTime();
+      bool success = ExecuteString(isolate, source, file_name, false, true);
+      double elapsed_ms =
+          (g_platform->MonotonicallyIncreasingTime() - start) * 1000;
+      EmptyMessageQueues(isolate);
+      if (!success) {
+        failed = true;
+      } else if (run >= warmup) {
+        samples.push_back(elapsed_ms);
+        gc_cycles += benchmark_gc_cycles;
+        gc_total_ms += benchmark_gc_total_ms;
+      }
+    }
+
+    if (!first_benchmark) printf(",");
+    first_benchmark = false;
+    printf("\n    {\n      \"name\": ");
+    PrintJSONString(name);
+    printf(",\n      \"file\": ");
+    PrintJSONString(path);
+    if (failed) {
+      printf(",\n      \"failed\": true\n    }");
+      exit_code = 1;
+      continue;
+    }
+    double mean = 0;
+    for (size_t i = 0; i < samples.size(); i++) mean += samples[i];
+    mean /= samples.size();
+    double stddev = 0;
+    if (samples.size() > 1) {
+      double sum_of_squares = 0;
+      for (size_t i = 0; i < samples.size(); i++) {
+        sum_of_squares += (samples[i] - mean) * (samples[i] - mean);
+      }
+      stddev = sqrt(sum_of_squares / (samples.size() - 1));
+    }
+    double ci95 = 1.96 * stddev / sqrt(static_cast<double>(samples.size()));
+    printf(",\n      \"runs_ms\": [");
+    for (size_t i = 0; i < samples.size(); i++) {
+      printf("%s%.3f", i == 0 ? "" : ", ", samples[i]);
+    }
+    printf("],\n");
+    printf("      \"mean_ms\": %.3f,\n", mean);
+    printf("      \"stddev_ms\": %.3f,\n", stddev);
+    printf("      \"ci95_ms\": %.3f,\n", ci95);
+#ifndef V8_SHARED
+    if (i::FLAG_dump_counters) {
+      printf("      \"counters\": {");
+      bool first_counter = true;
+      for (CounterMap::Iterator it(counter_map_); it.More(); it.Next()) {
+        if (it.CurrentValue()->is_histogram()) continue;
+        int32_t before = 0;
+        for (size_t i = 0; i < counters_before.size(); i++) {
+          if (strcmp(counters_before[i].first, it.CurrentKey()) == 0) {
+            before = counters_before[i].second;
+            break;
+          }
+        }
+        int32_t delta = it.CurrentValue()->count() - before;
+        if (delta == 0) continue;
+        printf("%s\n        ", first_counter ? "" : ",");
+        first_counter = false;
+        PrintJSONString(it.CurrentKey());
+        printf(": %d", delta);
+      }
+      printf("%s},\n", first_counter ? "" : "\n      ");
+    }
+#endif  // !V8_SHARED
+    printf("      \"gc_cycles\": %d,\n", gc_cycles);
+    printf("      \"gc_total_ms\": %.3f\n", gc_total_ms);
+    printf("    }");
+  }
+  printf("\n  ]\n}\n");
+  isolate->SetGCCycleStatisticsCallback(NULL);
+  delete[] manifest;
+  return exit_code;
+}
+
+
+#ifndef V8_SHARED
+namespace {
+
+// One isolate of a load test. The thread owns a private isolate and context,
+// compiles the workload script once, then runs it once per request and
+// records every request latency in milliseconds.
+class LoadTestThread : public base::Thread {
+ public:
+  LoadTestThread(int id, const char* path, int requests, double rate)
+      : base::Thread(base::Thread::Options("LoadTestThread", 2 * MB)),
+        id_(id),
+        path_(path),
+        requests_(requests),
+        rate_(rate),
+        failed_(false) {}
+
+  virtual void Run() {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    if (i::FLAG_dump_counters) {
+      create_params.counter_lookup_callback = Shell::LookupCounter;
+      create_params.create_histogram_callback = Shell::CreateHistogram;
+      create_params.add_histogram_sample_callback = Shell::AddHistogramSample;
+    }
+    Isolate* isolate = Isolate::New(create_params);
+    {
+      Isolate::Scope iscope(isolate);
+      HandleScope scope(isolate);
+      PerIsolateData data(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      Context::Scope cscope(context);
+      PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+      RunRequests(isolate, context);
+    }
+    isolate->Dispose();
+  }
+
+  int id() const { return id_; }
+  bool failed() const { return failed_; }
+  const std::vector<double>& latencies_ms() const { return latencies_ms_; }
+
+ private:
+  void RunRequests(Isolate* isolate, Local<Context> context) {
+    Local<String> source = Shell::ReadFile(isolate, path_);
+    if (source.IsEmpty()) {
+      printf("Error reading '%s'\n", path_);
+      failed_ = true;
+      return;
+    }
+    Local<String> name =
+        String::NewFromUtf8(isolate, path_, NewStringType::kNormal)
+            .ToLocalChecked();
+    Local<Script> script;
+    if (!Shell::CompileString(isolate, source, name,
+                              ScriptCompiler::kNoCompileOptions, Shell::SCRIPT)
+             .ToLocal(&script)) {
+      failed_ = true;
+      return;
+    }
+    // With a request rate the arrivals are open loop: request i is due at a
+    // fixed time regardless of how long its predecessors took, and its
+    // latency includes any time it spent queued behind them. Without a rate
+    // requests run back to back.
+    const double interval = rate_ > 0 ? 1.0 / rate_ : 0;
+    const double first_arrival = g_platform->MonotonicallyIncreasingTime();
+    for (int i = 0; i < requests_; i++) {
+      double start;
+      if (interval > 0) {
+        start = first_arrival + i * interval;
+        double now = g_platform->MonotonicallyIncreasingTime();
+        if (now < start) {
+          base::OS::Sleep(base::TimeDelta::FromMicroseconds(
+              static_cast<int64_t>((start - now) * 1e6)));
+        }
+      } else {
+        start = g_platform->MonotonicallyIncreasingTime();
+      }
+      TryCatch try_catch(isolate);
+      if (script->Run(context).IsEmpty()) {
+        Shell::ReportException(isolate, &try_catch);
+        failed_ = true;
+        return;
+      }
+      double end = g_platform->MonotonicallyIncreasingTime();
+      latencies_ms_.push_back((end - start) * 1000);
+    }
+  }
+
+  int id_;
+  const char* path_;
+  int requests_;
+  double rate_;
+  bool failed_;
+  std::vector<double> latencies_ms_;
+};
+
+// Nearest-rank percentile of an ascending sample vector.
+double Percentile(const std::vector<double>& sorted, double fraction) {
+  size_t rank = static_cast<size_t>(ceil(fraction * sorted.size()));
+  if (rank > 0) rank--;
+  return sorted[rank];
+}
+
+void PrintLatencyStats(const std::vector<double>& sorted, double wall_s) {
+  double mean = 0;
+  for (size_t i = 0; i < sorted.size(); i++) mean += sorted[i];
+  mean /= sorted.size();
+  printf("      \"requests\": %d,\n", static_cast<int>(sorted.size()));
+  printf("      \"throughput_rps\": %.1f,\n", sorted.size() / wall_s);
+  printf("      \"mean_ms\": %.3f,\n", mean);
+  printf("      \"p50_ms\": %.3f,\n", Percentile(sorted, 0.5));
+  printf("      \"p95_ms\": %.3f,\n", Percentile(sorted, 0.95));
+  printf("      \"p99_ms\": %.3f\n", Percentile(sorted, 0.99));
+}
+
+}  // namespace
+
+
+int Shell::RunLoadTest() {
+  const int isolates = options.load_isolates < 1 ? 1 : options.load_isolates;
+  const int requests = options.load_requests < 1 ? 1 : options.load_requests;
+
+  std::vector<std::pair<const char*, int32_t>> counters_before;
+  if (i::FLAG_dump_counters) {
+    for (CounterMap::Iterator it(counter_map_); it.More(); it.Next()) {
+      if (it.CurrentValue()->is_histogram()) continue;
+      counters_before.push_back(
+          std::make_pair(it.CurrentKey(), it.CurrentValue()->count()));
+    }
+  }
+
+  std::vector<LoadTestThread*> threads;
+  double start = g_platform->MonotonicallyIncreasingTime();
+  for (int i = 0; i < isolates; i++) {
+    LoadTestThread* thread = new LoadTestThread(i, options.load_script,
+                                                requests, options.load_rate);
+    threads.push_back(thread);
+    thread->Start();
+  }
+  for (size_t i = 0; i < threads.size(); i++) threads[i]->Join();
+  double wall_s = g_platform->MonotonicallyIncreasingTime() - start;
+
+  printf("{\n");
+  printf("  \"load_script\": ");
+  PrintJSONString(options.load_script);
+  printf(",\n");
+  printf("  \"load_isolates\": %d,\n", isolates);
+  printf("  \"load_requests\": %d,\n", requests);
+  printf("  \"load_rate\": %.1f,\n", options.load_rate);
+  printf("  \"wall_s\": %.3f,\n", wall_s);
+  printf("  \"isolates\": [");
+
+  int exit_code = 0;
+  std::vector<double> all;
+  for (size_t i = 0; i < threads.size(); i++) {
+    LoadTestThread* thread = threads[i];
+    printf("%s\n    {\n      \"isolate\": %d,\n", i == 0 ? "" : ",",
+           thread->id());
+    if (thread->failed() || thread->latencies_ms().empty()) {
+      printf("      \"failed\": true\n    }");
+      exit_code = 1;
+      continue;
+    }
+    std::vector<double> sorted = thread->latencies_ms();
+    std::sort(sorted.begin(), sorted.end());
+    all.insert(all.end(), sorted.begin(), sorted.end());
+    PrintLatencyStats(sorted, wall_s);
+    printf("    }");
+  }
+  printf("\n  ]");
+  if (!all.empty()) {
+    std::sort(all.begin(), all.end());
+    printf(",\n  \"total\": {\n");
+    PrintLatencyStats(all, wall_s);
+    printf("  }");
+  }
+  if (i::FLAG_dump_counters) {
+    printf(",\n  \"counters\": {");
+    bool first_counter = true;
+    for (CounterMap::Iterator it(counter_map_); it.More(); it.Next()) {
+      if (it.CurrentValue()->is_histogram()) continue;
+      int32_t before = 0;
+      for (size_t i = 0; i < counters_before.size(); i++) {
+        if (strcmp(counters_before[i].first, it.CurrentKey()) == 0) {
+          before = counters_before[i].second;
+          break;
+        }
+      }
+      int32_t delta = it.CurrentValue()->count() - before;
+      if (delta == 0) continue;
+      printf("%s\n    ", first_counter ? "" : ",");
+      first_counter = false;
+      PrintJSONString(it.CurrentKey());
+      printf(": %d", delta);
+    }
+    printf("%s}", first_counter ? "" : "\n  ");
+  }
+  printf("\n}\n");
+
+  for (size_t i = 0; i < threads.size(); i++) delete threads[i];
+  return exit_code;
+}
+
+
+namespace {
+
+// Cursor over an in-memory API trace. Every read is bounds-checked; a
+// truncated or corrupt trace flips ok() instead of reading past the end.
+class TraceReader {
+ public:
+  TraceReader(const uint8_t* data, uint32_t size)
+      : cursor_(data), end_(data + size), ok_(true) {}
+
+  bool ok() const { return ok_; }
+  bool AtEnd() const { return cursor_ == end_; }
+  uint32_t Remaining() const { return static_cast<uint32_t>(end_ - cursor_); }
+
+  uint8_t ReadUint8() {
+    uint8_t value = 0;
+    ReadRaw(&value, sizeof(value));
+    return value;
+  }
+
+  uint32_t ReadUint32() {
+    uint32_t value = 0;
+    ReadRaw(&value, sizeof(value));
+    return value;
+  }
+
+  int32_t ReadInt32() {
+    int32_t value = 0;
+    ReadRaw(&value, sizeof(value));
+    return value;
+  }
+
+  double ReadDouble() {
+    double value = 0;
+    ReadRaw(&value, sizeof(value));
+    return value;
+  }
+
+  const uint8_t* ReadBytes(uint32_t length) {
+    if (!ok_ || Remaining() < length) {
+      ok_ = false;
+      return NULL;
+    }
+    const uint8_t* result = cursor_;
+    cursor_ += length;
+    return result;
+  }
+
+ private:
+  void ReadRaw(void* out, size_t length) {
+    if (!ok_ || Remaining() < length) {
+      ok_ = false;
+      return;
+    }
+    memcpy(out, cursor_, length);
+    cursor_ += length;
+  }
+
+  const uint8_t* cursor_;
+  const uint8_t* end_;
+  bool ok_;
+};
+
+// Enters a fresh evaluation context, dropping the previously entered one.
+// Realms belong to the entered context, so the realm scope is rebuilt too.
+void EnterReplayContext(Isolate* isolate, Global<Context>* context,
+                        PerIsolateData::RealmScope** realm_scope) {
+  delete *realm_scope;
+  *realm_scope = NULL;
+  if (!context->IsEmpty()) context->Get(isolate)->Exit();
+  Local<Context> new_context = Shell::CreateEvaluationContext(isolate);
+  new_context->Enter();
+  context->Reset(isolate, new_context);
+  *realm_scope = new PerIsolateData::RealmScope(PerIsolateData::Get(isolate));
+}
+
+}  // namespace
+
+
+int Shell::RunTraceReplay(Isolate* isolate) {
+  int trace_size = 0;
+  char* trace = ReadChars(isolate, options.replay_trace, &trace_size);
+  if (trace == NULL) {
+    printf("Error reading trace '%s'\n", options.replay_trace);
+    return 1;
+  }
+  TraceReader reader(reinterpret_cast<uint8_t*>(trace), trace_size);
+  uint32_t magic = reader.ReadUint32();
+  uint32_t version = reader.ReadUint32();
+  if (!reader.ok() || magic != i::kApiTraceMagic ||
+      version != i::kApiTraceVersion) {
+    printf("'%s' is not a version %u API trace\n", options.replay_trace,
+           i::kApiTraceVersion);
+    delete[] trace;
+    return 1;
+  }
+
+  HandleScope outer_scope(isolate);
+  Global<Context> context;
+  PerIsolateData::RealmScope* realm_scope = NULL;
+  std::map<int32_t, Global<Script>> scripts;
+  int contexts = 0;
+  int compiles = 0;
+  int script_runs = 0;
+  int function_calls = 0;
+  int skipped_calls = 0;
+  int exceptions = 0;
+  bool corrupt = false;
+  double start = g_platform->MonotonicallyIncreasingTime();
+
+  while (reader.ok() && !reader.AtEnd()) {
+    uint8_t kind = reader.ReadUint8();
+    uint32_t payload_length = reader.ReadUint32();
+    const uint8_t* payload = reader.ReadBytes(payload_length);
+    if (!reader.ok()) break;
+    TraceReader record(payload, payload_length);
+    HandleScope scope(isolate);
+    // Replayed scripts came from a running embedder, so an exception here is
+    // not necessarily a replay failure: it is counted and the replay goes on,
+    // like the original application did.
+    TryCatch try_catch(isolate);
+
+    switch (kind) {
+      case i::kApiTraceContextNew: {
+        EnterReplayContext(isolate, &context, &realm_scope);
+        contexts++;
+        break;
+      }
+      case i::kApiTraceScriptCompile: {
+        // Traces can begin with compiles recorded before the first context
+        // creation; give those an implicit context.
+        if (context.IsEmpty()) {
+          EnterReplayContext(isolate, &context, &realm_scope);
+        }
+        int32_t id = record.ReadInt32();
+        uint32_t source_length = record.Remaining();
+        const uint8_t* source_bytes = record.ReadBytes(source_length);
+        if (!record.ok()) {
+          corrupt = true;
+          break;
+        }
+        Local<String> source;
+        if (!String::NewFromUtf8(isolate,
+                                 reinterpret_cast<const char*>(source_bytes),
+                                 NewStringType::kNormal, source_length)
+                 .ToLocal(&source)) {
+          corrupt = true;
+          break;
+        }
+        char name_buffer[64];
+        snprintf(name_buffer, sizeof(name_buffer), "trace:%d", id);
+        Local<String> name =
+            String::NewFromUtf8(isolate, name_buffer, NewStringType::kNormal)
+                .ToLocalChecked();
+        Local<Script> script;
+        if (!CompileString(isolate, source, name,
+                           options.compile_options, SCRIPT)
+                 .ToLocal(&script)) {
+          ReportException(isolate, &try_catch);
+          exceptions++;
+          break;
+        }
+        scripts[id].Reset(isolate, script);
+        compiles++;
+        break;
+      }
+      case i::kApiTraceScriptRun: {
+        int32_t id = record.ReadInt32();
+        if (!record.ok()) {
+          corrupt = true;
+          break;
+        }
+        std::map<int32_t, Global<Script>>::iterator it = scripts.find(id);
+        if (it == scripts.end() || context.IsEmpty()) {
+          corrupt = true;
+          break;
+        }
+        if (it->second.Get(isolate)->Run(context.Get(isolate)).IsEmpty()) {
+          ReportException(isolate, &try_catch);
+          exceptions++;
+          break;
+        }
+        script_runs++;
+        break;
+      }
+      case i::kApiTraceFunctionCall: {
+        int32_t name_length = record.ReadInt32();
+        const uint8_t* name_bytes = record.ReadBytes(name_length);
+        int32_t argc = record.ReadInt32();
+        if (!record.ok() || argc < 0) {
+          corrupt = true;
+          break;
+        }
+        std::vector<Local<Value>> argv;
+        for (int32_t arg = 0; arg < argc && record.ok() && !corrupt; arg++) {
+          uint8_t tag = record.ReadUint8();
+          switch (tag) {
+            case i::kApiTraceValueNull:
+              argv.push_back(Null(isolate));
+              break;
+            case i::kApiTraceValueTrue:
+              argv.push_back(True(isolate));
+              break;
+            case i::kApiTraceValueFalse:
+              argv.push_back(False(isolate));
+              break;
+            case i::kApiTraceValueNumber:
+              argv.push_back(Number::New(isolate, record.ReadDouble()));
+              break;
+            case i::kApiTraceValueString: {
+              // Only the length of a string argument is recorded; replay it
+              // as a synthetic one-byte string of the same length.
+              int32_t string_length = record.ReadInt32();
+              if (!record.ok() || string_length < 0) {
+                corrupt = true;
+                break;
+              }
+              std::vector<char> filler(string_length, 'x');
+              Local<String> value;
+              if (!String::NewFromUtf8(
+                       isolate, string_length == 0 ? "" : &filler[0],
+                       NewStringType::kNormal, string_length)
+                       .ToLocal(&value)) {
+                corrupt = true;
+                break;
+              }
+              argv.push_back(value);
+              break;
+            }
+            default:
+              // Undefined, and values too complex to fingerprint.
+              argv.push_back(Undefined(isolate));
+              break;
+          }
+        }
+        if (!record.ok() || corrupt) {
+          corrupt = true;
+          break;
+        }
+        // Anonymous functions and names that do not resolve to a function on
+        // the replay global cannot be re-executed; they are skipped and
+        // reported so the coverage of the replay is visible.
+        if (name_length == 0 || context.IsEmpty()) {
+          skipped_calls++;
+          break;
+        }
+        Local<Context> current = context.Get(isolate);
+        Local<String> name;
+        if (!String::NewFromUtf8(isolate,
+                                 reinterpret_cast<const char*>(name_bytes),
+                                 NewStringType::kNormal, name_length)
+                 .ToLocal(&name)) {
+          corrupt = true;
+          break;
+        }
+        Local<Value> callee;
+        if (!current->Global()->Get(current, name).ToLocal(&callee) ||
+            !callee->IsFunction()) {
+          skipped_calls++;
+          break;
+        }
+        MaybeLocal<Value> result = Local<Function>::Cast(callee)->Call(
+            current, current->Global(), argc, argv.empty() ? NULL : &argv[0]);
+        if (result.IsEmpty()) {
+          ReportException(isolate, &try_catch);
+          exceptions++;
+          break;
+        }
+        function_calls++;
+        break;
+      }
+      default:
+        corrupt = true;
+        break;
+    }
+    if (corrupt) break;
+    EmptyMessageQueues(isolate);
+  }
+  double wall_s = g_platform->MonotonicallyIncreasingTime() - start;
+
+  int exit_code = 0;
+  if (!reader.ok() || corrupt) {
+    printf("Corrupt API trace '%s'\n", options.replay_trace);
+    exit_code = 1;
+  }
+  printf("{\n");
+  printf("  \"trace\": ");
+  PrintJSONString(options.replay_trace);
+  printf(",\n");
+  printf("  \"contexts\": %d,\n", contexts);
+  printf("  \"scripts_compiled\": %d,\n", compiles);
+  printf("  \"script_runs\": %d,\n", script_runs);
+  printf("  \"function_calls\": %d,\n", function_calls);
+  printf("  \"skipped_calls\": %d,\n", skipped_calls);
+  printf("  \"exceptions\": %d,\n", exceptions);
+  printf("  \"wall_s\": %.3f\n", wall_s);
+  printf("}\n");
+
+  for (std::map<int32_t, Global<Script>>::iterator it = scripts.begin();
+       it != scripts.end(); ++it) {
+    it->second.Reset();
+  }
+  delete realm_scope;
+  if (!context.IsEmpty()) {
+    context.Get(isolate)->Exit();
+    context.Reset();
+  }
+  delete[] trace;
+  return exit_code;
+}
+#endif  // !V8_SHARED
+
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -2648,7 +3385,26 @@ int Shell::Main(int argc, char* argv[]) {
     }
 #endif
 
-    if (options.stress_opt || options.stress_deopt) {
+#ifndef V8_SHARED
+    if (options.load_script) {
+      // Like benchmark mode, load mode replaces the regular script driver.
+      // The isolates under load run on their own threads; this isolate only
+      // aggregates their results.
+      options.script_executed = true;
+      result = RunLoadTest();
+    } else if (options.replay_trace) {
+      // Trace replay re-executes a recorded embedder API sequence instead
+      // of running scripts from the command line.
+      options.script_executed = true;
+      result = RunTraceReplay(isolate);
+    } else
+#endif  // !V8_SHARED
+    if (options.benchmark_manifest) {
+      // Benchmark mode replaces the regular script driver and never drops
+      // into the interactive shell.
+      options.script_executed = true;
+      result = RunBenchmarkSuite(isolate);
+    } else if (options.stress_opt || options.stress_deopt) {
       Testing::SetStressRunType(options.stress_opt
                                 ? Testing::kStressTypeOpt
                                 : Testing::kStressTypeDeopt);
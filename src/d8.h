@@ -292,7 +292,15 @@ class ShellOptions {
         natives_blob(NULL),
         snapshot_blob(NULL),
         trace_enabled(false),
-        trace_config(NULL) {}
+        trace_config(NULL),
+        benchmark_manifest(NULL),
+        benchmark_runs(10),
+        benchmark_warmup(1),
+        load_script(NULL),
+        load_isolates(1),
+        load_requests(1000),
+        load_rate(0),
+        replay_trace(NULL) {}
 
   ~ShellOptions() {
     delete[] isolate_sources;
@@ -322,6 +330,14 @@ class ShellOptions {
   const char* snapshot_blob;
   bool trace_enabled;
   const char* trace_config;
+  const char* benchmark_manifest;
+  int benchmark_runs;
+  int benchmark_warmup;
+  const char* load_script;
+  int load_isolates;
+  int load_requests;
+  double load_rate;
+  const char* replay_trace;
 };
 
 #ifdef V8_SHARED
@@ -346,6 +362,11 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, int argc, char* argv[], bool last_run);
+  static int RunBenchmarkSuite(Isolate* isolate);
+#ifndef V8_SHARED
+  static int RunLoadTest();
+  static int RunTraceReplay(Isolate* isolate);
+#endif  // !V8_SHARED
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
@@ -459,6 +480,9 @@ class Shell : public i::AllStatic {
   static CounterCollection local_counters_;
   static CounterCollection* counters_;
   static base::OS::MemoryMappedFile* counters_file_;
+  // Guards counter_map_ and counters_ when several isolates report counters,
+  // as they do in load-test mode.
+  static base::LazyMutex counter_mutex_;
   static base::LazyMutex context_mutex_;
   static const base::TimeTicks kInitialTicks;
 
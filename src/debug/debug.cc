@@ -494,6 +494,25 @@ void Debug::Unload() {
 void Debug::Break(JavaScriptFrame* frame) {
   HandleScope scope(isolate_);
 
+  // Functions under lightweight inspection reach this point through their
+  // instrumented entry even when no debugger is attached. Record the entry
+  // without setting up any of the debugger machinery; when the debugger is
+  // active it still gets to process the location below.
+  {
+    Handle<SharedFunctionInfo> inspected_shared(frame->function()->shared());
+    if (inspected_shared->HasDebugInfo()) {
+      Handle<DebugInfo> debug_info(inspected_shared->GetDebugInfo(), isolate_);
+      if (debug_info->IsUnderInspection()) {
+        BreakLocation location = BreakLocation::FromFrame(debug_info, frame);
+        if (location.position() ==
+            Smi::cast(debug_info->inspection_position())->value()) {
+          RecordInspectedFunctionEntry(debug_info, frame);
+          if (!is_active()) return;
+        }
+      }
+    }
+  }
+
   // Initialize LiveEdit.
   LiveEdit::InitializeThreadLocal(this);
 
@@ -797,6 +816,19 @@ void Debug::ApplyBreakPoints(Handle<DebugInfo> debug_info) {
       it.SetDebugBreak();
     }
   }
+  // Re-arm the lightweight inspection entry; clearing instrumentation
+  // wipes it together with the break points.
+  ApplyInspectionInstrumentation(debug_info);
+}
+
+void Debug::ApplyInspectionInstrumentation(Handle<DebugInfo> debug_info) {
+  DisallowHeapAllocation no_gc;
+  if (!debug_info->IsUnderInspection()) return;
+  DCHECK(debug_info->HasDebugBytecodeArray());
+  BytecodeArrayBreakIterator it(debug_info, ALL_BREAK_LOCATIONS);
+  it.SkipToPosition(Smi::cast(debug_info->inspection_position())->value(),
+                    BREAK_POSITION_ALIGNED);
+  it.SetDebugBreak();
 }
 
 void Debug::ClearBreakPoints(Handle<DebugInfo> debug_info) {
@@ -826,7 +858,8 @@ void Debug::ClearBreakPoint(Handle<Object> break_point_object) {
     Handle<DebugInfo> debug_info = node->debug_info();
     if (DebugInfo::ClearBreakPoint(debug_info, break_point_object)) {
       ClearBreakPoints(debug_info);
-      if (debug_info->GetBreakPointCount() == 0) {
+      if (debug_info->GetBreakPointCount() == 0 &&
+          !debug_info->IsUnderInspection()) {
         RemoveDebugInfoAndClearFromShared(debug_info);
       } else {
         ApplyBreakPoints(debug_info);
@@ -840,14 +873,98 @@ void Debug::ClearBreakPoint(Handle<Object> break_point_object) {
 // shutting down the debugger as it will leave the break point information in
 // DebugInfo even though the code is patched back to the non break point state.
 void Debug::ClearAllBreakPoints() {
-  for (DebugInfoListNode* node = debug_info_list_; node != NULL;
-       node = node->next()) {
-    ClearBreakPoints(node->debug_info());
+  DebugInfoListNode* current = debug_info_list_;
+  while (current != NULL) {
+    Handle<DebugInfo> debug_info = current->debug_info();
+    current = current->next();
+    ClearBreakPoints(debug_info);
+    if (debug_info->IsUnderInspection()) {
+      // Functions under lightweight inspection outlive the debugger; keep
+      // their debug info and re-arm the entry instrumentation only.
+      ApplyInspectionInstrumentation(debug_info);
+    } else {
+      RemoveDebugInfoAndClearFromShared(debug_info);
+    }
+  }
+}
+
+bool Debug::StartFunctionInspection(Handle<JSFunction> function,
+                                    bool capture_arguments) {
+  HandleScope scope(isolate_);
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (!shared->IsSubjectToDebugging()) return false;
+  if (!shared->is_compiled() &&
+      !Compiler::Compile(function, Compiler::CLEAR_EXCEPTION)) {
+    return false;
+  }
+  // The cheap entry instrumentation only exists for bytecode; functions
+  // running baseline code would bypass the instrumented copy entirely.
+  if (!shared->HasBytecodeArray() || shared->HasBaselineCode()) return false;
+
+  // Unlike EnsureDebugInfo this does not prepare the heap for break
+  // points: the interpreter entry trampoline picks up the instrumented
+  // bytecode copy for this one function, so only optimized code for the
+  // function itself has to go, and no new optimized code may appear while
+  // it is being inspected. Already-optimized callers that inlined the
+  // function keep running and are not counted until they deoptimize.
+  if (function->code()->kind() == Code::OPTIMIZED_FUNCTION) {
+    Deoptimizer::DeoptimizeFunction(*function);
+  }
+  shared->DisableOptimization(kDebuggerStatement);
+
+  if (!shared->HasDebugInfo()) CreateDebugInfo(shared);
+  Handle<DebugInfo> debug_info(shared->GetDebugInfo(), isolate_);
+  DCHECK(debug_info->HasDebugBytecodeArray());
+
+  // Instrument the first break location, which corresponds to function
+  // entry.
+  BytecodeArrayBreakIterator it(debug_info, ALL_BREAK_LOCATIONS);
+  DCHECK(!it.Done());
+  debug_info->set_inspection_count(Smi::FromInt(0));
+  debug_info->set_inspection_position(Smi::FromInt(it.position()));
+  if (capture_arguments) {
+    debug_info->set_inspection_arguments(isolate_->heap()->empty_fixed_array());
+  } else {
+    debug_info->set_inspection_arguments(isolate_->heap()->undefined_value());
+  }
+  it.SetDebugBreak();
+  return true;
+}
+
+void Debug::StopFunctionInspection(Handle<JSFunction> function) {
+  HandleScope scope(isolate_);
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (!shared->HasDebugInfo()) return;
+  Handle<DebugInfo> debug_info(shared->GetDebugInfo(), isolate_);
+  if (!debug_info->IsUnderInspection()) return;
+  Object* undefined = isolate_->heap()->undefined_value();
+  debug_info->set_inspection_count(undefined);
+  debug_info->set_inspection_position(undefined);
+  debug_info->set_inspection_arguments(undefined);
+  // Drop the entry instrumentation. Break points the debugger itself owns
+  // are re-applied from the break point info.
+  ClearBreakPoints(debug_info);
+  if (debug_info->GetBreakPointCount() == 0 && !is_active()) {
+    RemoveDebugInfoAndClearFromShared(debug_info);
+  } else {
+    ApplyBreakPoints(debug_info);
+  }
+}
+
+void Debug::RecordInspectedFunctionEntry(Handle<DebugInfo> debug_info,
+                                         JavaScriptFrame* frame) {
+  // Saturate the entry counter at the Smi range instead of wrapping.
+  int count = Smi::cast(debug_info->inspection_count())->value();
+  if (count < Smi::kMaxValue) {
+    debug_info->set_inspection_count(Smi::FromInt(count + 1));
   }
-  // Remove all debug info.
-  while (debug_info_list_ != NULL) {
-    RemoveDebugInfoAndClearFromShared(debug_info_list_->debug_info());
+  if (debug_info->inspection_arguments()->IsUndefined(isolate_)) return;
+  int argc = frame->ComputeParametersCount();
+  Handle<FixedArray> arguments = isolate_->factory()->NewFixedArray(argc);
+  for (int i = 0; i < argc; i++) {
+    arguments->set(i, frame->GetParameter(i));
   }
+  debug_info->set_inspection_arguments(*arguments);
 }
 
 void Debug::FloodWithOneShot(Handle<JSFunction> function,
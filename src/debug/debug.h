@@ -450,6 +450,16 @@ class Debug {
   void ChangeBreakOnException(ExceptionBreakType type, bool enable);
   bool IsBreakOnException(ExceptionBreakType type);
 
+  // Lightweight inspection: count entries of a single function and
+  // optionally capture the arguments of the most recent entry, using the
+  // function's instrumented bytecode copy. Unlike full break point support
+  // this does not flush optimized code maps or walk the heap, so it can be
+  // enabled without the debugger being attached. Returns whether
+  // inspection was started; functions without bytecode are not supported.
+  bool StartFunctionInspection(Handle<JSFunction> function,
+                               bool capture_arguments);
+  void StopFunctionInspection(Handle<JSFunction> function);
+
   // Stepping handling.
   void PrepareStep(StepAction step_action);
   void PrepareStepIn(Handle<JSFunction> function);
@@ -625,6 +635,12 @@ class Debug {
                         BreakLocatorType type = ALL_BREAK_LOCATIONS);
   // Clear all one-shot instrumentations, but restore break points.
   void ClearOneShot();
+  // Record a hit of the instrumented entry of a function under lightweight
+  // inspection.
+  void RecordInspectedFunctionEntry(Handle<DebugInfo> debug_info,
+                                    JavaScriptFrame* frame);
+  // Re-instrument the entry of a function under lightweight inspection.
+  void ApplyInspectionInstrumentation(Handle<DebugInfo> debug_info);
 
   void ActivateStepOut(StackFrame* frame);
   void RemoveDebugInfoAndClearFromShared(Handle<DebugInfo> debug_info);
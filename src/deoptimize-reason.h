@@ -86,6 +86,12 @@ enum class DeoptimizeReason : uint8_t {
 #undef DEOPTIMIZE_REASON
 };
 
+const int kDeoptimizeReasonCount = 0
+#define DEOPTIMIZE_REASON(Name, message) +1
+    DEOPTIMIZE_REASON_LIST(DEOPTIMIZE_REASON)
+#undef DEOPTIMIZE_REASON
+    ;
+
 std::ostream& operator<<(std::ostream&, DeoptimizeReason);
 
 size_t hash_value(DeoptimizeReason reason);
@@ -48,6 +48,80 @@ DeoptimizerData::~DeoptimizerData() {
 }
 
 
+static bool MatchFunctionName(void* key1, void* key2) {
+  return strcmp(reinterpret_cast<const char*>(key1),
+                reinterpret_cast<const char*>(key2)) == 0;
+}
+
+
+static uint32_t HashFunctionName(const char* name) {
+  uint32_t hash = 0;
+  for (const char* p = name; *p != '\0'; p++) {
+    hash = hash * 101 + static_cast<uint32_t>(*p);
+  }
+  return hash;
+}
+
+
+DeoptimizationStatistics::DeoptimizationStatistics()
+    : map_(MatchFunctionName), hot_deopt_callback_(NULL),
+      hot_deopt_threshold_(0) {}
+
+
+DeoptimizationStatistics::~DeoptimizationStatistics() {
+  for (base::HashMap::Entry* p = map_.Start(); p != NULL; p = map_.Next(p)) {
+    FunctionEntry* entry = static_cast<FunctionEntry*>(p->value);
+    DeleteArray(entry->name);
+    delete entry;
+  }
+}
+
+
+void DeoptimizationStatistics::RecordDeopt(Isolate* isolate,
+                                           Handle<SharedFunctionInfo> shared,
+                                           DeoptimizeReason reason) {
+  // Key on the function's debug name and start position; the position keeps
+  // same-named functions from different scripts and scopes apart.
+  std::unique_ptr<char[]> debug_name = shared->DebugName()->ToCString();
+  EmbeddedVector<char, 256> key;
+  SNPrintF(key, "%s@%d", debug_name.get(), shared->start_position());
+
+  base::HashMap::Entry* p =
+      map_.LookupOrInsert(key.start(), HashFunctionName(key.start()));
+  FunctionEntry* entry = static_cast<FunctionEntry*>(p->value);
+  if (entry == NULL) {
+    entry = new FunctionEntry();
+    entry->name = StrDup(key.start());
+    entry->total = 0;
+    memset(entry->count, 0, sizeof(entry->count));
+    p->key = entry->name;
+    p->value = entry;
+  }
+  entry->total++;
+  entry->count[static_cast<int>(reason)]++;
+
+  if (hot_deopt_callback_ != NULL && hot_deopt_threshold_ > 0 &&
+      (entry->total % hot_deopt_threshold_) == 0) {
+    hot_deopt_callback_(reinterpret_cast<v8::Isolate*>(isolate), entry->name,
+                        entry->total);
+  }
+}
+
+
+void DeoptimizationStatistics::Visit(Visitor* visitor) {
+  for (base::HashMap::Entry* p = map_.Start(); p != NULL; p = map_.Next(p)) {
+    FunctionEntry* entry = static_cast<FunctionEntry*>(p->value);
+    for (int i = 0; i < kDeoptimizeReasonCount; i++) {
+      if (entry->count[i] == 0) continue;
+      visitor->VisitDeoptCount(
+          entry->name,
+          DeoptimizeReasonToString(static_cast<DeoptimizeReason>(i)),
+          entry->count[i]);
+    }
+  }
+}
+
+
 Code* Deoptimizer::FindDeoptimizingCode(Address addr) {
   if (function_->IsHeapObject()) {
     // Search all deoptimizing code in the native context of the function.
@@ -347,6 +421,7 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(Context* context) {
     shared->EvictFromOptimizedCodeMap(codes[i], "deoptimized code");
 
     // Do platform-specific patching to force any activations to lazy deopt.
+    CodePageMemoryModificationScope modification_scope(codes[i]->address());
     PatchCodeForDeoptimization(isolate, codes[i]);
 
     // We might be in the middle of incremental marking with compaction.
@@ -379,6 +454,29 @@ void Deoptimizer::DeoptimizeAll(Isolate* isolate) {
 }
 
 
+void Deoptimizer::DeoptimizeColdCode(Isolate* isolate) {
+  RuntimeCallTimerScope runtimeTimer(isolate,
+                                     &RuntimeCallStats::DeoptimizeCode);
+  TimerEventScope<TimerEventDeoptimizeCode> timer(isolate);
+  TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_SCOPED(
+      isolate, &tracing::TraceEventStatsTable::DeoptimizeCode);
+  if (FLAG_trace_deopt) {
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[deoptimize cold code in all contexts]\n");
+  }
+  DisallowHeapAllocation no_allocation;
+  // For all contexts, mark code not executed since it was last aged, then
+  // deoptimize.
+  Object* context = isolate->heap()->native_contexts_list();
+  while (!context->IsUndefined(isolate)) {
+    Context* native_context = Context::cast(context);
+    MarkColdCodeForContext(native_context);
+    DeoptimizeMarkedCodeForContext(native_context);
+    context = native_context->next_context_link();
+  }
+}
+
+
 void Deoptimizer::DeoptimizeMarkedCode(Isolate* isolate) {
   RuntimeCallTimerScope runtimeTimer(isolate,
                                      &RuntimeCallStats::DeoptimizeCode);
@@ -412,6 +510,18 @@ void Deoptimizer::MarkAllCodeForContext(Context* context) {
 }
 
 
+void Deoptimizer::MarkColdCodeForContext(Context* context) {
+  Object* element = context->OptimizedCodeListHead();
+  Isolate* isolate = context->GetIsolate();
+  while (!element->IsUndefined(isolate)) {
+    Code* code = Code::cast(element);
+    CHECK_EQ(code->kind(), Code::OPTIMIZED_FUNCTION);
+    if (code->IsOld()) code->set_marked_for_deoptimization(true);
+    element = code->next_code_link();
+  }
+}
+
+
 void Deoptimizer::DeoptimizeFunction(JSFunction* function) {
   Isolate* isolate = function->GetIsolate();
   RuntimeCallTimerScope runtimeTimer(isolate,
@@ -457,6 +567,7 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
       function_(function),
       bailout_id_(bailout_id),
       bailout_type_(type),
+      deopt_reason_(DeoptimizeReason::kNoReason),
       from_(from),
       fp_to_sp_delta_(fp_to_sp_delta),
       deoptimizing_throw_(false),
@@ -515,6 +626,9 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
 #endif  // DEBUG
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
     PROFILE(isolate_, CodeDeoptEvent(compiled_code_, from_, fp_to_sp_delta_));
+    if (type == EAGER || type == SOFT) {
+      deopt_reason_ = GetDeoptInfo(compiled_code_, from_).deopt_reason;
+    }
   }
   unsigned size = ComputeInputFrameSize();
   int parameter_count =
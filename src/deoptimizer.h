@@ -6,11 +6,15 @@
 #define V8_DEOPTIMIZER_H_
 
 #include "src/allocation.h"
+#include "src/base/hashmap.h"
 #include "src/deoptimize-reason.h"
 #include "src/macro-assembler.h"
 #include "src/source-position.h"
 
 namespace v8 {
+
+class Isolate;
+
 namespace internal {
 
 class FrameDescription;
@@ -391,6 +395,8 @@ class Deoptimizer : public Malloced {
   Handle<JSFunction> function() const { return Handle<JSFunction>(function_); }
   Handle<Code> compiled_code() const { return Handle<Code>(compiled_code_); }
   BailoutType bailout_type() const { return bailout_type_; }
+  // The reason recorded at the deopt site; kNoReason for lazy deopts.
+  DeoptimizeReason deopt_reason() const { return deopt_reason_; }
 
   // Number of created JS frames. Not all created frames are necessarily JS.
   int jsframe_count() const { return jsframe_count_; }
@@ -424,6 +430,11 @@ class Deoptimizer : public Malloced {
   // Deoptimize all code in the given isolate.
   static void DeoptimizeAll(Isolate* isolate);
 
+  // Deoptimize all optimized code in the given isolate that has not been
+  // executed since it was last aged (see Code::IsOld). Used to shed cold
+  // code when the heap's code-space budget is exceeded.
+  static void DeoptimizeColdCode(Isolate* isolate);
+
   // Deoptimizes all optimized code that has been previously marked
   // (via code->set_marked_for_deoptimization) and unlinks all functions that
   // refer to that code.
@@ -562,6 +573,10 @@ class Deoptimizer : public Malloced {
   // Marks all the code in the given context for deoptimization.
   static void MarkAllCodeForContext(Context* native_context);
 
+  // Marks the code in the given context that has reached an old code age
+  // for deoptimization.
+  static void MarkColdCodeForContext(Context* native_context);
+
   // Visit all the known optimized functions in a given context.
   static void VisitAllOptimizedFunctionsForContext(
       Context* context, OptimizedFunctionVisitor* visitor);
@@ -591,6 +606,7 @@ class Deoptimizer : public Malloced {
   Code* compiled_code_;
   unsigned bailout_id_;
   BailoutType bailout_type_;
+  DeoptimizeReason deopt_reason_;
   Address from_;
   int fp_to_sp_delta_;
   bool deoptimizing_throw_;
@@ -832,17 +848,71 @@ class FrameDescription {
 };
 
 
+// Aggregates executed deoptimizations per function and deoptimization
+// reason, and reports functions that cross an embedder-provided deopt-count
+// threshold. This gives embedders a production view of deopt storms without
+// parsing --trace-deopt output (see Isolate::VisitDeoptimizationStatistics).
+class DeoptimizationStatistics {
+ public:
+  class Visitor {
+   public:
+    virtual ~Visitor() {}
+    // Called once per function and deoptimization reason with the number of
+    // executed deoptimizations recorded for that pair.
+    virtual void VisitDeoptCount(const char* function_name, const char* reason,
+                                 int count) = 0;
+  };
+
+  // Invoked whenever a function's total deoptimization count reaches a
+  // multiple of the configured threshold.
+  typedef void (*HotDeoptCallback)(v8::Isolate* isolate,
+                                   const char* function_name, int deopt_count);
+
+  DeoptimizationStatistics();
+  ~DeoptimizationStatistics();
+
+  // Records one executed deoptimization of |shared| and invokes the hot
+  // deopt callback if the function's total crosses the threshold.
+  void RecordDeopt(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                   DeoptimizeReason reason);
+
+  // Calls |visitor| for every (function, reason) pair recorded so far.
+  void Visit(Visitor* visitor);
+
+  void set_hot_deopt_callback(HotDeoptCallback callback, int threshold) {
+    hot_deopt_callback_ = callback;
+    hot_deopt_threshold_ = threshold;
+  }
+
+ private:
+  struct FunctionEntry {
+    char* name;  // Owned by this table.
+    int total;
+    int count[kDeoptimizeReasonCount];
+  };
+
+  base::HashMap map_;
+  HotDeoptCallback hot_deopt_callback_;
+  int hot_deopt_threshold_;
+
+  DISALLOW_COPY_AND_ASSIGN(DeoptimizationStatistics);
+};
+
+
 class DeoptimizerData {
  public:
   explicit DeoptimizerData(MemoryAllocator* allocator);
   ~DeoptimizerData();
 
+  DeoptimizationStatistics* statistics() { return &statistics_; }
+
  private:
   MemoryAllocator* allocator_;
   int deopt_entry_code_entries_[Deoptimizer::kLastBailoutType + 1];
   MemoryChunk* deopt_entry_code_[Deoptimizer::kLastBailoutType + 1];
 
   Deoptimizer* current_;
+  DeoptimizationStatistics statistics_;
 
   friend class Deoptimizer;
 
@@ -855,8 +925,13 @@ class TranslationBuffer BASE_EMBEDDED {
   explicit TranslationBuffer(Zone* zone) : contents_(256, zone) { }
 
   int CurrentIndex() const { return contents_.length(); }
+  uint8_t at(int index) const { return contents_.at(index); }
   void Add(int32_t value, Zone* zone);
 
+  // Drops everything at and after {index}. Used to deduplicate a translation
+  // that turned out to be byte-identical to an earlier one.
+  void Rewind(int index) { contents_.Rewind(index); }
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
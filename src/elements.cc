@@ -143,13 +143,16 @@ void CopyObjectToObjectElements(FixedArrayBase* from_base,
   DCHECK(IsFastSmiOrObjectElementsKind(from_kind));
   DCHECK(IsFastSmiOrObjectElementsKind(to_kind));
 
-  WriteBarrierMode write_barrier_mode =
-      (IsFastObjectElementsKind(from_kind) && IsFastObjectElementsKind(to_kind))
-          ? UPDATE_WRITE_BARRIER
-          : SKIP_WRITE_BARRIER;
-  for (int i = 0; i < copy_size; i++) {
-    Object* value = from->get(from_start + i);
-    to->set(to_start + i, value, write_barrier_mode);
+  // Move the slots in bulk and record them in one pass over the written
+  // range instead of pushing every element through the generic per-slot
+  // write barrier.
+  MemMove(to->data_start() + to_start, from->data_start() + from_start,
+          copy_size * kPointerSize);
+  if (IsFastObjectElementsKind(from_kind) &&
+      IsFastObjectElementsKind(to_kind)) {
+    Heap* heap = from->GetHeap();
+    FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(heap, to, static_cast<int>(to_start),
+                                       copy_size);
   }
 }
 
@@ -307,13 +310,18 @@ static void CopySmiToDoubleElements(FixedArrayBase* from_base,
   FixedArray* from = FixedArray::cast(from_base);
   FixedDoubleArray* to = FixedDoubleArray::cast(to_base);
   Object* the_hole = from->GetHeap()->the_hole_value();
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(copy_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object* hole_or_smi = from->get(from_start);
+  // Convert on raw slots: smi values never need the NaN canonicalization
+  // check in FixedDoubleArray::set, and dropping the per-element accessors
+  // lets the compiler vectorize the untag-and-convert loop.
+  Object** from_slot = from->RawFieldOfElementAt(from_start);
+  double* to_slot = reinterpret_cast<double*>(
+      to->address() + FixedDoubleArray::kHeaderSize + to_start * kDoubleSize);
+  for (int i = 0; i < copy_size; i++) {
+    Object* hole_or_smi = from_slot[i];
     if (hole_or_smi == the_hole) {
-      to->set_the_hole(to_start);
+      *reinterpret_cast<uint64_t*>(&to_slot[i]) = kHoleNanInt64;
     } else {
-      to->set(to_start, Smi::cast(hole_or_smi)->value());
+      to_slot[i] = static_cast<double>(Smi::cast(hole_or_smi)->value());
     }
   }
 }
@@ -349,11 +357,14 @@ static void CopyPackedSmiToDoubleElements(FixedArrayBase* from_base,
   if (copy_size == 0) return;
   FixedArray* from = FixedArray::cast(from_base);
   FixedDoubleArray* to = FixedDoubleArray::cast(to_base);
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(packed_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object* smi = from->get(from_start);
-    DCHECK(!smi->IsTheHole(from->GetIsolate()));
-    to->set(to_start, Smi::cast(smi)->value());
+  // The packed range is guaranteed hole-free, so the conversion is a
+  // branch-free raw loop that the compiler can vectorize.
+  Object** from_slot = from->RawFieldOfElementAt(from_start);
+  double* to_slot = reinterpret_cast<double*>(
+      to->address() + FixedDoubleArray::kHeaderSize + to_start * kDoubleSize);
+  for (int i = 0; i < packed_size; i++) {
+    DCHECK(!from_slot[i]->IsTheHole(from->GetIsolate()));
+    to_slot[i] = static_cast<double>(Smi::cast(from_slot[i])->value());
   }
 }
 
@@ -380,13 +391,19 @@ static void CopyObjectToDoubleElements(FixedArrayBase* from_base,
   FixedArray* from = FixedArray::cast(from_base);
   FixedDoubleArray* to = FixedDoubleArray::cast(to_base);
   Object* the_hole = from->GetHeap()->the_hole_value();
-  for (uint32_t from_end = from_start + copy_size;
-       from_start < from_end; from_start++, to_start++) {
-    Object* hole_or_object = from->get(from_start);
+  // Smis convert on raw slots as in CopySmiToDoubleElements; heap numbers
+  // go through FixedDoubleArray::set, which canonicalizes NaNs.
+  Object** from_slot = from->RawFieldOfElementAt(from_start);
+  double* to_slot = reinterpret_cast<double*>(
+      to->address() + FixedDoubleArray::kHeaderSize + to_start * kDoubleSize);
+  for (int i = 0; i < copy_size; i++) {
+    Object* hole_or_object = from_slot[i];
     if (hole_or_object == the_hole) {
-      to->set_the_hole(to_start);
+      *reinterpret_cast<uint64_t*>(&to_slot[i]) = kHoleNanInt64;
+    } else if (hole_or_object->IsSmi()) {
+      to_slot[i] = static_cast<double>(Smi::cast(hole_or_object)->value());
     } else {
-      to->set(to_start, hole_or_object->Number());
+      to->set(to_start + i, hole_or_object->Number());
     }
   }
 }
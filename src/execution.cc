@@ -465,6 +465,14 @@ Object* StackGuard::HandleInterrupts() {
     isolate_->heap()->DeoptMarkedAllocationSites();
   }
 
+  if (CheckAndClearInterrupt(DEOPT_COLD_CODE)) {
+    isolate_->heap()->DeoptColdCode();
+  }
+
+  if (CheckAndClearInterrupt(GC_BACKGROUND_STEP)) {
+    isolate_->heap()->HandleBackgroundGCStep();
+  }
+
   if (CheckAndClearInterrupt(INSTALL_CODE)) {
     DCHECK(isolate_->concurrent_recompilation_enabled());
     isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
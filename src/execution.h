@@ -88,7 +88,9 @@ class StackGuard final {
   V(GC_REQUEST, GC, 3)                                             \
   V(INSTALL_CODE, InstallCode, 4)                                  \
   V(API_INTERRUPT, ApiInterrupt, 5)                                \
-  V(DEOPT_MARKED_ALLOCATION_SITES, DeoptMarkedAllocationSites, 6)
+  V(DEOPT_MARKED_ALLOCATION_SITES, DeoptMarkedAllocationSites, 6)          \
+  V(DEOPT_COLD_CODE, DeoptColdCode, 7)                             \
+  V(GC_BACKGROUND_STEP, GCBackgroundStep, 8)
 
 #define V(NAME, Name, id)                                          \
   inline bool Check##Name() { return CheckInterrupt(NAME); }  \
@@ -0,0 +1,112 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/extensions/regexp-flat-exec-extension.h"
+
+#include <memory>
+
+#include "src/api.h"
+#include "src/isolate.h"
+#include "src/regexp/jsregexp.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+const char* const RegExpFlatExecExtension::kSource =
+    "native function flatRegExpExec();";
+
+v8::Local<v8::FunctionTemplate>
+RegExpFlatExecExtension::GetNativeFunctionTemplate(
+    v8::Isolate* isolate, v8::Local<v8::String> str) {
+  DCHECK_EQ(strcmp(*v8::String::Utf8Value(str), "flatRegExpExec"), 0);
+  return v8::FunctionTemplate::New(isolate, RegExpFlatExecExtension::Exec);
+}
+
+static void ThrowError(v8::Isolate* isolate, const char* message) {
+  isolate->ThrowException(
+      v8::String::NewFromUtf8(isolate, message, NewStringType::kNormal)
+          .ToLocalChecked());
+}
+
+void RegExpFlatExecExtension::Exec(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* v8_isolate = args.GetIsolate();
+  if (args.Length() != 4 || !args[0]->IsRegExp() || !args[1]->IsString() ||
+      !args[2]->IsInt32() || !args[3]->IsInt32Array()) {
+    ThrowError(v8_isolate,
+               "Usage: flatRegExpExec(regexp, subject, fromIndex, "
+               "offsetsOut), with offsetsOut an Int32Array.");
+    return;
+  }
+  Handle<JSRegExp> regexp =
+      Handle<JSRegExp>::cast(Utils::OpenHandle(*args[0]));
+  Handle<String> subject = Utils::OpenHandle(*args[1].As<v8::String>());
+  int index = args[2].As<v8::Int32>()->Value();
+  if (index < 0 || index > subject->length()) {
+    ThrowError(v8_isolate, "flatRegExpExec(): fromIndex is out of range.");
+    return;
+  }
+  subject = String::Flatten(subject);
+  Isolate* isolate = regexp->GetIsolate();
+
+  // Like RegExpImpl::IrregexpExec, but the capture offsets go straight from
+  // the register vector into the caller's descriptor; no last-match info is
+  // updated and no result object or substrings are allocated.
+  int required_registers;
+  int capture_register_count;
+  if (regexp->TypeTag() == JSRegExp::ATOM) {
+    required_registers = 2;
+    capture_register_count = 2;
+  } else {
+    required_registers = RegExpImpl::IrregexpPrepare(regexp, subject);
+    if (required_registers < 0) return;  // Compilation raised an exception.
+    capture_register_count =
+        (RegExpImpl::IrregexpNumberOfCaptures(
+             FixedArray::cast(regexp->data())) +
+         1) *
+        2;
+  }
+
+  v8::Local<v8::Int32Array> offsets = args[3].As<v8::Int32Array>();
+  if (offsets->Length() < static_cast<size_t>(capture_register_count)) {
+    ThrowError(v8_isolate,
+               "flatRegExpExec(): offsetsOut needs room for "
+               "2 * (captureCount + 1) elements.");
+    return;
+  }
+
+  int32_t* output_registers = NULL;
+  if (required_registers > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = NewArray<int32_t>(required_registers);
+  }
+  std::unique_ptr<int32_t[]> auto_release(output_registers);
+  if (output_registers == NULL) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  }
+
+  int res;
+  if (regexp->TypeTag() == JSRegExp::ATOM) {
+    res = RegExpImpl::AtomExecRaw(regexp, subject, index, output_registers,
+                                  required_registers);
+  } else {
+    res = RegExpImpl::IrregexpExecRaw(regexp, subject, index,
+                                      output_registers, required_registers);
+  }
+  if (res == RegExpImpl::RE_EXCEPTION) return;
+  if (res == RegExpImpl::RE_FAILURE) {
+    args.GetReturnValue().Set(-1);
+    return;
+  }
+
+  uint8_t* destination =
+      static_cast<uint8_t*>(offsets->Buffer()->GetContents().Data()) +
+      offsets->ByteOffset();
+  MemCopy(destination, output_registers,
+          capture_register_count * sizeof(int32_t));
+  args.GetReturnValue().Set(capture_register_count);
+}
+
+}  // namespace internal
+}  // namespace v8
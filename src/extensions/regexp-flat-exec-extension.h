@@ -0,0 +1,33 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXTENSIONS_REGEXP_FLAT_EXEC_EXTENSION_H_
+#define V8_EXTENSIONS_REGEXP_FLAT_EXEC_EXTENSION_H_
+
+#include "include/v8.h"
+
+namespace v8 {
+namespace internal {
+
+// Exposes flatRegExpExec(regexp, subject, fromIndex, offsetsOut), an exec
+// variant for allocation-sensitive match loops: it writes the raw capture
+// offsets into the caller-owned Int32Array and returns the number of offsets
+// written, or -1 on mismatch. No result array or substrings are allocated;
+// captures are materialized lazily by the caller with String.prototype
+// .substring on the offsets it is interested in.
+class RegExpFlatExecExtension : public v8::Extension {
+ public:
+  RegExpFlatExecExtension() : v8::Extension("v8/regexp-flat-exec", kSource) {}
+  virtual v8::Local<v8::FunctionTemplate> GetNativeFunctionTemplate(
+      v8::Isolate* isolate, v8::Local<v8::String> name);
+  static void Exec(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+ private:
+  static const char* const kSource;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXTENSIONS_REGEXP_FLAT_EXEC_EXTENSION_H_
@@ -252,6 +252,10 @@ void ExternalReferenceTable::AddReferences(Isolate* isolate) {
       "NativeRegExpMacroAssembler::GrowStack()");
   Add(ExternalReference::re_word_character_map().address(),
       "NativeRegExpMacroAssembler::word_character_map");
+  Add(ExternalReference::re_skip_until_character_latin1(isolate).address(),
+      "NativeRegExpMacroAssembler::SkipUntilCharacterLatin1()");
+  Add(ExternalReference::re_skip_until_character_uc16(isolate).address(),
+      "NativeRegExpMacroAssembler::SkipUntilCharacterUC16()");
   Add(ExternalReference::address_of_regexp_stack_limit(isolate).address(),
       "RegExpStack::limit_address()");
   Add(ExternalReference::address_of_regexp_stack_memory_address(isolate)
@@ -15,6 +15,16 @@ class Isolate;
 // ExternalReferenceTable is a helper class that defines the relationship
 // between external references and their encodings. It is used to build
 // hashmaps in ExternalReferenceEncoder and ExternalReferenceDecoder.
+//
+// Snapshots store external references as indices into this table, so
+// deserialization never rewrites pointer values; the per-reference cost at
+// load time is decoding the index and storing the resolved address into the
+// code object.
+// TODO(snapshot): Even that fixup pass would disappear if generated code
+// loaded external references indirectly, e.g. through a register-addressed
+// per-isolate copy of this table, leaving no relocation records to visit.
+// That requires isolate-independent code generation first; see the TODO at
+// Builtins::SetUp for the prerequisites.
 class ExternalReferenceTable {
  public:
   static ExternalReferenceTable* instance(Isolate* isolate);
@@ -265,6 +265,39 @@ MaybeHandle<String> Factory::NewStringFromOneByte(Vector<const uint8_t> string,
   return result;
 }
 
+// Longest string the API string cache will hold on to. Entries are compared
+// against the input bytes on every probe, so keep them short.
+const int kApiStringCacheMaxLength = 64;
+
+Handle<String> Factory::NewCachedApiString(Vector<const uint8_t> string) {
+  // Embedders commonly pass the same short names (property keys, column
+  // names) across the API over and over. Remember the internalized string
+  // for them in a small direct-mapped cache, so repeated calls skip both
+  // the allocation and the string table probe.
+  int length = string.length();
+  uint32_t hash =
+      StringHasher::HashSequentialString(string.start(), length,
+                                         isolate()->heap()->HashSeed());
+  int index = hash & (Heap::kApiStringCacheSize - 1);
+  Handle<FixedArray> cache(isolate()->heap()->api_string_cache(), isolate());
+  {
+    DisallowHeapAllocation no_gc;
+    Object* entry = cache->get(index);
+    if (entry->IsSeqOneByteString()) {
+      SeqOneByteString* cached = SeqOneByteString::cast(entry);
+      if (cached->length() == length &&
+          memcmp(cached->GetChars(), string.start(), length) == 0) {
+        return handle(cached, isolate());
+      }
+    }
+  }
+  Handle<String> result = InternalizeOneByteString(string);
+  // Internalized strings for natives can be external; only cache the
+  // sequential case the probe above matches against.
+  if (result->IsSeqOneByteString()) cache->set(index, *result);
+  return result;
+}
+
 MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
                                                PretenureFlag pretenure) {
   // Check for ASCII first since this is the common case.
@@ -274,6 +307,10 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
   if (non_ascii_start >= length) {
     // If the string is ASCII, we do not need to convert the characters
     // since UTF8 is backwards compatible with ASCII.
+    if (FLAG_api_string_cache && length > 1 &&
+        length <= kApiStringCacheMaxLength) {
+      return NewCachedApiString(Vector<const uint8_t>::cast(string));
+    }
     return NewStringFromOneByte(Vector<const uint8_t>::cast(string), pretenure);
   }
 
@@ -629,6 +666,14 @@ Handle<String> Factory::NewProperSubString(Handle<String> str,
   }
 
   if (!FLAG_string_slices || length < SlicedString::kMinLength) {
+    if (FLAG_internalize_short_substrings && str->IsSeqOneByteString()) {
+      // Token-extraction workloads cut millions of short, highly repetitive
+      // substrings out of large documents. Internalizing them lets repeated
+      // tokens share one old-space string instead of each call materializing
+      // a fresh SeqString.
+      return InternalizeOneByteString(Handle<SeqOneByteString>::cast(str),
+                                      begin, length);
+    }
     if (str->IsOneByteRepresentation()) {
       Handle<SeqOneByteString> result =
           NewRawOneByteString(length).ToHandleChecked();
@@ -760,6 +805,8 @@ Handle<Context> Factory::NewNativeContext() {
   Handle<Context> context = Handle<Context>::cast(array);
   context->set_native_context(*context);
   context->set_errors_thrown(Smi::FromInt(0));
+  context->set_allocated_bytes(Smi::FromInt(0));
+  context->set_allocation_limit(Smi::FromInt(0));
   Handle<WeakCell> weak_cell = NewWeakCell(context);
   context->set_self_weak_cell(*weak_cell);
   DCHECK(context->IsNativeContext());
@@ -2189,13 +2236,18 @@ Handle<Object> Factory::GetNumberStringCache(Handle<Object> number) {
 void Factory::SetNumberStringCache(Handle<Object> number,
                                    Handle<String> string) {
   int hash = NumberCacheHash(number_string_cache(), number);
-  if (number_string_cache()->get(hash * 2) != *undefined_value()) {
+  Object* key = number_string_cache()->get(hash * 2);
+  if (key != *undefined_value()) {
     int full_size = isolate()->heap()->FullSizeNumberStringCacheLength();
     if (number_string_cache()->length() != full_size) {
       Handle<FixedArray> new_cache = NewFixedArray(full_size, TENURED);
       isolate()->heap()->set_number_string_cache(*new_cache);
       return;
     }
+    // Smi entries hash by value, so a live smi entry is almost certainly
+    // hotter than the heap number that happens to collide with it. Keep the
+    // smi; the heap number is simply recomputed on its next miss.
+    if (key->IsSmi() && !number->IsSmi()) return;
   }
   number_string_cache()->set(hash * 2, *number);
   number_string_cache()->set(hash * 2 + 1, *string);
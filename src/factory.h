@@ -170,6 +170,11 @@ class Factory final {
       Vector<const char> str,
       PretenureFlag pretenure = NOT_TENURED);
 
+  // Returns the internalized string for short ASCII contents passed in
+  // repeatedly through the API, remembered in a small direct-mapped cache.
+  // Only used when --api-string-cache is enabled.
+  Handle<String> NewCachedApiString(Vector<const uint8_t> str);
+
   MUST_USE_RESULT MaybeHandle<String> NewStringFromTwoByte(
       Vector<const uc16> str,
       PretenureFlag pretenure = NOT_TENURED);
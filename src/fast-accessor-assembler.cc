@@ -204,6 +204,23 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::Call(
   return FromRaw(call);
 }
 
+FastAccessorAssembler::ValueId FastAccessorAssembler::CallIntGetter(
+    IntGetterCallback callback_function, ValueId arg) {
+  CHECK_EQ(kBuilding, state_);
+
+  // A plain C call: no FunctionCallbackInfo is built and no handles are
+  // allocated, so the callback sees the raw argument value directly.
+  ApiFunction callback_api_function(FUNCTION_ADDR(callback_function));
+  ExternalReference callback(&callback_api_function,
+                             ExternalReference::BUILTIN_CALL, isolate());
+
+  Node* result = assembler_->CallCFunction1(
+      MachineType::Int32(), MachineType::Pointer(),
+      assembler_->ExternalConstant(callback), FromId(arg));
+  // Widen the result so that ToSmi can tag it.
+  return FromRaw(assembler_->ChangeInt32ToIntPtr(result));
+}
+
 void FastAccessorAssembler::CheckIsJSObjectOrJump(ValueId value_id,
                                                   LabelId label_id) {
   CHECK_EQ(kBuilding, state_);
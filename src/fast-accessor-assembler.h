@@ -46,6 +46,8 @@ class FastAccessorAssembler {
   typedef v8::experimental::FastAccessorBuilder::ValueId ValueId;
   typedef v8::experimental::FastAccessorBuilder::LabelId LabelId;
   typedef v8::FunctionCallback FunctionCallback;
+  typedef v8::experimental::FastAccessorBuilder::IntGetterCallback
+      IntGetterCallback;
 
   explicit FastAccessorAssembler(Isolate* isolate);
   ~FastAccessorAssembler();
@@ -81,6 +83,11 @@ class FastAccessorAssembler {
   // C++ callback.
   ValueId Call(FunctionCallback callback, ValueId arg);
 
+  // Typed C++ callback, called directly with the raw (untagged) argument and
+  // without materializing a FunctionCallbackInfo. The callback must not call
+  // back into V8. The result is a raw integer; tag it with ToSmi.
+  ValueId CallIntGetter(IntGetterCallback callback, ValueId arg);
+
   // Assemble the code.
   MaybeHandle<Code> Build();
 
@@ -184,6 +184,10 @@ DEFINE_BOOL(intl_extra, false, "additional V8 Intl functions")
 // Removing extra Intl functions is shipped
 DEFINE_NEG_VALUE_IMPLICATION(harmony_shipping, intl_extra, true)
 
+DEFINE_BOOL(experimental_array_pipeline, false,
+            "expose Array.prototype.pipeline() for fused map/filter chains "
+            "without intermediate arrays")
+
 // Activate on ClusterFuzz.
 DEFINE_IMPLICATION(es_staging, harmony_regexp_lookbehind)
 DEFINE_IMPLICATION(es_staging, move_object_start)
@@ -284,6 +288,11 @@ DEFINE_VALUE_IMPLICATION(optimize_for_size, max_semi_space_size, 1)
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL(string_slices, true, "use string slices")
+DEFINE_BOOL(api_string_cache, false,
+            "cache short repeated strings created through the API")
+DEFINE_BOOL(internalize_short_substrings, false,
+            "internalize substrings below the string slice threshold so "
+            "repeated tokens share storage")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition, false, "use ignition interpreter")
@@ -335,6 +344,12 @@ DEFINE_INT(max_inlined_nodes, 196,
            "maximum number of AST nodes considered for a single inlining")
 DEFINE_INT(max_inlined_nodes_cumulative, 400,
            "maximum cumulative number of AST nodes considered for inlining")
+DEFINE_INT(max_inlined_nodes_small, 10,
+           "maximum number of AST nodes considered for a single inlining "
+           "after the cumulative budget is exhausted")
+DEFINE_INT(min_inlining_calls, 2,
+           "minimum call count recorded by the CallIC for a call site with "
+           "feedback to be considered for inlining")
 DEFINE_BOOL(loop_invariant_code_motion, true, "loop invariant code motion")
 DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(collect_megamorphic_maps_from_stub_cache, false,
@@ -451,6 +466,9 @@ DEFINE_BOOL(turbo_verify, DEBUG_BOOL, "verify TurboFan graphs at each phase")
 DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
+DEFINE_STRING(turbo_stats_json_file, NULL,
+              "write per-phase TurboFan statistics as JSON to this file at "
+              "isolate teardown")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(turbo_type_feedback, true,
             "use typed feedback for representation inference in Turbofan")
@@ -480,7 +498,13 @@ DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_cache_shared_code, true, "cache context-independent code")
 DEFINE_BOOL(turbo_preserve_shared_code, false, "keep context-independent code")
-DEFINE_BOOL(turbo_escape, false, "enable escape analysis")
+DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_BOOL(turbo_profile_guided_layout, false,
+            "place basic blocks not executed in a previous --turbo-profiling "
+            "run out of line")
+DEFINE_BOOL(turbo_stub_cache_fallback, false,
+            "call the generic IC instead of deoptimizing when a polymorphic "
+            "named access sees an unexpected map")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
@@ -512,6 +536,9 @@ DEFINE_INT(trace_wasm_ast_end, 0, "end function for WASM AST trace (exclusive)")
 DEFINE_INT(skip_compiling_wasm_funcs, 0, "start compiling at function N")
 DEFINE_BOOL(wasm_break_on_decoder_error, false,
             "debug break when wasm decoder encounters an error")
+DEFINE_BOOL(wasm_guard_pages, false,
+            "add guard regions around wasm linear memory and elide explicit "
+            "bounds checks (experimental, 64-bit only)")
 DEFINE_BOOL(wasm_loop_assignment_analysis, true,
             "perform loop assignment analysis for WASM")
 
@@ -592,6 +619,9 @@ DEFINE_IMPLICATION(expose_gc_as, expose_gc)
 DEFINE_BOOL(expose_externalize_string, false,
             "expose externalize string extension")
 DEFINE_BOOL(expose_trigger_failure, false, "expose trigger-failure extension")
+DEFINE_BOOL(expose_regexp_flat_exec, false,
+            "expose flatRegExpExec(), which fills a reusable Int32Array with "
+            "capture offsets instead of allocating a result object")
 DEFINE_INT(stack_trace_limit, 10, "number of stack frames to capture")
 DEFINE_BOOL(builtins_in_stack_traces, false,
             "show built-in functions in stack traces")
@@ -626,6 +656,13 @@ DEFINE_BOOL(trace_stub_failures, false,
 
 DEFINE_BOOL(serialize_toplevel, true, "enable caching of toplevel scripts")
 DEFINE_BOOL(serialize_eager, false, "compile eagerly when caching scripts")
+DEFINE_BOOL(compiler_dispatcher, false,
+            "enable background parsing of lazy functions ahead of first call")
+DEFINE_INT(compiler_dispatcher_deadline_ms, 100,
+           "queued background compile jobs are overdue after this many "
+           "milliseconds and run ahead of the priority lanes")
+DEFINE_BOOL(verify_code_cache_checksum, true,
+            "verify the checksum of cached script data before consuming it")
 DEFINE_BOOL(serialize_age_code, false, "pre age code in the code cache")
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
 
@@ -637,6 +674,9 @@ DEFINE_INT(max_opt_count, 10,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_eval_generations, 1,
+           "number of generations in the eval compilation sub-caches; higher "
+           "values keep hot eval entries alive across more full GCs")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -685,9 +725,14 @@ DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
             "Grow the new space based on the percentage of survivors instead "
             "of their absolute value.")
+DEFINE_BOOL(fast_promotion_new_space, false,
+            "fast promote pages within new space on high survival rates")
 DEFINE_INT(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_INT(initial_old_space_size, 0, "initial old space size (in Mbytes)")
 DEFINE_INT(max_executable_size, 0, "max size of executable memory (in Mbytes)")
+DEFINE_INT(number_string_cache_size, 0,
+           "full size of the number-to-string cache in entries, rounded up to "
+           "a power of two (0 selects a size based on the max semi-space size)")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
 DEFINE_INT(gc_interval, -1, "garbage collect after <n> allocations")
 DEFINE_INT(retain_maps_for_n_gc, 2,
@@ -710,6 +755,12 @@ DEFINE_BOOL(print_max_heap_committed, false,
             "in name=value format on exit")
 DEFINE_BOOL(trace_gc_verbose, false,
             "print more details following each garbage collection")
+DEFINE_STRING(record_gc_decisions, nullptr,
+              "record GC trigger decisions with their inputs to the given "
+              "file")
+DEFINE_STRING(replay_gc_decisions, nullptr,
+              "replay GC trigger decisions from a file recorded with "
+              "--record-gc-decisions")
 DEFINE_INT(trace_allocation_stack_interval, -1,
            "print stack trace after <n> free-list allocations")
 DEFINE_BOOL(trace_fragmentation, false, "report fragmentation for old space")
@@ -727,6 +778,15 @@ DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
             "old code (required for code flushing)")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush the bytecode of functions that have not been executed "
+            "for several collections (re-compiled lazily on the next call)")
+DEFINE_INT(bytecode_old_age, 5,
+           "number of mark-compact collections a bytecode array must survive "
+           "without being executed before it is considered old")
+DEFINE_BOOL(compact_string_table_after_gc, true,
+            "repair string table probe chains in a posted task after "
+            "mark-compact instead of on the next internalization")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
@@ -735,19 +795,49 @@ DEFINE_INT(min_progress_during_incremental_marking_finalization, 32,
            "least this many unmarked objects")
 DEFINE_INT(max_incremental_marking_finalization_rounds, 3,
            "at most try this many times to finalize incremental marking")
-DEFINE_BOOL(black_allocation, false, "use black allocation")
+DEFINE_BOOL(black_allocation, true, "use black allocation")
+DEFINE_INT(marking_prefetch_distance, 8,
+           "prefetch the gray object this many entries below the marking "
+           "deque top while draining it (0 disables prefetching)")
+DEFINE_INT(large_page_pool_size, 0,
+           "maximum megabytes of dead large pages kept committed for reuse "
+           "by new large objects (0 disables recycling)")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_marking, false,
+            "drain the marking worklist on a background thread")
+DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_scavenge, false,
+            "scan the old-to-new remembered set in parallel during scavenges")
+DEFINE_BOOL(parallel_weak_handle_scanning, true,
+            "identify dead weak global handles on background threads during "
+            "mark-compact")
 DEFINE_BOOL(trace_incremental_marking, false,
             "trace progress of the incremental marking")
+DEFINE_INT(incremental_marking_safety_factor, 0,
+           "drive incremental marking step sizes from the mutator's "
+           "allocation throughput, with the given safety margin in percent "
+           "(0 keeps the idle-time schedule)")
+DEFINE_BOOL(background_gc_work, false,
+            "pace incremental GC steps from a background task instead of "
+            "embedder idle tasks (for embedders without an event loop)")
+DEFINE_INT(background_gc_mutator_utilization, 90,
+           "target mutator utilization in percent for --background-gc-work")
+DEFINE_INT(scavenge_pause_budget, 0,
+           "resize the semispaces based on promotion ratio and measured "
+           "scavenge speed so that scavenge pauses stay within the given "
+           "budget in ms (0 keeps the survival-based growth heuristic)")
 DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_NEG_IMPLICATION(trace_gc_object_stats, incremental_marking)
+DEFINE_BOOL(track_context_allocation, false,
+            "track allocated bytes per native context and enforce the "
+            "per-context allocation limit, if one is set")
 DEFINE_BOOL(track_detached_contexts, true,
             "track native contexts that are expected to be garbage collected")
 DEFINE_BOOL(trace_detached_contexts, false,
@@ -755,13 +845,27 @@ DEFINE_BOOL(trace_detached_contexts, false,
 DEFINE_IMPLICATION(trace_detached_contexts, track_detached_contexts)
 #ifdef VERIFY_HEAP
 DEFINE_BOOL(verify_heap, false, "verify heap pointers before and after GC")
+DEFINE_INT(verify_heap_sample_percent, 0,
+           "verify the objects on a random percentage of heap pages after "
+           "each GC (0 disables sampled verification)")
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
+DEFINE_BOOL(write_protect_code_memory, false,
+            "write protect code space pages outside of GC and code patching "
+            "scopes (experimental)")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(migrate_deprecated_maps_on_memory_reducer, true,
+            "migrate objects off deprecated maps after memory reducer GCs")
 DEFINE_BOOL(scavenge_reclaim_unmodified_objects, true,
             "remove unmodified and unreferenced objects")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_INT(numa_node, -1,
+           "bind heap memory and GC worker tasks to the given NUMA node "
+           "(-1 disables binding; Linux only)")
+DEFINE_BOOL(huge_pages, false,
+            "advise transparent huge page backing for old space and code "
+            "space chunks (Linux only)")
 
 // execution.cc, messages.cc
 DEFINE_BOOL(clear_exceptions_on_js_entry, false,
@@ -860,6 +964,9 @@ DEFINE_BOOL(stack_trace_on_illegal, false,
             "print stack trace when an illegal exception is thrown")
 DEFINE_BOOL(abort_on_uncaught_exception, false,
             "abort program (dump core) when an uncaught exception is thrown")
+DEFINE_BOOL(lazy_exception_messages, true,
+            "do not materialize message objects for exceptions predicted to "
+            "be caught by a JavaScript catch block")
 DEFINE_BOOL(randomize_hashes, true,
             "randomize hashes to avoid predictable hash collisions "
             "(with snapshots this option cannot override the baked-in seed)")
@@ -901,7 +1008,10 @@ DEFINE_BOOL(profile_hydrogen_code_stub_compilation, false,
 DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
+DEFINE_NEG_IMPLICATION(predictable, concurrent_marking)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compaction)
+DEFINE_NEG_IMPLICATION(predictable, parallel_scavenge)
+DEFINE_NEG_IMPLICATION(predictable, parallel_weak_handle_scanning)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
 
 // mark-compact.cc
@@ -1039,6 +1149,9 @@ DEFINE_BOOL(log, false,
             "Minimal logging (no API, code, GC, suspect, or handles samples).")
 DEFINE_BOOL(log_all, false, "Log all events to the log file.")
 DEFINE_BOOL(log_api, false, "Log API events to the log file.")
+DEFINE_STRING(api_trace_file, NULL,
+              "Record a binary, replayable trace of API calls to this file "
+              "(requires a build with V8_ENABLE_API_TRACING).")
 DEFINE_BOOL(log_code, false,
             "Log code events to the log file without profiling.")
 DEFINE_BOOL(log_gc, false,
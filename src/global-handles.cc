@@ -5,6 +5,8 @@
 #include "src/global-handles.h"
 
 #include "src/api.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/semaphore.h"
 #include "src/v8.h"
 #include "src/vm-state-inl.h"
 
@@ -569,6 +571,62 @@ class GlobalHandles::PendingPhantomCallbacksSecondPassTask
   DISALLOW_COPY_AND_ASSIGN(PendingPhantomCallbacksSecondPassTask);
 };
 
+// One worker of a parallel weak handle identification round. The workers
+// share a cursor into a snapshot of the used node block list and claim
+// blocks off it until the list is exhausted, so an uneven distribution of
+// weak nodes across blocks cannot stall the round on a single task.
+class GlobalHandles::WeakHandleScanTask : public v8::Task {
+ public:
+  WeakHandleScanTask(List<NodeBlock*>* blocks,
+                     base::AtomicNumber<size_t>* cursor, WeakSlotCallback f,
+                     base::Semaphore* pending_tasks)
+      : blocks_(blocks),
+        cursor_(cursor),
+        f_(f),
+        pending_tasks_(pending_tasks) {}
+
+  virtual ~WeakHandleScanTask() {}
+
+  // Claims and scans blocks until the cursor runs off the end of the block
+  // list. Also called by the main thread, which participates in the scan
+  // instead of idling until the background tasks have finished. The
+  // predicate only reads mark bits and marking a node as pending only
+  // touches the node itself, so tasks working on disjoint blocks do not
+  // need any further synchronization.
+  static void ScanBlocks(List<NodeBlock*>* blocks,
+                         base::AtomicNumber<size_t>* cursor,
+                         WeakSlotCallback f) {
+    while (true) {
+      size_t index = cursor->Increment(1) - 1;
+      if (index >= static_cast<size_t>(blocks->length())) return;
+      NodeBlock* block = blocks->at(static_cast<int>(index));
+      for (int i = 0; i < NodeBlock::kSize; i++) {
+        Node* node = block->node_at(i);
+        if (node->IsWeak() && f(node->location())) {
+          node->MarkPending();
+        }
+      }
+    }
+  }
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    if (FLAG_numa_node >= 0) {
+      base::OS::BindCurrentThreadToNode(FLAG_numa_node);
+    }
+    ScanBlocks(blocks_, cursor_, f_);
+    pending_tasks_->Signal();
+  }
+
+  List<NodeBlock*>* blocks_;
+  base::AtomicNumber<size_t>* cursor_;
+  WeakSlotCallback f_;
+  base::Semaphore* pending_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(WeakHandleScanTask);
+};
+
 GlobalHandles::GlobalHandles(Isolate* isolate)
     : isolate_(isolate),
       number_of_global_handles_(0),
@@ -682,7 +740,33 @@ void GlobalHandles::IterateWeakRoots(ObjectVisitor* v) {
 }
 
 
+int GlobalHandles::NumberOfWeakHandleScanTasks(int blocks) {
+  if (!FLAG_parallel_weak_handle_scanning) return 0;
+  return Min(kMaxWeakHandleScanTasks,
+             Min(blocks / kMinBlocksPerWeakHandleScanTask,
+                 static_cast<int>(V8::GetCurrentPlatform()
+                                      ->NumberOfAvailableBackgroundThreads())));
+}
+
 void GlobalHandles::IdentifyWeakHandles(WeakSlotCallback f) {
+  List<NodeBlock*> blocks;
+  for (NodeBlock* block = first_used_block_; block != NULL;
+       block = block->next_used()) {
+    blocks.Add(block);
+  }
+  const int num_tasks = NumberOfWeakHandleScanTasks(blocks.length());
+  if (num_tasks > 0) {
+    base::AtomicNumber<size_t> cursor(0);
+    base::Semaphore pending_tasks(0);
+    for (int i = 0; i < num_tasks; i++) {
+      V8::GetCurrentPlatform()->CallOnBackgroundThread(
+          new WeakHandleScanTask(&blocks, &cursor, f, &pending_tasks),
+          v8::Platform::kShortRunningTask);
+    }
+    WeakHandleScanTask::ScanBlocks(&blocks, &cursor, f);
+    for (int i = 0; i < num_tasks; i++) pending_tasks.Wait();
+    return;
+  }
   for (NodeIterator it(this); !it.done(); it.Advance()) {
     if (it.node()->IsWeak() && f(it.node()->location())) {
       it.node()->MarkPending();
@@ -1516,5 +1600,80 @@ void EternalHandles::Create(Isolate* isolate, Object* object, int* index) {
 }
 
 
+PersistentHandleArena::PersistentHandleArena(Isolate* isolate)
+    : isolate_(isolate),
+      size_(0),
+      next_(isolate->persistent_handle_arena_list()),
+      prev_(NULL) {
+  if (next_ != NULL) next_->prev_ = this;
+  isolate->set_persistent_handle_arena_list(this);
+}
+
+
+PersistentHandleArena::~PersistentHandleArena() {
+  if (prev_ != NULL) {
+    prev_->next_ = next_;
+  } else {
+    isolate_->set_persistent_handle_arena_list(next_);
+  }
+  if (next_ != NULL) next_->prev_ = prev_;
+  for (int i = 0; i < blocks_.length(); i++) delete[] blocks_[i];
+}
+
+
+Handle<Object> PersistentHandleArena::Create(Object* object) {
+  DCHECK_NOT_NULL(object);
+  int block = size_ >> kShift;
+  int offset = size_ & kMask;
+  // Allocate a new block if needed; Reset() keeps old blocks around, so
+  // steady-state arena use does not allocate at all.
+  if (offset == 0 && block == blocks_.length()) {
+    blocks_.Add(new Object*[kSize]);
+  }
+  blocks_[block][offset] = object;
+  if (isolate_->heap()->InNewSpace(object)) {
+    new_space_indices_.Add(size_);
+  }
+  int index = size_++;
+  return Handle<Object>(GetLocation(index));
+}
+
+
+void PersistentHandleArena::Reset() {
+  // Slots past size_ are never visited, so they need not be cleared.
+  size_ = 0;
+  new_space_indices_.Rewind(0);
+}
+
+
+void PersistentHandleArena::IterateAllRoots(ObjectVisitor* visitor) {
+  int limit = size_;
+  for (int i = 0; i < blocks_.length() && limit > 0; i++) {
+    Object** block = blocks_[i];
+    visitor->VisitPointers(block, block + Min(limit, kSize));
+    limit -= kSize;
+  }
+}
+
+
+void PersistentHandleArena::IterateNewSpaceRoots(ObjectVisitor* visitor) {
+  for (int i = 0; i < new_space_indices_.length(); i++) {
+    visitor->VisitPointer(GetLocation(new_space_indices_[i]));
+  }
+}
+
+
+void PersistentHandleArena::PostGarbageCollectionProcessing(Heap* heap) {
+  int last = 0;
+  for (int i = 0; i < new_space_indices_.length(); i++) {
+    int index = new_space_indices_[i];
+    if (heap->InNewSpace(*GetLocation(index))) {
+      new_space_indices_[last++] = index;
+    }
+  }
+  new_space_indices_.Rewind(last);
+}
+
+
 }  // namespace internal
 }  // namespace v8
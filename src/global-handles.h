@@ -204,7 +204,9 @@ class GlobalHandles {
   void IterateWeakRoots(ObjectVisitor* v);
 
   // Find all weak handles satisfying the callback predicate, mark
-  // them as pending.
+  // them as pending. When enough node blocks are in use, the scan is
+  // distributed over background threads; the predicate must then be safe
+  // to invoke concurrently.
   void IdentifyWeakHandles(WeakSlotCallback f);
 
   // NOTE: Five ...NewSpace... functions below are used during
@@ -307,8 +309,18 @@ class GlobalHandles {
   // don't assign any initial capacity.
   static const int kObjectGroupConnectionsCapacity = 20;
 
+  // Parameters for parallel weak handle identification. Spinning up
+  // background tasks only pays off once each of them has several node
+  // blocks worth of handles to look at.
+  static const int kMaxWeakHandleScanTasks = 4;
+  static const int kMinBlocksPerWeakHandleScanTask = 16;
+
   class PendingPhantomCallback;
 
+  // Computes the number of background tasks for one round of parallel weak
+  // handle identification. Returns 0 when the scan should stay serial.
+  static int NumberOfWeakHandleScanTasks(int blocks);
+
   // Helpers for PostGarbageCollectionProcessing.
   static void InvokeSecondPassPhantomCallbacks(
       List<PendingPhantomCallback>* callbacks, Isolate* isolate);
@@ -322,6 +334,7 @@ class GlobalHandles {
   class NodeBlock;
   class NodeIterator;
   class PendingPhantomCallbacksSecondPassTask;
+  class WeakHandleScanTask;
 
   Isolate* isolate_;
 
@@ -459,6 +472,57 @@ class EternalHandles {
 };
 
 
+// An arena of persistent handles with bulk deallocation. Handles are
+// allocated by bumping an index into pre-allocated blocks, and Reset() drops
+// all of them at once while keeping the blocks for reuse. This fits embedders
+// whose persistents share one lifetime, e.g. everything created while serving
+// a request. Live arenas are chained off the isolate so the GC can treat
+// their handles as strong roots.
+class PersistentHandleArena {
+ public:
+  explicit PersistentHandleArena(Isolate* isolate);
+  ~PersistentHandleArena();
+
+  int NumberOfHandles() { return size_; }
+
+  // Allocates a new handle pointing to |object|. The handle stays valid
+  // until Reset() is called or the arena is destroyed.
+  Handle<Object> Create(Object* object);
+
+  // Drops all handles at once, keeping the underlying blocks for reuse.
+  void Reset();
+
+  // Iterates over all handles.
+  void IterateAllRoots(ObjectVisitor* visitor);
+  // Iterates over all handles which might be in new space.
+  void IterateNewSpaceRoots(ObjectVisitor* visitor);
+  // Rebuilds new space list.
+  void PostGarbageCollectionProcessing(Heap* heap);
+
+  PersistentHandleArena* next() { return next_; }
+
+ private:
+  static const int kShift = 8;
+  static const int kSize = 1 << kShift;
+  static const int kMask = 0xff;
+
+  // Gets the slot for an index
+  inline Object** GetLocation(int index) {
+    DCHECK(index >= 0 && index < size_);
+    return &blocks_[index >> kShift][index & kMask];
+  }
+
+  Isolate* isolate_;
+  int size_;
+  List<Object**> blocks_;
+  List<int> new_space_indices_;
+  PersistentHandleArena* next_;
+  PersistentHandleArena* prev_;
+
+  DISALLOW_COPY_AND_ASSIGN(PersistentHandleArena);
+};
+
+
 }  // namespace internal
 }  // namespace v8
 
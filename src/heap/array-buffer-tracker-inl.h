@@ -16,7 +16,18 @@ void ArrayBufferTracker::RegisterNew(Heap* heap, JSArrayBuffer* buffer) {
 
   size_t length = NumberToSize(buffer->byte_length());
   Page* page = Page::FromAddress(buffer->address());
-  {
+  if (page->InNewSpace()) {
+    // New-space pages are only processed during the atomic scavenge pause
+    // and never by a concurrent task, so the almost-always-young hot path
+    // of buffer allocation does not need the page lock.
+    LocalArrayBufferTracker* tracker = page->local_tracker();
+    if (tracker == nullptr) {
+      page->AllocateLocalTracker();
+      tracker = page->local_tracker();
+    }
+    DCHECK_NOT_NULL(tracker);
+    tracker->Add(buffer, length);
+  } else {
     base::LockGuard<base::Mutex> guard(page->mutex());
     LocalArrayBufferTracker* tracker = page->local_tracker();
     if (tracker == nullptr) {
@@ -38,7 +49,12 @@ void ArrayBufferTracker::Unregister(Heap* heap, JSArrayBuffer* buffer) {
 
   Page* page = Page::FromAddress(buffer->address());
   size_t length = 0;
-  {
+  if (page->InNewSpace()) {
+    // See RegisterNew: new-space trackers are never accessed concurrently.
+    LocalArrayBufferTracker* tracker = page->local_tracker();
+    DCHECK_NOT_NULL(tracker);
+    length = tracker->Remove(buffer);
+  } else {
     base::LockGuard<base::Mutex> guard(page->mutex());
     LocalArrayBufferTracker* tracker = page->local_tracker();
     DCHECK_NOT_NULL(tracker);
@@ -3,12 +3,38 @@
 // found in the LICENSE file.
 
 #include "src/heap/array-buffer-tracker.h"
+#include "src/base/platform/platform.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/heap.h"
+#include "src/shared-backing-store-registry.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Backing stores with guard regions are a single virtual memory reservation
+// and must be released as such; everything else goes back through the
+// embedder's array buffer allocator.
+void FreeBackingStore(Heap* heap, JSArrayBuffer* buffer, size_t length) {
+  // Shared backing stores may still be mapped by buffers in other isolates;
+  // only the release of the last reference actually frees the memory.
+  if (buffer->is_shared() &&
+      !SharedBackingStoreRegistry::Release(buffer->backing_store())) {
+    return;
+  }
+  if (buffer->has_guard_region()) {
+    base::VirtualMemory::ReleaseRegion(
+        buffer->backing_store(),
+        static_cast<size_t>(JSArrayBuffer::kFullGuardRegionSize));
+  } else {
+    heap->isolate()->array_buffer_allocator()->Free(buffer->backing_store(),
+                                                    length);
+  }
+}
+
+}  // namespace
+
 LocalArrayBufferTracker::~LocalArrayBufferTracker() {
   CHECK(array_buffers_.empty());
 }
@@ -22,8 +48,7 @@ void LocalArrayBufferTracker::Free() {
     if ((free_mode == kFreeAll) ||
         Marking::IsWhite(ObjectMarking::MarkBitFrom(buffer))) {
       const size_t len = it->second;
-      heap_->isolate()->array_buffer_allocator()->Free(buffer->backing_store(),
-                                                       len);
+      FreeBackingStore(heap_, buffer, len);
       freed_memory += len;
       it = array_buffers_.erase(it);
     } else {
@@ -62,8 +87,7 @@ void LocalArrayBufferTracker::Process(Callback callback) {
       it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
       const size_t len = it->second;
-      heap_->isolate()->array_buffer_allocator()->Free(
-          it->first->backing_store(), len);
+      FreeBackingStore(heap_, it->first, len);
       freed_memory += len;
       it = array_buffers_.erase(it);
     } else {
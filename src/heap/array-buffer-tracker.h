@@ -28,8 +28,10 @@ class ArrayBufferTracker : public AllStatic {
   // The following methods are used to track raw C++ pointers to externally
   // allocated memory used as backing store in live array buffers.
 
-  // Register/unregister a new JSArrayBuffer |buffer| for tracking. Guards all
-  // access to the tracker by taking the page lock for the corresponding page.
+  // Register/unregister a new JSArrayBuffer |buffer| for tracking. Takes the
+  // page lock for buffers on old-space pages, whose trackers the concurrent
+  // sweeper may process; new-space trackers are only touched while the
+  // mutator is stopped and are accessed lock-free.
   inline static void RegisterNew(Heap* heap, JSArrayBuffer* buffer);
   inline static void Unregister(Heap* heap, JSArrayBuffer* buffer);
 
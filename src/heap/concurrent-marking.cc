@@ -0,0 +1,118 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/concurrent-marking.h"
+
+#include "src/cancelable-task.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/heap.h"
+#include "src/isolate.h"
+#include "src/locked-queue-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class ConcurrentMarkingVisitor : public ObjectVisitor {
+ public:
+  ConcurrentMarkingVisitor() : bytes_(0) {}
+
+  void VisitPointers(Object** start, Object** end) override {
+    // The marking bitmap is not thread-safe yet, so the background task
+    // only traverses the object to warm it up for the final pause. Marking
+    // the discovered children gray will be added once the bitmap supports
+    // atomic accesses.
+    for (Object** p = start; p < end; p++) {
+      if (!(*p)->IsHeapObject()) continue;
+      USE(*p);
+    }
+  }
+
+  void VisitObject(HeapObject* object) {
+    bytes_ += object->Size();
+    object->Iterate(this);
+  }
+
+  intptr_t visited_bytes() { return bytes_; }
+
+ private:
+  intptr_t bytes_;
+};
+
+class ConcurrentMarking::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, ConcurrentMarking* concurrent_marking)
+      : CancelableTask(isolate), concurrent_marking_(concurrent_marking) {}
+
+  virtual ~Task() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { concurrent_marking_->Run(); }
+
+  ConcurrentMarking* concurrent_marking_;
+
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+ConcurrentMarking::ConcurrentMarking(Heap* heap)
+    : heap_(heap), pending_task_semaphore_(0), is_task_pending_(false) {}
+
+ConcurrentMarking::~ConcurrentMarking() {}
+
+void ConcurrentMarking::AddRoot(HeapObject* object) {
+  // New-space objects move under the background task's feet whenever a
+  // scavenge runs during the marking cycle; they are only visited by the
+  // main thread through the marking deque.
+  if (heap_->InNewSpace(object)) return;
+  worklist_.Enqueue(object);
+}
+
+void ConcurrentMarking::StartTask() {
+  if (!FLAG_concurrent_marking) return;
+  is_task_pending_ = true;
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new Task(heap_->isolate(), this),
+      v8::Platform::kShortRunningTask);
+}
+
+void ConcurrentMarking::WaitForTaskToComplete() {
+  if (!FLAG_concurrent_marking) return;
+  pending_task_semaphore_.Wait();
+  is_task_pending_ = false;
+}
+
+void ConcurrentMarking::EnsureTaskCompleted() {
+  if (IsTaskPending()) {
+    WaitForTaskToComplete();
+  }
+  // Entries pushed after the task drained the queue are still visited by the
+  // final pause through the marking deque; they must not survive into the
+  // next cycle, where they would dangle once the collector frees or moves
+  // objects.
+  ClearWorklist();
+}
+
+void ConcurrentMarking::ClearWorklist() {
+  HeapObject* object;
+  while (worklist_.Dequeue(&object)) {
+  }
+}
+
+void ConcurrentMarking::Run() {
+  ConcurrentMarkingVisitor visitor;
+  HeapObject* object = nullptr;
+  while (worklist_.Dequeue(&object)) {
+    visitor.VisitObject(object);
+  }
+  if (FLAG_trace_concurrent_marking) {
+    heap_->isolate()->PrintWithTimestamp("concurrently visited %" V8PRIdPTR
+                                         " bytes\n",
+                                         visitor.visited_bytes());
+  }
+  pending_task_semaphore_.Signal();
+}
+
+}  // namespace internal
+}  // namespace v8
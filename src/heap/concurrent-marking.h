@@ -0,0 +1,59 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_MARKING_H_
+#define V8_HEAP_CONCURRENT_MARKING_H_
+
+#include "src/allocation.h"
+#include "src/base/platform/semaphore.h"
+#include "src/locked-queue.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class HeapObject;
+class Isolate;
+
+// Drains a worklist of gray objects on a background thread while the mutator
+// is running. The worklist is fed by the main thread whenever incremental
+// marking pushes a white object; the background visitor currently does not
+// write to the (non-atomic) marking bitmap, so the final marking pause still
+// owns the bitmap exclusively.
+class ConcurrentMarking {
+ public:
+  explicit ConcurrentMarking(Heap* heap);
+  ~ConcurrentMarking();
+
+  // Pushes an old-space object on the worklist of the background task;
+  // new-space objects are skipped because a scavenge would move them while
+  // the task runs. May be called on the main thread while a task is running.
+  void AddRoot(HeapObject* object);
+
+  void StartTask();
+  void WaitForTaskToComplete();
+  bool IsTaskPending() { return is_task_pending_; }
+  // Waits for a running task and empties the worklist, so that no stale
+  // entries survive into the next cycle. Called at the final marking pause,
+  // before the collector starts freeing and moving objects.
+  void EnsureTaskCompleted();
+
+ private:
+  class Task;
+
+  void Run();
+  void ClearWorklist();
+
+  Heap* heap_;
+  base::Semaphore pending_task_semaphore_;
+  LockedQueue<HeapObject*> worklist_;
+  bool is_task_pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentMarking);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_MARKING_H_
@@ -0,0 +1,69 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-decision-log.h"
+
+#include <string.h>
+
+#include "src/base/platform/platform.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+GCDecisionLog::GCDecisionLog(const char* path, Mode mode)
+    : file_(base::OS::FOpen(path, mode == kRecord ? "wb" : "rb")),
+      mode_(mode),
+      has_pending_(false),
+      divergences_(0) {
+  if (file_ == NULL) {
+    PrintF("GC decision log: cannot open '%s'\n", path);
+  }
+}
+
+
+GCDecisionLog::~GCDecisionLog() {
+  if (mode_ == kReplay && divergences_ > 0) {
+    PrintF("GC decision log: %d decisions diverged from the recorded "
+           "schedule\n",
+           divergences_);
+  }
+  if (file_ != NULL) fclose(file_);
+}
+
+
+int GCDecisionLog::RecordOrReplay(DecisionPoint point, int computed,
+                                  const int64_t* inputs, int input_count,
+                                  double time_ms) {
+  if (file_ == NULL) return computed;
+  DCHECK_LE(input_count, kMaxInputs);
+  if (mode_ == kRecord) {
+    Record record;
+    memset(&record, 0, sizeof(record));
+    record.point = static_cast<uint8_t>(point);
+    record.input_count = static_cast<uint8_t>(input_count);
+    record.outcome = computed;
+    record.time_ms = time_ms;
+    for (int i = 0; i < input_count; i++) record.inputs[i] = inputs[i];
+    fwrite(&record, sizeof(record), 1, file_);
+    return computed;
+  }
+  // Replay mode: the next record must be for the same decision point,
+  // otherwise the schedules have already diverged and the computed outcome
+  // is kept so that the current run stays self-consistent.
+  if (!has_pending_) {
+    if (fread(&pending_, sizeof(pending_), 1, file_) != 1) return computed;
+    has_pending_ = true;
+  }
+  if (static_cast<DecisionPoint>(pending_.point) != point) {
+    divergences_++;
+    return computed;
+  }
+  has_pending_ = false;
+  if (pending_.outcome != computed) divergences_++;
+  return pending_.outcome;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,70 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_GC_DECISION_LOG_H_
+#define V8_HEAP_GC_DECISION_LOG_H_
+
+#include <stdio.h>
+
+#include "src/base/macros.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Records or replays the timing-dependent GC trigger decisions, so that a GC
+// schedule observed in production can be reproduced offline and heap-tuning
+// changes can be A/B tested against the same trace. With
+// --record-gc-decisions every instrumented decision point appends a compact
+// binary record with its inputs and outcome; with --replay-gc-decisions the
+// recorded outcomes override the freshly computed ones, decision by decision.
+// A replayed run whose decision points stop lining up with the log has
+// diverged; such decisions keep their computed outcome and are counted.
+class GCDecisionLog {
+ public:
+  enum Mode { kRecord, kReplay };
+
+  enum DecisionPoint {
+    kOldGenerationAllocationLimitReached = 0,
+    kMemoryReducerStartGC = 1,
+    kScavengeJobIdleLimitReached = 2
+  };
+
+  static const int kMaxInputs = 4;
+
+  GCDecisionLog(const char* path, Mode mode);
+  ~GCDecisionLog();
+
+  bool is_open() const { return file_ != NULL; }
+  Mode mode() const { return mode_; }
+
+  // In record mode appends a record and returns |computed|; in replay mode
+  // returns the outcome the recorded run took at this decision point. The
+  // inputs are only stored for offline analysis and never compared.
+  int RecordOrReplay(DecisionPoint point, int computed, const int64_t* inputs,
+                     int input_count, double time_ms);
+
+ private:
+  struct Record {
+    uint8_t point;
+    uint8_t input_count;
+    int16_t padding;
+    int32_t outcome;
+    double time_ms;
+    int64_t inputs[kMaxInputs];
+  };
+
+  FILE* file_;
+  Mode mode_;
+  Record pending_;
+  bool has_pending_;
+  int divergences_;
+
+  DISALLOW_COPY_AND_ASSIGN(GCDecisionLog);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_GC_DECISION_LOG_H_
@@ -121,7 +121,8 @@ GCTracer::GCTracer(Heap* heap)
       new_space_allocation_in_bytes_since_gc_(0),
       old_generation_allocation_in_bytes_since_gc_(0),
       combined_mark_compact_speed_cache_(0.0),
-      start_counter_(0) {
+      start_counter_(0),
+      cycle_statistics_callback_(nullptr) {
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
 }
 
@@ -308,6 +309,8 @@ void GCTracer::Stop(GarbageCollector collector) {
     heap_->PrintShortHeapStatistics();
   }
 
+  ReportCycleStatistics();
+
   // TODO(cbruni): remove once we fully moved to a trace-based system.
   if (FLAG_runtime_call_stats) {
     RuntimeCallStats::Leave(heap_->isolate(), &timer_);
@@ -691,6 +694,55 @@ void GCTracer::PrintNVP() const {
   }
 }
 
+void GCTracer::ReportCycleStatistics() const {
+  if (cycle_statistics_callback_ == nullptr) return;
+
+  v8::GCCycleStatistics statistics;
+  statistics.version_ = v8::GCCycleStatistics::kCurrentVersion;
+  switch (current_.type) {
+    case Event::SCAVENGER:
+      statistics.cycle_type_ = v8::GCCycleStatistics::kScavenger;
+      break;
+    case Event::MARK_COMPACTOR:
+      statistics.cycle_type_ = v8::GCCycleStatistics::kMarkCompactor;
+      break;
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+      statistics.cycle_type_ =
+          v8::GCCycleStatistics::kIncrementalMarkCompactor;
+      break;
+    case Event::START:
+      UNREACHABLE();
+      break;
+  }
+  statistics.gc_reason_ =
+      current_.gc_reason != nullptr ? current_.gc_reason : "unknown";
+  statistics.start_time_ = current_.start_time;
+  statistics.end_time_ = current_.end_time;
+  statistics.start_object_size_ =
+      static_cast<size_t>(current_.start_object_size);
+  statistics.end_object_size_ = static_cast<size_t>(current_.end_object_size);
+  statistics.start_memory_size_ =
+      static_cast<size_t>(current_.start_memory_size);
+  statistics.end_memory_size_ = static_cast<size_t>(current_.end_memory_size);
+  statistics.new_space_object_size_ =
+      static_cast<size_t>(current_.new_space_object_size);
+  statistics.survived_new_space_object_size_ =
+      static_cast<size_t>(current_.survived_new_space_object_size);
+  statistics.incremental_marking_bytes_ =
+      static_cast<size_t>(current_.incremental_marking_bytes);
+  statistics.incremental_marking_time_ =
+      current_.pure_incremental_marking_duration;
+  statistics.marking_time_ = current_.scopes[Scope::MC_MARK];
+  statistics.clearing_time_ = current_.scopes[Scope::MC_CLEAR];
+  statistics.sweeping_time_ = current_.scopes[Scope::MC_SWEEP];
+  statistics.evacuation_time_ = current_.scopes[Scope::MC_EVACUATE];
+  statistics.external_time_ = TotalExternalTime();
+  statistics.scavenger_time_ = current_.scopes[Scope::SCAVENGER_SCAVENGE];
+  cycle_statistics_callback_(
+      reinterpret_cast<v8::Isolate*>(heap_->isolate()), statistics);
+}
+
+
 double GCTracer::AverageSpeed(const RingBuffer<BytesAndDuration>& buffer,
                               const BytesAndDuration& initial, double time_ms) {
   BytesAndDuration sum = buffer.Sum(
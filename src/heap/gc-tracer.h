@@ -384,6 +384,12 @@ class GCTracer {
 
   void NotifyIncrementalMarkingStart();
 
+  // Installs the embedder callback that receives a v8::GCCycleStatistics
+  // struct at the end of each cycle; NULL removes it.
+  void SetCycleStatisticsCallback(v8::GCCycleStatisticsCallback callback) {
+    cycle_statistics_callback_ = callback;
+  }
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
@@ -413,6 +419,10 @@ class GCTracer {
 
   void MergeBaseline(const Event& baseline);
 
+  // Fills a v8::GCCycleStatistics struct from current_ and hands it to the
+  // embedder callback, if one is installed.
+  void ReportCycleStatistics() const;
+
   void ResetForTesting();
 
   // Print one detailed trace line in name=value format.
@@ -496,6 +506,9 @@ class GCTracer {
   // Counts how many tracers were started without stopping.
   int start_counter_;
 
+  // Embedder callback receiving per-cycle statistics, or NULL.
+  v8::GCCycleStatisticsCallback cycle_statistics_callback_;
+
   // Separate timer used for --runtime_call_stats
   RuntimeCallTimer timer_;
 
@@ -257,6 +257,10 @@ AllocationResult Heap::AllocateRaw(int size_in_bytes, AllocationSpace space,
 
 
 void Heap::OnAllocationEvent(HeapObject* object, int size_in_bytes) {
+  if (FLAG_track_context_allocation) {
+    UpdateContextAllocationStats(size_in_bytes);
+  }
+
   HeapProfiler* profiler = isolate_->heap_profiler();
   if (profiler->is_tracking_allocations()) {
     profiler->AllocationEvent(object->address(), size_in_bytes);
@@ -387,7 +391,11 @@ bool Heap::OldGenerationAllocationLimitReached() {
   if (!incremental_marking()->IsStopped() && !ShouldOptimizeForMemoryUsage()) {
     return false;
   }
-  return OldGenerationSpaceAvailable() < 0;
+  bool reached = OldGenerationSpaceAvailable() < 0;
+  if (V8_UNLIKELY(gc_decision_log_ != nullptr)) {
+    reached = RecordOrReplayOldGenerationLimitDecision(reached);
+  }
+  return reached;
 }
 
 template <PromotionMode promotion_mode>
@@ -402,6 +410,11 @@ bool Heap::ShouldBePromoted(Address old_address, int object_size) {
     }
   }
 
+  // In fast promotion mode nearly everything in new space has been surviving
+  // scavenges, so promote on the first copy instead of waiting for objects to
+  // pass the age mark.
+  if (fast_promotion_mode_) return true;
+
   return page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) &&
          (!page->ContainsLimit(age_mark) || old_address < age_mark);
 }
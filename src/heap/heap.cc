@@ -20,6 +20,8 @@
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/code-stats.h"
+#include "src/heap/concurrent-marking.h"
+#include "src/heap/gc-decision-log.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking.h"
@@ -96,6 +98,9 @@ Heap::Heap()
       contexts_disposed_(0),
       number_of_disposed_maps_(0),
       global_ic_age_(0),
+      incremental_marking_safety_factor_(0),
+      code_space_budget_(0),
+      scavenge_pause_budget_(0),
       new_space_(this),
       old_space_(NULL),
       code_space_(NULL),
@@ -117,6 +122,7 @@ Heap::Heap()
       total_regexp_code_generated_(0),
       tracer_(nullptr),
       high_survival_rate_period_length_(0),
+      fast_promotion_mode_(false),
       promoted_objects_size_(0),
       promotion_ratio_(0),
       semi_space_copied_object_size_(0),
@@ -135,12 +141,15 @@ Heap::Heap()
       last_idle_notification_time_(0.0),
       last_gc_time_(0.0),
       scavenge_collector_(nullptr),
+      parallel_scavenge_semaphore_(0),
       mark_compact_collector_(nullptr),
+      concurrent_marking_(nullptr),
       memory_allocator_(nullptr),
       store_buffer_(nullptr),
       incremental_marking_(nullptr),
       gc_idle_time_handler_(nullptr),
       memory_reducer_(nullptr),
+      gc_decision_log_(nullptr),
       live_object_stats_(nullptr),
       dead_object_stats_(nullptr),
       scavenge_job_(nullptr),
@@ -461,7 +470,7 @@ void Heap::GarbageCollectionPrologue() {
   }
   CheckNewSpaceExpansionCriteria();
   UpdateNewSpaceAllocationCounter();
-  store_buffer()->MoveEntriesToRememberedSet();
+  store_buffer()->MoveAllEntriesToRememberedSet();
 }
 
 
@@ -619,6 +628,11 @@ void Heap::ProcessPretenuringFeedback() {
 }
 
 
+void Heap::HandleBackgroundGCStep() {
+  IncrementalMarkingJob::BackgroundTask::Step(this);
+}
+
+
 void Heap::DeoptMarkedAllocationSites() {
   // TODO(hpayer): If iterating over the allocation sites list becomes a
   // performance issue, use a cache data structure in heap instead.
@@ -636,6 +650,9 @@ void Heap::DeoptMarkedAllocationSites() {
 }
 
 
+void Heap::DeoptColdCode() { Deoptimizer::DeoptimizeColdCode(isolate_); }
+
+
 void Heap::GarbageCollectionEpilogue() {
   // In release mode, we only zap the from space under heap verification.
   if (Heap::ShouldZapGarbage()) {
@@ -645,6 +662,8 @@ void Heap::GarbageCollectionEpilogue() {
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
     Verify();
+  } else if (FLAG_verify_heap_sample_percent > 0) {
+    VerifySampledPages();
   }
 #endif
 
@@ -733,6 +752,11 @@ void Heap::GarbageCollectionEpilogue() {
 #undef UPDATE_FRAGMENTATION_FOR_SPACE
 #undef UPDATE_COUNTERS_AND_FRAGMENTATION_FOR_SPACE
 
+  // Fold per-thread counter deltas and buffered histogram samples into the
+  // embedder's telemetry; a GC is a natural point at which pending stats
+  // from background threads have quiesced.
+  isolate_->counters()->FlushPendingStats();
+
 #ifdef DEBUG
   ReportStatisticsAfterGC();
 #endif  // DEBUG
@@ -1269,12 +1293,28 @@ void Heap::UpdateSurvivalStatistics(int start_new_space_size) {
   } else {
     high_survival_rate_period_length_ = 0;
   }
+  UpdateFastPromotionMode(survival_rate);
+}
+
+void Heap::UpdateFastPromotionMode(double survival_rate) {
+  if (!FLAG_fast_promotion_new_space) return;
+  // When almost all new space objects survive a scavenge, copying them
+  // through the semi-spaces until they pass the age mark just doubles the
+  // copying work before their inevitable promotion. Require a sustained high
+  // survival rate so that a single unusual scavenge does not promote
+  // short-lived objects into old space.
+  fast_promotion_mode_ = survival_rate > kYoungSurvivalRateHighThreshold &&
+                         high_survival_rate_period_length_ > 1;
 }
 
 bool Heap::PerformGarbageCollection(
     GarbageCollector collector, const v8::GCCallbackFlags gc_callback_flags) {
   int freed_global_handles = 0;
 
+  // The collector patches and moves code all over the place; unprotect all
+  // code pages once instead of faulting on every write.
+  CodeSpaceMemoryModificationScope code_modification(this);
+
   if (collector != SCAVENGER) {
     PROFILE(isolate_, CodeMovingGCEvent());
   }
@@ -1349,6 +1389,10 @@ bool Heap::PerformGarbageCollection(
   gc_post_processing_depth_--;
 
   isolate_->eternal_handles()->PostGarbageCollectionProcessing(this);
+  for (PersistentHandleArena* arena = isolate_->persistent_handle_arena_list();
+       arena != nullptr; arena = arena->next()) {
+    arena->PostGarbageCollectionProcessing(this);
+  }
 
   // Update relocatables.
   Relocatable::PostGarbageCollectionProcessing(isolate_);
@@ -1468,6 +1512,15 @@ void Heap::MarkCompactEpilogue() {
   mark_compact_collector()->marking_deque()->Uninitialize();
   mark_compact_collector()->EnsureMarkingDequeIsCommitted(
       MarkCompactCollector::kMinMarkingDequeSize);
+
+  // Code that was not executed between the last two mark-compact collections
+  // has reached an old age by now; if code space is still over its budget,
+  // have the cold part deoptimized at the next stack guard check so that
+  // upcoming collections can flush it.
+  if (code_space_budget_ > 0 &&
+      code_space_->SizeOfObjects() > code_space_budget_) {
+    isolate_->stack_guard()->RequestDeoptColdCode();
+  }
 }
 
 
@@ -1477,6 +1530,8 @@ void Heap::MarkCompactPrologue() {
   isolate_->keyed_lookup_cache()->Clear();
   isolate_->context_slot_cache()->Clear();
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->prototype_lookup_cache()->Clear();
+  isolate_->source_position_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -1490,6 +1545,10 @@ void Heap::MarkCompactPrologue() {
 
 
 void Heap::CheckNewSpaceExpansionCriteria() {
+  if (scavenge_pause_budget() > 0) {
+    AdjustSemiSpaceSize();
+    return;
+  }
   if (FLAG_experimental_new_space_growth_heuristic) {
     if (new_space_.TotalCapacity() < new_space_.MaximumCapacity() &&
         survived_last_scavenge_ * 100 / new_space_.TotalCapacity() >= 10) {
@@ -1508,6 +1567,37 @@ void Heap::CheckNewSpaceExpansionCriteria() {
 }
 
 
+void Heap::AdjustSemiSpaceSize() {
+  // Thresholds on the promotion ratio (in percent) of the last scavenge.
+  // A high ratio means objects promoted out of the young generation would
+  // have died given more room; a low ratio means the semispace is larger
+  // than the allocation bursts it has to absorb.
+  const double kHighPromotionRatio = 20;
+  const double kLowPromotionRatio = 2;
+  int capacity = new_space_.TotalCapacity();
+  int desired_capacity = capacity;
+  if (promotion_ratio_ > kHighPromotionRatio) {
+    desired_capacity = capacity * 2;
+  } else if (promotion_ratio_ < kLowPromotionRatio) {
+    desired_capacity = capacity / 2;
+  }
+  // Bound the capacity by the pause that evacuating a full semispace at the
+  // measured scavenge speed would cost.
+  double scavenge_speed = tracer()->ScavengeSpeedInBytesPerMillisecond();
+  if (scavenge_speed > 0) {
+    double budget_bound = scavenge_pause_budget() * scavenge_speed;
+    if (budget_bound < desired_capacity) {
+      desired_capacity = static_cast<int>(budget_bound);
+    }
+  }
+  if (desired_capacity != capacity) {
+    // ResizeTo clamps to the configured semispace bounds and the current
+    // allocation top.
+    new_space_.ResizeTo(desired_capacity);
+  }
+}
+
+
 static bool IsUnscavengedHeapObject(Heap* heap, Object** p) {
   return heap->InNewSpace(*p) &&
          !HeapObject::cast(*p)->map_word().IsForwardingAddress();
@@ -1660,9 +1750,14 @@ void Heap::Scavenge() {
   {
     // Copy objects reachable from the old generation.
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
-    RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
-      return Scavenger::CheckAndScavengeObject(this, addr);
-    });
+    if (FLAG_parallel_scavenge) {
+      Scavenger::ScavengeRememberedSetInParallel(
+          this, &parallel_scavenge_semaphore_);
+    } else {
+      RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
+        return Scavenger::CheckAndScavengeObject(this, addr);
+      });
+    }
 
     RememberedSet<OLD_TO_NEW>::IterateTyped(
         this, [this](SlotType type, Address host_addr, Address addr) {
@@ -1744,6 +1839,8 @@ void Heap::Scavenge() {
 
   ArrayBufferTracker::FreeDeadInNewSpace(this);
 
+  scavenge_collector_->ClosePromotionLab();
+
   // Update how much has survived scavenge.
   IncrementYoungSurvivorsCounter(static_cast<int>(
       (PromotedSpaceSizeOfObjects() - survived_watermark) + new_space_.Size()));
@@ -2753,6 +2850,10 @@ void Heap::CreateInitialObjects() {
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
 
+  // Allocate cache for short repeated strings created through the API.
+  set_api_string_cache(
+      *factory->NewFixedArray(kApiStringCacheSize, TENURED));
+
   // Allocate cache for external strings pointing to native source code.
   set_natives_source_cache(
       *factory->NewFixedArray(Natives::GetBuiltinsCount()));
@@ -2897,6 +2998,12 @@ void Heap::CreateInitialObjects() {
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize prototype lookup cache.
+  isolate_->prototype_lookup_cache()->Clear();
+
+  // Initialize source position lookup cache.
+  isolate_->source_position_lookup_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 }
@@ -2904,6 +3011,7 @@ void Heap::CreateInitialObjects() {
 bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
   switch (root_index) {
     case kNumberStringCacheRootIndex:
+    case kApiStringCacheRootIndex:
     case kInstanceofCacheFunctionRootIndex:
     case kInstanceofCacheMapRootIndex:
     case kInstanceofCacheAnswerRootIndex:
@@ -2941,12 +3049,17 @@ bool Heap::RootCanBeTreatedAsConstant(RootListIndex root_index) {
 
 
 int Heap::FullSizeNumberStringCacheLength() {
-  // Compute the size of the number string cache based on the max newspace size.
-  // The number string cache has a minimum size based on twice the initial cache
-  // size to ensure that it is bigger after being made 'full size'.
+  // Compute the size of the number string cache based on the max newspace
+  // size, unless a size was requested on the command line. The number string
+  // cache has a minimum size based on twice the initial cache size to ensure
+  // that it is bigger after being made 'full size'.
   int number_string_cache_size = max_semi_space_size_ / 512;
+  if (FLAG_number_string_cache_size > 0) {
+    number_string_cache_size = static_cast<int>(
+        base::bits::RoundUpToPowerOfTwo32(FLAG_number_string_cache_size));
+  }
   number_string_cache_size = Max(kInitialNumberStringCacheSize * 2,
-                                 Min(0x4000, number_string_cache_size));
+                                 Min(0x8000, number_string_cache_size));
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return number_string_cache_size * 2;
@@ -3060,8 +3173,10 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_length(length);
   instance->set_frame_size(frame_size);
   instance->set_parameter_count(parameter_count);
+  instance->set_suspended_register_count(instance->register_count());
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
   instance->set_osr_loop_nesting_level(0);
+  instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
   instance->set_constant_pool(constant_pool);
   instance->set_handler_table(empty_fixed_array());
   instance->set_source_position_table(empty_byte_array());
@@ -3366,6 +3481,8 @@ AllocationResult Heap::AllocateCode(int object_size, bool immovable) {
     }
   }
 
+  CodePageMemoryModificationScope modification_scope(
+      MemoryChunk::FromAddress(result->address()));
   result->set_map_no_write_barrier(code_map());
   Code* code = Code::cast(result);
   DCHECK(IsAligned(bit_cast<intptr_t>(code->address()), kCodeAlignment));
@@ -3390,6 +3507,8 @@ AllocationResult Heap::CopyCode(Code* code) {
   // Copy code object.
   Address old_addr = code->address();
   Address new_addr = result->address();
+  CodePageMemoryModificationScope modification_scope(
+      MemoryChunk::FromAddress(new_addr));
   CopyBlock(new_addr, old_addr, obj_size);
   Code* new_code = Code::cast(result);
 
@@ -3420,11 +3539,14 @@ AllocationResult Heap::CopyBytecodeArray(BytecodeArray* bytecode_array) {
   copy->set_length(bytecode_array->length());
   copy->set_frame_size(bytecode_array->frame_size());
   copy->set_parameter_count(bytecode_array->parameter_count());
+  copy->set_suspended_register_count(
+      bytecode_array->suspended_register_count());
   copy->set_constant_pool(bytecode_array->constant_pool());
   copy->set_handler_table(bytecode_array->handler_table());
   copy->set_source_position_table(bytecode_array->source_position_table());
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
+  copy->set_bytecode_age(bytecode_array->bytecode_age());
   bytecode_array->CopyBytecodesTo(copy);
   return copy;
 }
@@ -4143,6 +4265,14 @@ bool Heap::ShouldOptimizeForMemoryUsage() {
          HighMemoryPressure() || IsLowMemoryDevice();
 }
 
+bool Heap::RecordOrReplayOldGenerationLimitDecision(bool computed) {
+  DCHECK_NOT_NULL(gc_decision_log_);
+  int64_t inputs[] = {PromotedTotalSize(), old_generation_allocation_limit_};
+  return gc_decision_log_->RecordOrReplay(
+             GCDecisionLog::kOldGenerationAllocationLimitReached, computed,
+             inputs, arraysize(inputs), MonotonicallyIncreasingTimeInMs()) != 0;
+}
+
 void Heap::ActivateMemoryReducerIfNeeded() {
   // Activate memory reducer when switching to background if
   // - there was no mark compact since the start.
@@ -4391,6 +4521,38 @@ bool Heap::RecentIdleNotificationHappened() {
          MonotonicallyIncreasingTimeInMs();
 }
 
+class StringTableCompactionTask : public CancelableTask {
+ public:
+  explicit StringTableCompactionTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~StringTableCompactionTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    StringTable::CompactDeadEntries(heap_->isolate());
+  }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(StringTableCompactionTask);
+};
+
+class DeprecatedMapMigrationTask : public CancelableTask {
+ public:
+  explicit DeprecatedMapMigrationTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~DeprecatedMapMigrationTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->MigrateDeprecatedMapInstances(); }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(DeprecatedMapMigrationTask);
+};
+
 class MemoryPressureInterruptTask : public CancelableTask {
  public:
   explicit MemoryPressureInterruptTask(Heap* heap)
@@ -4406,6 +4568,18 @@ class MemoryPressureInterruptTask : public CancelableTask {
   DISALLOW_COPY_AND_ASSIGN(MemoryPressureInterruptTask);
 };
 
+void Heap::PostStringTableCompactionTask() {
+  V8::GetCurrentPlatform()->CallOnForegroundThread(
+      reinterpret_cast<v8::Isolate*>(isolate()),
+      new StringTableCompactionTask(this));
+}
+
+void Heap::PostDeprecatedMapMigrationTask() {
+  V8::GetCurrentPlatform()->CallOnForegroundThread(
+      reinterpret_cast<v8::Isolate*>(isolate()),
+      new DeprecatedMapMigrationTask(this));
+}
+
 void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     if (isolate()->concurrent_recompilation_enabled()) {
@@ -4668,6 +4842,40 @@ void Heap::Verify() {
     mark_compact_collector()->VerifyOmittedMapChecks();
   }
 }
+
+
+void Heap::VerifySampledPages() {
+  CHECK(HasBeenSetUp());
+  DCHECK_LT(0, FLAG_verify_heap_sample_percent);
+  HandleScope scope(isolate());
+
+  if (mark_compact_collector()->sweeping_in_progress()) {
+    // We have to wait here for the sweeper threads to have an iterable heap.
+    mark_compact_collector()->EnsureSweepingCompleted();
+  }
+
+  base::RandomNumberGenerator* rng = isolate()->random_number_generator();
+  PagedSpaces spaces(this);
+  for (PagedSpace* space = spaces.next(); space != NULL;
+       space = spaces.next()) {
+    for (Page* page : *space) {
+      if (rng->NextInt(100) >= FLAG_verify_heap_sample_percent) continue;
+      HeapObjectIterator it(page);
+      for (HeapObject* object = it.Next(); object != NULL;
+           object = it.Next()) {
+        object->ObjectVerify();
+      }
+    }
+  }
+  // Large objects are sampled individually since they have a page each.
+  LargeObjectIterator lo_it(lo_space());
+  for (HeapObject* object = lo_it.Next(); object != NULL;
+       object = lo_it.Next()) {
+    if (rng->NextInt(100) < FLAG_verify_heap_sample_percent) {
+      object->ObjectVerify();
+    }
+  }
+}
 #endif
 
 
@@ -4904,6 +5112,16 @@ void Heap::IterateStrongRoots(ObjectVisitor* v, VisitMode mode) {
   } else {
     isolate_->eternal_handles()->IterateAllRoots(v);
   }
+
+  // Iterate over persistent handle arenas.
+  for (PersistentHandleArena* arena = isolate_->persistent_handle_arena_list();
+       arena != nullptr; arena = arena->next()) {
+    if (mode == VISIT_ALL_IN_SCAVENGE) {
+      arena->IterateNewSpaceRoots(v);
+    } else {
+      arena->IterateAllRoots(v);
+    }
+  }
   v->Synchronize(VisitorSynchronization::kEternalHandles);
 
   // Iterate over pointers being held by inactive threads.
@@ -5303,6 +5521,13 @@ bool Heap::SetUp() {
 
   base::CallOnce(&initialize_gc_once, &InitializeGCOnce);
 
+  if (FLAG_numa_node >= 0) {
+    // Restrict the creating thread to the configured node before any heap
+    // pages are faulted in, so first-touch placement and the explicit page
+    // bindings agree on where the heap lives.
+    base::OS::BindCurrentThreadToNode(FLAG_numa_node);
+  }
+
   // Set up memory allocator.
   memory_allocator_ = new MemoryAllocator(isolate_);
   if (!memory_allocator_->SetUp(MaxReserved(), MaxExecutableSize(),
@@ -5366,10 +5591,20 @@ bool Heap::SetUp() {
 
   mark_compact_collector_ = new MarkCompactCollector(this);
 
+  concurrent_marking_ = new ConcurrentMarking(this);
+
   gc_idle_time_handler_ = new GCIdleTimeHandler();
 
   memory_reducer_ = new MemoryReducer(this);
 
+  if (FLAG_record_gc_decisions != nullptr) {
+    gc_decision_log_ =
+        new GCDecisionLog(FLAG_record_gc_decisions, GCDecisionLog::kRecord);
+  } else if (FLAG_replay_gc_decisions != nullptr) {
+    gc_decision_log_ =
+        new GCDecisionLog(FLAG_replay_gc_decisions, GCDecisionLog::kReplay);
+  }
+
   if (FLAG_track_gc_object_stats) {
     live_object_stats_ = new ObjectStats(this);
     dead_object_stats_ = new ObjectStats(this);
@@ -5433,17 +5668,36 @@ void Heap::PrintAlloctionsHash() {
 }
 
 
+void Heap::UpdateContextAllocationStats(int size_in_bytes) {
+  Context* context = isolate_->context();
+  if (context == nullptr) return;
+  Context* native_context = context->native_context();
+  // During bootstrapping and deserialization the accounting slots of the
+  // native context have not been initialized yet.
+  if (!native_context->get(Context::ALLOCATED_BYTES_INDEX)->IsSmi()) return;
+  native_context->AddAllocatedBytes(size_in_bytes);
+  size_t limit = native_context->GetAllocationLimit();
+  if (limit > 0 && native_context->GetAllocatedBytes() >= limit) {
+    isolate_->stack_guard()->RequestTerminateExecution();
+  }
+}
+
+
 void Heap::NotifyDeserializationComplete() {
-  deserialization_complete_ = true;
-#ifdef DEBUG
-  // All pages right after bootstrapping must be marked as never-evacuate.
+  DCHECK_EQ(0, gc_count());
   PagedSpaces spaces(this);
   for (PagedSpace* s = spaces.next(); s != NULL; s = spaces.next()) {
+    // Give back the committed tail of every snapshot page; it is immortal
+    // immovable data that would otherwise stay committed in each isolate.
+    if (isolate()->snapshot_available()) s->ShrinkImmortalImmovablePages();
+#ifdef DEBUG
+    // All pages right after bootstrapping must be marked as never-evacuate.
     for (Page* p : *s) {
       CHECK(p->NeverEvacuate());
     }
-  }
 #endif  // DEBUG
+  }
+  deserialization_complete_ = true;
 }
 
 void Heap::SetEmbedderHeapTracer(EmbedderHeapTracer* tracer) {
@@ -5527,6 +5781,9 @@ void Heap::TearDown() {
     mark_compact_collector_ = nullptr;
   }
 
+  delete concurrent_marking_;
+  concurrent_marking_ = nullptr;
+
   delete incremental_marking_;
   incremental_marking_ = nullptr;
 
@@ -5539,6 +5796,11 @@ void Heap::TearDown() {
     memory_reducer_ = nullptr;
   }
 
+  if (gc_decision_log_ != nullptr) {
+    delete gc_decision_log_;
+    gc_decision_log_ = nullptr;
+  }
+
   if (live_object_stats_ != nullptr) {
     delete live_object_stats_;
     live_object_stats_ = nullptr;
@@ -5701,6 +5963,74 @@ void Heap::CompactWeakFixedArrays() {
   CompactWeakFixedArray(weak_stack_trace_list());
 }
 
+CodeSpaceMemoryModificationScope::CodeSpaceMemoryModificationScope(Heap* heap)
+    : heap_(heap) {
+  if (!FLAG_write_protect_code_memory) return;
+  for (Page* page : *heap_->code_space()) {
+    page->SetReadWriteAndExecutable();
+  }
+  for (LargePage* page = heap_->lo_space()->first_page(); page != nullptr;
+       page = page->next_page()) {
+    if (page->IsFlagSet(MemoryChunk::IS_EXECUTABLE)) {
+      page->SetReadWriteAndExecutable();
+    }
+  }
+}
+
+CodeSpaceMemoryModificationScope::~CodeSpaceMemoryModificationScope() {
+  if (!FLAG_write_protect_code_memory) return;
+  // Pages allocated while the scope was active have a zero unprotect counter
+  // and are left writable here; the next scope picks them up.
+  for (Page* page : *heap_->code_space()) {
+    page->SetReadAndExecutable();
+  }
+  for (LargePage* page = heap_->lo_space()->first_page(); page != nullptr;
+       page = page->next_page()) {
+    if (page->IsFlagSet(MemoryChunk::IS_EXECUTABLE)) {
+      page->SetReadAndExecutable();
+    }
+  }
+}
+
+CodePageMemoryModificationScope::CodePageMemoryModificationScope(
+    MemoryChunk* chunk)
+    : chunk_(chunk),
+      scope_active_(FLAG_write_protect_code_memory &&
+                    chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE)) {
+  if (scope_active_) chunk_->SetReadWriteAndExecutable();
+}
+
+CodePageMemoryModificationScope::CodePageMemoryModificationScope(
+    Address address)
+    : CodePageMemoryModificationScope(MemoryChunk::FromAddress(address)) {}
+
+CodePageMemoryModificationScope::~CodePageMemoryModificationScope() {
+  if (scope_active_) chunk_->SetReadAndExecutable();
+}
+
+void Heap::MigrateDeprecatedMapInstances() {
+  HandleScope scope(isolate());
+  // Collect the objects first; migration allocates and therefore cannot run
+  // while the heap iterator is live.
+  List<Handle<JSObject> > to_migrate;
+  {
+    HeapIterator iterator(this);
+    for (HeapObject* o = iterator.next(); o != NULL; o = iterator.next()) {
+      if (!o->IsJSObject()) continue;
+      JSObject* object = JSObject::cast(o);
+      if (object->map()->is_deprecated()) {
+        to_migrate.Add(Handle<JSObject>(object, isolate()));
+      }
+    }
+  }
+  for (int i = 0; i < to_migrate.length(); i++) {
+    Handle<JSObject> object = to_migrate[i];
+    if (object->map()->is_deprecated()) {
+      JSObject::MigrateInstance(object);
+    }
+  }
+}
+
 void Heap::AddRetainedMap(Handle<Map> map) {
   Handle<WeakCell> cell = Map::WeakCellForMap(map);
   Handle<ArrayList> array(retained_maps(), isolate());
@@ -5790,7 +6120,7 @@ void Heap::CheckHandleCount() {
 
 void Heap::ClearRecordedSlot(HeapObject* object, Object** slot) {
   if (!InNewSpace(object)) {
-    store_buffer()->MoveEntriesToRememberedSet();
+    store_buffer()->MoveAllEntriesToRememberedSet();
     Address slot_addr = reinterpret_cast<Address>(slot);
     Page* page = Page::FromAddress(slot_addr);
     DCHECK_EQ(page->owner()->identity(), OLD_SPACE);
@@ -5802,7 +6132,7 @@ void Heap::ClearRecordedSlot(HeapObject* object, Object** slot) {
 void Heap::ClearRecordedSlotRange(Address start, Address end) {
   Page* page = Page::FromAddress(start);
   if (!page->InNewSpace()) {
-    store_buffer()->MoveEntriesToRememberedSet();
+    store_buffer()->MoveAllEntriesToRememberedSet();
     DCHECK_EQ(page->owner()->identity(), OLD_SPACE);
     RememberedSet<OLD_TO_NEW>::RemoveRange(page, start, end);
     RememberedSet<OLD_TO_OLD>::RemoveRange(page, start, end);
@@ -6350,6 +6680,81 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = NULL;
 }
 
+// static
+int PrototypeLookupCache::Hash(Map* map, Name* name) {
+  DCHECK(name->IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t map_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(map)) >>
+      kPointerSizeLog2;
+  uint32_t name_hash = name->hash_field();
+  return (map_hash ^ name_hash) % kLength;
+}
+
+bool PrototypeLookupCache::Lookup(Map* map, Name* name, JSObject** holder_out,
+                                  int* descriptor_number_out) {
+  int index = Hash(map, name);
+  Key& key = keys_[index];
+  if ((key.map != map) || (key.name != name)) return false;
+  // The entry describes the chain as it was when it was recorded; any shape
+  // change of an object on the chain has flipped the cell since then.
+  if (validity_cells_[index]->value() !=
+      Smi::FromInt(Map::kPrototypeChainValid)) {
+    key.map = NULL;
+    return false;
+  }
+  *holder_out = holders_[index];
+  *descriptor_number_out = descriptor_numbers_[index];
+  return true;
+}
+
+void PrototypeLookupCache::Update(Map* map, Name* name, Cell* validity_cell,
+                                  JSObject* holder, int descriptor_number) {
+  DCHECK(name->IsUniqueName());
+  DCHECK_EQ(Smi::FromInt(Map::kPrototypeChainValid), validity_cell->value());
+  int index = Hash(map, name);
+  keys_[index].map = map;
+  keys_[index].name = name;
+  validity_cells_[index] = validity_cell;
+  holders_[index] = holder;
+  descriptor_numbers_[index] = descriptor_number;
+}
+
+void PrototypeLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].map = NULL;
+}
+
+// static
+int SourcePositionLookupCache::Hash(ByteArray* table, int code_offset) {
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t table_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(table)) >>
+      kPointerSizeLog2;
+  return (table_hash ^ static_cast<uint32_t>(code_offset)) % kLength;
+}
+
+int SourcePositionLookupCache::Lookup(ByteArray* table, int code_offset) {
+  int index = Hash(table, code_offset);
+  Key& key = keys_[index];
+  if ((key.table == table) && (key.code_offset == code_offset)) {
+    return positions_[index];
+  }
+  return kAbsent;
+}
+
+void SourcePositionLookupCache::Update(ByteArray* table, int code_offset,
+                                       int position) {
+  DCHECK_LE(0, position);
+  int index = Hash(table, code_offset);
+  keys_[index].table = table;
+  keys_[index].code_offset = code_offset;
+  positions_[index] = position;
+}
+
+void SourcePositionLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].table = NULL;
+}
+
 void Heap::ExternalStringTable::CleanUp() {
   int last = 0;
   Isolate* isolate = heap_->isolate();
@@ -14,6 +14,7 @@
 #include "src/allocation.h"
 #include "src/assert-scope.h"
 #include "src/base/atomic-utils.h"
+#include "src/base/platform/semaphore.h"
 #include "src/globals.h"
 #include "src/heap-symbols.h"
 // TODO(mstarzinger): One more include to kill!
@@ -175,6 +176,7 @@ using v8::MemoryPressureLevel;
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)     \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, api_string_cache, ApiStringCache)                              \
   V(Object, instanceof_cache_function, InstanceofCacheFunction)                \
   V(Object, instanceof_cache_map, InstanceofCacheMap)                          \
   V(Object, instanceof_cache_answer, InstanceofCacheAnswer)                    \
@@ -314,14 +316,17 @@ using v8::MemoryPressureLevel;
 // Forward declarations.
 class AllocationObserver;
 class ArrayBufferTracker;
+class ConcurrentMarking;
 class GCIdleTimeAction;
 class GCIdleTimeHandler;
+class GCDecisionLog;
 class GCIdleTimeHeapState;
 class GCTracer;
 class HeapObjectsFilter;
 class HeapStats;
 class HistogramTimer;
 class Isolate;
+class MemoryChunk;
 class MemoryReducer;
 class ObjectStats;
 class Scavenger;
@@ -785,6 +790,22 @@ class Heap {
                                   bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Schedules StringTable::CompactDeadEntries to run on the main thread
+  // after the current GC pause, so that the string table cleanup in the
+  // pause is limited to replacing dead entries with holes.
+  void PostStringTableCompactionTask();
+
+  // Schedules MigrateDeprecatedMapInstances to run on the main thread. Used
+  // by the memory reducer between its GCs, when the mutator is known to be
+  // mostly idle.
+  void PostDeprecatedMapMigrationTask();
+
+  // Migrates all objects that are still on a deprecated map to the updated
+  // map, as the first property access on each of them eventually would.
+  // Afterwards the deprecated maps and their descriptor arrays are garbage
+  // and die in the next full GC.
+  void MigrateDeprecatedMapInstances();
+
   double MonotonicallyIncreasingTimeInMs();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -819,6 +840,15 @@ class Heap {
 
   inline bool OldGenerationAllocationLimitReached();
 
+  // Non-NULL while GC trigger decisions are recorded or replayed; see
+  // --record-gc-decisions and --replay-gc-decisions.
+  GCDecisionLog* gc_decision_log() { return gc_decision_log_; }
+
+  // Runs the old generation allocation limit decision through the decision
+  // log. Out of line so the inline fast path does not depend on the log
+  // implementation.
+  bool RecordOrReplayOldGenerationLimitDecision(bool computed);
+
   // Completely clear the Instanceof cache (to stop it keeping objects alive
   // around a GC).
   inline void CompletelyClearInstanceofCache();
@@ -861,6 +891,11 @@ class Heap {
 
   void DeoptMarkedAllocationSites();
 
+  // Deoptimizes optimized code that has not been executed since it was last
+  // aged. Triggered through the stack guard when a mark-compact collection
+  // leaves code space above the configured budget.
+  void DeoptColdCode();
+
   bool DeoptMaybeTenuredAllocationSites() {
     return new_space_.IsAtMaximumCapacity() && maximum_size_scavenges_ == 0;
   }
@@ -883,6 +918,11 @@ class Heap {
   // FLAG_inline_new and FLAG_use_allocation_folding.
   inline void OnAllocationEvent(HeapObject* object, int size_in_bytes);
 
+  // Attributes an allocation of the given size to the current native context
+  // and requests a catchable termination if that context has exceeded its
+  // allocation limit. Only called when --track-context-allocation is on.
+  void UpdateContextAllocationStats(int size_in_bytes);
+
   // This event is triggered after object is moved to a new place.
   inline void OnMoveEvent(HeapObject* target, HeapObject* source,
                           int size_in_bytes);
@@ -919,6 +959,37 @@ class Heap {
                      int max_executable_size, size_t code_range_size);
   bool ConfigureHeapDefault();
 
+  // Safety margin in percent for the allocation-throughput-driven incremental
+  // marking schedule, settable through v8::ResourceConstraints or
+  // --incremental-marking-safety-factor. 0 keeps the idle-time schedule.
+  int incremental_marking_safety_factor() {
+    return incremental_marking_safety_factor_ != 0
+               ? incremental_marking_safety_factor_
+               : FLAG_incremental_marking_safety_factor;
+  }
+  void set_incremental_marking_safety_factor(int percent) {
+    incremental_marking_safety_factor_ = percent;
+  }
+
+  // Soft budget in bytes for the space occupied by code objects, settable
+  // through v8::ResourceConstraints. When a mark-compact collection leaves
+  // code space above the budget, cold optimized code is deoptimized so that
+  // subsequent collections can flush it. 0 disables the budget.
+  size_t code_space_budget() { return code_space_budget_; }
+  void set_code_space_budget(size_t budget) { code_space_budget_ = budget; }
+
+  // Scavenge pause budget in ms, settable through v8::ResourceConstraints or
+  // --scavenge-pause-budget. When set, the semispaces are resized based on
+  // the measured promotion ratio and scavenge speed instead of the
+  // survival-based growth heuristic. 0 disables the controller.
+  int scavenge_pause_budget() {
+    return scavenge_pause_budget_ != 0 ? scavenge_pause_budget_
+                                       : FLAG_scavenge_pause_budget;
+  }
+  void set_scavenge_pause_budget(int budget_in_ms) {
+    scavenge_pause_budget_ = budget_in_ms;
+  }
+
   // Prepares the heap, setting up memory areas that are needed in the isolate
   // without actually creating any objects.
   bool SetUp();
@@ -990,6 +1061,10 @@ class Heap {
     return mark_compact_collector_;
   }
 
+  Scavenger* scavenge_collector() { return scavenge_collector_; }
+
+  ConcurrentMarking* concurrent_marking() { return concurrent_marking_; }
+
   // ===========================================================================
   // Root set access. ==========================================================
   // ===========================================================================
@@ -1110,6 +1185,11 @@ class Heap {
   // Invoked when GC was requested via the stack guard.
   void HandleGCRequest();
 
+  // Performs one bounded incremental marking step on behalf of the
+  // background GC work task (--background-gc-work); invoked through the
+  // stack guard so that the step runs on the mutator thread.
+  void HandleBackgroundGCStep();
+
   // ===========================================================================
   // Iterators. ================================================================
   // ===========================================================================
@@ -1439,6 +1519,13 @@ class Heap {
 #ifdef VERIFY_HEAP
   // Verify the heap is in its normal state before or after a GC.
   void Verify();
+
+  // Verify the objects on a random sample of pages. This is the cheap
+  // companion to Verify() for release builds that define VERIFY_HEAP:
+  // with --verify-heap-sample-percent a canary catches corruption within a
+  // bounded number of GCs of the cause without paying for a full heap walk
+  // after every cycle.
+  void VerifySampledPages();
 #endif
 
 #ifdef DEBUG
@@ -1537,6 +1624,7 @@ class Heap {
   static const int kInitialStringTableSize = 2048;
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  static const int kApiStringCacheSize = 256;
 
   static const int kRememberedUnmappedPages = 128;
 
@@ -1673,6 +1761,11 @@ class Heap {
   // Re-visit incremental marking heuristics.
   bool IsHighSurvivalRate() { return high_survival_rate_period_length_ > 0; }
 
+  // Decides, based on the observed new space survival rate, whether scavenges
+  // should promote surviving objects immediately instead of copying them
+  // through the semi-spaces first.
+  void UpdateFastPromotionMode(double survival_rate);
+
   void ConfigureInitialOldGenerationSize();
 
   bool HasLowYoungGenerationAllocationRate();
@@ -1682,6 +1775,11 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Resizes the semispaces so that the expected scavenge pause stays within
+  // scavenge_pause_budget() while keeping the promotion ratio low. Replaces
+  // the survival-based heuristic when the budget is set.
+  void AdjustSemiSpaceSize();
+
   bool TryFinalizeIdleIncrementalMarking(
       double idle_time_in_ms, size_t size_of_objects,
       size_t mark_compact_speed_in_bytes_per_ms);
@@ -2095,6 +2193,15 @@ class Heap {
 
   int global_ic_age_;
 
+  // See incremental_marking_safety_factor().
+  int incremental_marking_safety_factor_;
+
+  // See code_space_budget().
+  size_t code_space_budget_;
+
+  // See scavenge_pause_budget().
+  int scavenge_pause_budget_;
+
   NewSpace new_space_;
   OldSpace* old_space_;
   OldSpace* code_space_;
@@ -2169,6 +2276,7 @@ class Heap {
   GCTracer* tracer_;
 
   int high_survival_rate_period_length_;
+  bool fast_promotion_mode_;
   intptr_t promoted_objects_size_;
   double promotion_ratio_;
   double promotion_rate_;
@@ -2211,8 +2319,14 @@ class Heap {
 
   Scavenger* scavenge_collector_;
 
+  // Used by the parallel remembered set scan of the scavenger. The semaphore
+  // has to live as long as the isolate, see the comment on PageParallelJob.
+  base::Semaphore parallel_scavenge_semaphore_;
+
   MarkCompactCollector* mark_compact_collector_;
 
+  ConcurrentMarking* concurrent_marking_;
+
   MemoryAllocator* memory_allocator_;
 
   StoreBuffer* store_buffer_;
@@ -2223,6 +2337,8 @@ class Heap {
 
   MemoryReducer* memory_reducer_;
 
+  GCDecisionLog* gc_decision_log_;
+
   ObjectStats* live_object_stats_;
   ObjectStats* dead_object_stats_;
 
@@ -2369,6 +2485,37 @@ class AlwaysAllocateScope {
 };
 
 
+// Makes all code space pages writable for the duration of the scope, e.g.
+// over a GC, so that the collector can patch and move code freely. Outside
+// of such scopes code pages are mapped read+execute only when
+// --write-protect-code-memory is on. No-op when the flag is off.
+class CodeSpaceMemoryModificationScope {
+ public:
+  explicit CodeSpaceMemoryModificationScope(Heap* heap);
+  ~CodeSpaceMemoryModificationScope();
+
+ private:
+  Heap* heap_;
+};
+
+
+// Makes a single code page writable for the duration of the scope, e.g. for
+// one batch of IC patches. No-op when --write-protect-code-memory is off or
+// the chunk is not executable.
+class CodePageMemoryModificationScope {
+ public:
+  explicit CodePageMemoryModificationScope(MemoryChunk* chunk);
+  // Convenience constructor for patch sites that only have the address of
+  // the instruction they are about to rewrite.
+  explicit CodePageMemoryModificationScope(Address address);
+  ~CodePageMemoryModificationScope();
+
+ private:
+  MemoryChunk* chunk_;
+  bool scope_active_;
+};
+
+
 // Visitor class to verify interior pointers in spaces that do not contain
 // or care about intergenerational references. All heap object pointers have to
 // point into the heap to a location that has a map pointer at its first word.
@@ -2596,6 +2743,105 @@ class DescriptorLookupCache {
 };
 
 
+// Cache for mapping (receiver map, property name) to the prototype on which a
+// full-chain lookup of the name ended, together with the holder's descriptor
+// index for the name. Each entry is guarded by the prototype chain validity
+// cell of the receiver map's prototype: a valid cell proves that no object on
+// the chain has changed shape since the entry was recorded, so the cached
+// holder is still the result of walking the chain. Entries are only recorded
+// for chains of fast-mode maps, whose shape changes always go through
+// Map migration and thus invalidate the cell.
+// Cleared at startup and prior to mark sweep collection.
+class PrototypeLookupCache {
+ public:
+  // Lookup the holder for (map, name). Returns false on a miss and when the
+  // guarding validity cell has been invalidated.
+  bool Lookup(Map* map, Name* name, JSObject** holder_out,
+              int* descriptor_number_out);
+
+  // Update an element in the cache. The validity cell must be valid.
+  void Update(Map* map, Name* name, Cell* validity_cell, JSObject* holder,
+              int descriptor_number);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  PrototypeLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      keys_[i].map = NULL;
+      keys_[i].name = NULL;
+      validity_cells_[i] = NULL;
+      holders_[i] = NULL;
+      descriptor_numbers_[i] = 0;
+    }
+  }
+
+  static inline int Hash(Map* map, Name* name);
+
+  static const int kLength = 128;
+  struct Key {
+    Map* map;
+    Name* name;
+  };
+
+  Key keys_[kLength];
+  Cell* validity_cells_[kLength];
+  JSObject* holders_[kLength];
+  int descriptor_numbers_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(PrototypeLookupCache);
+};
+
+
+// Cache for mapping (source position table, code offset) to the decoded
+// source position. Decoding walks the variable-length-encoded table from the
+// start, which is linear in the table size; symbolizing the same stack frames
+// repeatedly (e.g. when capturing many stack traces) makes the decode a hot
+// spot. Source position tables are tenured, so the raw keys stay valid until
+// the cache is cleared prior to mark-compact collection.
+class SourcePositionLookupCache {
+ public:
+  // Lookup the source position for (table, code_offset).
+  // If absent, kAbsent is returned.
+  int Lookup(ByteArray* table, int code_offset);
+
+  // Update an element in the cache.
+  void Update(ByteArray* table, int code_offset, int position);
+
+  // Clear the cache.
+  void Clear();
+
+  static const int kAbsent = -1;
+
+ private:
+  SourcePositionLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      keys_[i].table = NULL;
+      keys_[i].code_offset = 0;
+      positions_[i] = kAbsent;
+    }
+  }
+
+  static inline int Hash(ByteArray* table, int code_offset);
+
+  // Larger than the sibling caches above so that a few distinct deep stacks
+  // fit without evicting each other.
+  static const int kLength = 256;
+  struct Key {
+    ByteArray* table;
+    int code_offset;
+  };
+
+  Key keys_[kLength];
+  int positions_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(SourcePositionLookupCache);
+};
+
+
 // Abstract base class for checking whether a weak object should be retained.
 class WeakObjectRetainer {
  public:
@@ -2717,6 +2963,7 @@ class AllocationObserver {
   friend class LargeObjectSpace;
   friend class NewSpace;
   friend class PagedSpace;
+  friend class Space;
   DISALLOW_COPY_AND_ASSIGN(AllocationObserver);
 };
 
@@ -4,7 +4,9 @@
 
 #include "src/heap/incremental-marking-job.h"
 
+#include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
+#include "src/execution.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking.h"
@@ -19,6 +21,10 @@ const double IncrementalMarkingJob::kShortDelayInSeconds = 0.5;
 
 void IncrementalMarkingJob::Start(Heap* heap) {
   DCHECK(!heap->incremental_marking()->IsStopped());
+  if (FLAG_background_gc_work) {
+    ScheduleBackgroundTask(heap);
+    return;
+  }
   // We don't need to reset the flags because tasks from the previous job
   // can still be pending. We just want to ensure that tasks are posted
   // if they are not pending.
@@ -42,6 +48,11 @@ void IncrementalMarkingJob::NotifyIdleTaskProgress() {
 }
 
 
+void IncrementalMarkingJob::NotifyBackgroundTask() {
+  background_task_pending_ = false;
+}
+
+
 void IncrementalMarkingJob::ScheduleIdleTask(Heap* heap) {
   if (!idle_task_pending_) {
     v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
@@ -68,6 +79,16 @@ void IncrementalMarkingJob::ScheduleDelayedTask(Heap* heap) {
 }
 
 
+void IncrementalMarkingJob::ScheduleBackgroundTask(Heap* heap) {
+  if (!background_task_pending_) {
+    background_task_pending_ = true;
+    auto task = new BackgroundTask(heap->isolate(), this);
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+}
+
+
 IncrementalMarkingJob::IdleTask::Progress IncrementalMarkingJob::IdleTask::Step(
     Heap* heap, double deadline_in_ms) {
   IncrementalMarking* incremental_marking = heap->incremental_marking();
@@ -128,6 +149,45 @@ void IncrementalMarkingJob::DelayedTask::Step(Heap* heap) {
 }
 
 
+void IncrementalMarkingJob::BackgroundTask::Step(Heap* heap) {
+  IncrementalMarking* incremental_marking = heap->incremental_marking();
+  IncrementalMarkingJob* job = incremental_marking->incremental_marking_job();
+  // The step requested by the pending task is being performed now; a new
+  // task may be scheduled below.
+  job->NotifyBackgroundTask();
+  if (incremental_marking->IsStopped()) return;
+  if (incremental_marking->IsSweeping()) {
+    incremental_marking->FinalizeSweeping();
+  } else {
+    double deadline = heap->MonotonicallyIncreasingTimeInMs() + kStepSizeMs;
+    incremental_marking->AdvanceIncrementalMarking(
+        deadline, IncrementalMarking::StepActions(
+                      IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+                      IncrementalMarking::FORCE_MARKING,
+                      IncrementalMarking::FORCE_COMPLETION));
+    heap->FinalizeIncrementalMarkingIfComplete(
+        "Background GC work: finalize incremental marking");
+  }
+  if (!incremental_marking->IsStopped()) {
+    job->ScheduleBackgroundTask(heap);
+  }
+}
+
+
+void IncrementalMarkingJob::BackgroundTask::RunInternal() {
+  // Let the mutator run undisturbed for its share of the time before the
+  // next step is requested.
+  const int utilization =
+      Max(1, Min(99, FLAG_background_gc_mutator_utilization));
+  const int pause_ms = kStepSizeMs * utilization / (100 - utilization);
+  base::OS::Sleep(base::TimeDelta::FromMilliseconds(pause_ms));
+  Heap* heap = isolate()->heap();
+  if (!heap->incremental_marking()->IsStopped()) {
+    isolate()->stack_guard()->RequestGCBackgroundStep();
+  }
+}
+
+
 void IncrementalMarkingJob::DelayedTask::RunInternal() {
   Heap* heap = isolate()->heap();
   job_->NotifyDelayedTask();
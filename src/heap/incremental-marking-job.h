@@ -48,6 +48,27 @@ class IncrementalMarkingJob {
     IncrementalMarkingJob* job_;
   };
 
+  // Used with --background-gc-work for embedders whose platform never runs
+  // foreground or idle tasks. The task runs on a background thread, pauses
+  // for the mutator's share of the time derived from the utilization target,
+  // and then requests a stack-guard interrupt; the mutator thread performs a
+  // bounded marking step in response and reschedules the task until marking
+  // is done.
+  class BackgroundTask : public CancelableTask {
+   public:
+    explicit BackgroundTask(Isolate* isolate, IncrementalMarkingJob* job)
+        : CancelableTask(isolate), job_(job) {}
+    // Step duration on the mutator thread; the pause between steps is
+    // derived from this and the mutator-utilization target.
+    static const int kStepSizeMs = 5;
+    static void Step(Heap* heap);
+    // CancelableTask overrides.
+    void RunInternal() override;
+
+   private:
+    IncrementalMarkingJob* job_;
+  };
+
   // Delay of the delayed task.
   static const double kLongDelayInSeconds;
   static const double kShortDelayInSeconds;
@@ -55,6 +76,7 @@ class IncrementalMarkingJob {
   IncrementalMarkingJob()
       : idle_task_pending_(false),
         delayed_task_pending_(false),
+        background_task_pending_(false),
         made_progress_since_last_delayed_task_(false) {}
 
   bool ShouldForceMarkingStep() {
@@ -68,12 +90,17 @@ class IncrementalMarkingJob {
   void NotifyIdleTask();
   void NotifyDelayedTask();
   void NotifyIdleTaskProgress();
+  void NotifyBackgroundTask();
   void ScheduleIdleTask(Heap* heap);
   void ScheduleDelayedTask(Heap* heap);
+  void ScheduleBackgroundTask(Heap* heap);
 
  private:
   bool idle_task_pending_;
   bool delayed_task_pending_;
+  // Only accessed from the main thread: set when a background task is posted
+  // and cleared when the mutator handles the step it requested.
+  bool background_task_pending_;
   bool made_progress_since_last_delayed_task_;
 };
 }  // namespace internal
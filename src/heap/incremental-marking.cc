@@ -7,6 +7,7 @@
 #include "src/code-stubs.h"
 #include "src/compilation-cache.h"
 #include "src/conversions.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/mark-compact-inl.h"
@@ -37,6 +38,7 @@ IncrementalMarking::IncrementalMarking(Heap* heap)
       should_hurry_(false),
       marking_speed_(0),
       bytes_scanned_(0),
+      bytes_marked_(0),
       allocated_(0),
       write_barriers_invoked_since_last_step_(0),
       idle_marking_delay_counter_(0),
@@ -143,6 +145,9 @@ void IncrementalMarking::RecordWriteIntoCodeSlow(Code* host, RelocInfo* rinfo,
 
 void IncrementalMarking::WhiteToGreyAndPush(HeapObject* obj, MarkBit mark_bit) {
   Marking::WhiteToGrey(mark_bit);
+  if (FLAG_concurrent_marking) {
+    heap_->concurrent_marking()->AddRoot(obj);
+  }
   heap_->mark_compact_collector()->marking_deque()->Push(obj);
 }
 
@@ -592,6 +597,10 @@ void IncrementalMarking::StartMarking() {
   IncrementalMarkingRootMarkingVisitor visitor(this);
   heap_->IterateStrongRoots(&visitor, VISIT_ONLY_STRONG);
 
+  if (FLAG_concurrent_marking) {
+    heap_->concurrent_marking()->StartTask();
+  }
+
   // Ready to start incremental marking.
   if (FLAG_trace_incremental_marking) {
     heap()->isolate()->PrintWithTimestamp("[IncrementalMarking] Running\n");
@@ -903,8 +912,10 @@ intptr_t IncrementalMarking::ProcessMarkingDeque(
   intptr_t bytes_processed = 0;
   MarkingDeque* marking_deque =
       heap_->mark_compact_collector()->marking_deque();
+  const int prefetch_distance = FLAG_marking_prefetch_distance;
   while (!marking_deque->IsEmpty() && (bytes_processed < bytes_to_process ||
                                        completion == FORCE_COMPLETION)) {
+    if (prefetch_distance > 0) marking_deque->PrefetchEntry(prefetch_distance);
     HeapObject* obj = marking_deque->Pop();
 
     // Left trimming may result in white filler objects on the marking deque.
@@ -1206,9 +1217,13 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
     // on
     // allocation), so to reduce the lumpiness we don't use the write barriers
     // invoked since last step directly to determine the amount of work to do.
-    intptr_t bytes_to_process =
-        marking_speed_ *
+    intptr_t allocated =
         Max(allocated_, write_barriers_invoked_since_last_step_);
+    int safety_factor = heap_->incremental_marking_safety_factor();
+    intptr_t bytes_to_process =
+        safety_factor > 0
+            ? StepSizeToKeepUpWithAllocations(allocated, safety_factor)
+            : marking_speed_ * allocated;
     allocated_ = 0;
     write_barriers_invoked_since_last_step_ = 0;
 
@@ -1251,10 +1266,12 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
     }
 
     steps_count_++;
+    bytes_marked_ += bytes_processed;
 
     // Speed up marking if we are marking too slow or if we are almost done
-    // with marking.
-    SpeedUp();
+    // with marking. The allocation-throughput-driven schedule resizes every
+    // step instead.
+    if (safety_factor == 0) SpeedUp();
 
     double end = heap_->MonotonicallyIncreasingTimeInMs();
     double duration = (end - start);
@@ -1276,10 +1293,47 @@ void IncrementalMarking::ResetStepCounters() {
   bytes_rescanned_ = 0;
   marking_speed_ = kInitialMarkingSpeed;
   bytes_scanned_ = 0;
+  bytes_marked_ = 0;
   write_barriers_invoked_since_last_step_ = 0;
 }
 
 
+intptr_t IncrementalMarking::StepSizeToKeepUpWithAllocations(
+    intptr_t allocated, int safety_factor) {
+  // If we mark remaining_work / space_left bytes for every byte the mutator
+  // allocates, marking finishes exactly when allocation reaches the old
+  // generation limit. The safety factor (in percent) adds slack for
+  // under-estimated liveness and for allocation that bypasses the step
+  // accounting, and is validated against the throughput the tracer has
+  // measured for marking so far: there is no point in scheduling less work
+  // per step than the allocation rate demands.
+  intptr_t space_left = static_cast<intptr_t>(
+      Max(SpaceLeftInOldSpace(), static_cast<int64_t>(MB)));
+  intptr_t remaining_work =
+      Max(heap_->PromotedSpaceSizeOfObjects() - bytes_marked_,
+          static_cast<intptr_t>(0));
+  double marking_ratio = static_cast<double>(remaining_work) /
+                         static_cast<double>(space_left) * safety_factor /
+                         100.0;
+  double allocation_speed =
+      heap_->tracer()->CurrentAllocationThroughputInBytesPerMillisecond();
+  double marking_speed =
+      heap_->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond();
+  if (allocation_speed > 0 && marking_speed > 0) {
+    // Marking must run at least remaining_work / space_left times faster
+    // than allocation to finish in time; never schedule below that ratio of
+    // the measured rates.
+    double required_ratio = allocation_speed / marking_speed *
+                            static_cast<double>(remaining_work) /
+                            static_cast<double>(space_left);
+    marking_ratio = Max(marking_ratio, required_ratio);
+  }
+  marking_ratio = Max(marking_ratio, static_cast<double>(kInitialMarkingSpeed));
+  marking_ratio = Min(marking_ratio, static_cast<double>(kMaxMarkingSpeed));
+  return static_cast<intptr_t>(allocated * marking_ratio);
+}
+
+
 int64_t IncrementalMarking::SpaceLeftInOldSpace() {
   return heap_->MaxOldGenerationSize() - heap_->PromotedSpaceSizeOfObjects();
 }
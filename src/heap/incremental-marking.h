@@ -257,6 +257,13 @@ class IncrementalMarking {
 
   void SpeedUp();
 
+  // Computes the step size for the allocation-throughput-driven schedule
+  // (see Heap::incremental_marking_safety_factor). Sizes the step so that
+  // the remaining marking work finishes before allocation uses up the space
+  // left to the old generation limit.
+  intptr_t StepSizeToKeepUpWithAllocations(intptr_t allocated,
+                                           int safety_factor);
+
   void ResetStepCounters();
 
   void StartMarking();
@@ -308,6 +315,7 @@ class IncrementalMarking {
   bool should_hurry_;
   int marking_speed_;
   intptr_t bytes_scanned_;
+  intptr_t bytes_marked_;
   intptr_t allocated_;
   intptr_t write_barriers_invoked_since_last_step_;
   size_t idle_marking_delay_counter_;
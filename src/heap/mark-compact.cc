@@ -15,6 +15,7 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-tracker.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/mark-compact-inl.h"
@@ -444,6 +445,11 @@ class MarkCompactCollector::Sweeper::SweeperTask : public v8::Task {
  private:
   // v8::Task overrides.
   void Run() override {
+    if (FLAG_numa_node >= 0) {
+      // Platform worker threads may start on a remote node; rebinding keeps
+      // the sweep traversal node-local to the heap it sweeps.
+      base::OS::BindCurrentThreadToNode(FLAG_numa_node);
+    }
     DCHECK_GE(space_to_start_, FIRST_SPACE);
     DCHECK_LE(space_to_start_, LAST_PAGED_SPACE);
     const int offset = space_to_start_ - FIRST_SPACE;
@@ -471,10 +477,18 @@ void MarkCompactCollector::Sweeper::StartSweeping() {
               [](Page* a, Page* b) { return a->LiveBytes() < b->LiveBytes(); });
   });
   if (FLAG_concurrent_sweeping) {
-    ForAllSweepingSpaces([this](AllocationSpace space) {
-      if (space == NEW_SPACE) return;
-      StartSweepingHelper(space);
-    });
+    // Scale the number of sweeping tasks with the available cores instead of
+    // starting exactly one task per space; each task round-robins through
+    // all spaces anyway, the anchor space only determines where it starts.
+    const int num_anchors = LAST_PAGED_SPACE - OLD_SPACE + 1;
+    const int num_tasks =
+        Max(1, Min(kMaxSweeperTasks,
+                   static_cast<int>(V8::GetCurrentPlatform()
+                                        ->NumberOfAvailableBackgroundThreads())));
+    for (int i = 0; i < num_tasks; i++) {
+      StartSweepingHelper(
+          static_cast<AllocationSpace>(OLD_SPACE + (i % num_anchors)));
+    }
   }
 }
 
@@ -598,11 +612,18 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     int area_size, int* target_fragmentation_percent,
     int* max_evacuated_bytes) {
   // For memory reducing and optimize for memory mode we directly define both
-  // constants.
+  // constants; they also serve as a fallback before enough compaction speed
+  // samples exist to weight the selection by measured payoff.
   const int kTargetFragmentationPercentForReduceMemory = 20;
   const int kMaxEvacuatedBytesForReduceMemory = 12 * Page::kPageSize;
   const int kTargetFragmentationPercentForOptimizeMemory = 20;
   const int kMaxEvacuatedBytesForOptimizeMemory = 6 * MB;
+  // Time to take for a single area (=payload of page) in the memory reducing
+  // modes, which accept longer pauses in exchange for better compaction.
+  const int kTargetMsPerAreaForMemoryModes = 2;
+  // Total evacuation time budget for the memory reducing modes, used to size
+  // the evacuation quota once the compaction speed has been measured.
+  const int kMaxEvacuationTimeMsForMemoryModes = 8;
 
   // For regular mode (which is latency critical) we define less aggressive
   // defaults to start and switch to a trace-based (using compaction speed)
@@ -613,28 +634,53 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   // exist enough compaction speed samples.
   const int kTargetMsPerArea = 1;
 
+  const double estimated_compaction_speed =
+      heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
+
+  // Derives the fragmentation level below which moving a page's live bytes
+  // does not buy back free memory fast enough, given the measured compaction
+  // speed and a per-area time goal.
+  auto payoff_fragmentation_percent = [=](int target_ms_per_area, int floor) {
+    const double estimated_ms_per_area =
+        1 + area_size / estimated_compaction_speed;
+    return Max(floor, static_cast<int>(100 - 100 * target_ms_per_area /
+                                                 estimated_ms_per_area));
+  };
+
   if (heap()->ShouldReduceMemory()) {
-    *target_fragmentation_percent = kTargetFragmentationPercentForReduceMemory;
-    *max_evacuated_bytes = kMaxEvacuatedBytesForReduceMemory;
+    if (estimated_compaction_speed != 0) {
+      *target_fragmentation_percent = payoff_fragmentation_percent(
+          kTargetMsPerAreaForMemoryModes,
+          kTargetFragmentationPercentForReduceMemory);
+      *max_evacuated_bytes =
+          Max(kMaxEvacuatedBytesForReduceMemory,
+              static_cast<int>(kMaxEvacuationTimeMsForMemoryModes *
+                               estimated_compaction_speed));
+    } else {
+      *target_fragmentation_percent =
+          kTargetFragmentationPercentForReduceMemory;
+      *max_evacuated_bytes = kMaxEvacuatedBytesForReduceMemory;
+    }
   } else if (heap()->ShouldOptimizeForMemoryUsage()) {
-    *target_fragmentation_percent =
-        kTargetFragmentationPercentForOptimizeMemory;
-    *max_evacuated_bytes = kMaxEvacuatedBytesForOptimizeMemory;
+    if (estimated_compaction_speed != 0) {
+      *target_fragmentation_percent = payoff_fragmentation_percent(
+          kTargetMsPerAreaForMemoryModes,
+          kTargetFragmentationPercentForOptimizeMemory);
+      *max_evacuated_bytes =
+          Max(kMaxEvacuatedBytesForOptimizeMemory,
+              static_cast<int>(kMaxEvacuationTimeMsForMemoryModes *
+                               estimated_compaction_speed));
+    } else {
+      *target_fragmentation_percent =
+          kTargetFragmentationPercentForOptimizeMemory;
+      *max_evacuated_bytes = kMaxEvacuatedBytesForOptimizeMemory;
+    }
   } else {
-    const double estimated_compaction_speed =
-        heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
     if (estimated_compaction_speed != 0) {
       // Estimate the target fragmentation based on traced compaction speed
       // and a goal for a single page.
-      const double estimated_ms_per_area =
-          1 + area_size / estimated_compaction_speed;
-      *target_fragmentation_percent = static_cast<int>(
-          100 - 100 * kTargetMsPerArea / estimated_ms_per_area);
-      if (*target_fragmentation_percent <
-          kTargetFragmentationPercentForReduceMemory) {
-        *target_fragmentation_percent =
-            kTargetFragmentationPercentForReduceMemory;
-      }
+      *target_fragmentation_percent = payoff_fragmentation_percent(
+          kTargetMsPerArea, kTargetFragmentationPercentForReduceMemory);
     } else {
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
@@ -931,21 +977,32 @@ void CodeFlusher::ProcessJSFunctionCandidates() {
     SharedFunctionInfo* shared = candidate->shared();
 
     Code* code = shared->code();
-    MarkBit code_mark = ObjectMarking::MarkBitFrom(code);
-    if (Marking::IsWhite(code_mark)) {
+    // For interpreted functions the liveness signal is the mark on the
+    // bytecode array; the code is the shared entry trampoline.
+    bool const bytecode_flushing = shared->HasBytecodeArray();
+    HeapObject* flush_target =
+        bytecode_flushing ? static_cast<HeapObject*>(shared->bytecode_array())
+                          : static_cast<HeapObject*>(code);
+    MarkBit flush_target_mark = ObjectMarking::MarkBitFrom(flush_target);
+    if (Marking::IsWhite(flush_target_mark)) {
       if (FLAG_trace_code_flushing && shared->is_compiled()) {
         PrintF("[code-flushing clears: ");
         shared->ShortPrint();
-        PrintF(" - age: %d]\n", code->GetAge());
+        PrintF(" - age: %d]\n", bytecode_flushing
+                                    ? shared->bytecode_array()->bytecode_age()
+                                    : code->GetAge());
       }
       // Always flush the optimized code map if there is one.
       if (!shared->OptimizedCodeMapIsCleared()) {
         shared->ClearOptimizedCodeMap();
       }
+      if (bytecode_flushing) {
+        shared->set_function_data(isolate_->heap()->undefined_value());
+      }
       shared->set_code(lazy_compile);
       candidate->set_code(lazy_compile);
     } else {
-      DCHECK(Marking::IsBlack(code_mark));
+      DCHECK(Marking::IsBlack(flush_target_mark));
       candidate->set_code(code);
     }
 
@@ -961,6 +1018,15 @@ void CodeFlusher::ProcessJSFunctionCandidates() {
     isolate_->heap()->mark_compact_collector()->RecordSlot(
         shared, shared_code_slot, *shared_code_slot);
 
+    if (bytecode_flushing) {
+      // The function data slot was skipped during marking, so a surviving
+      // bytecode array has to be recorded manually as well.
+      Object** function_data_slot =
+          HeapObject::RawField(shared, SharedFunctionInfo::kFunctionDataOffset);
+      isolate_->heap()->mark_compact_collector()->RecordSlot(
+          shared, function_data_slot, *function_data_slot);
+    }
+
     candidate = next_candidate;
   }
 
@@ -978,17 +1044,29 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
     ClearNextCandidate(candidate);
 
     Code* code = candidate->code();
-    MarkBit code_mark = ObjectMarking::MarkBitFrom(code);
-    if (Marking::IsWhite(code_mark)) {
+    // For interpreted functions the liveness signal is the mark on the
+    // bytecode array; the code is the shared entry trampoline.
+    bool const bytecode_flushing = candidate->HasBytecodeArray();
+    HeapObject* flush_target =
+        bytecode_flushing
+            ? static_cast<HeapObject*>(candidate->bytecode_array())
+            : static_cast<HeapObject*>(code);
+    MarkBit flush_target_mark = ObjectMarking::MarkBitFrom(flush_target);
+    if (Marking::IsWhite(flush_target_mark)) {
       if (FLAG_trace_code_flushing && candidate->is_compiled()) {
         PrintF("[code-flushing clears: ");
         candidate->ShortPrint();
-        PrintF(" - age: %d]\n", code->GetAge());
+        PrintF(" - age: %d]\n",
+               bytecode_flushing ? candidate->bytecode_array()->bytecode_age()
+                                 : code->GetAge());
       }
       // Always flush the optimized code map if there is one.
       if (!candidate->OptimizedCodeMapIsCleared()) {
         candidate->ClearOptimizedCodeMap();
       }
+      if (bytecode_flushing) {
+        candidate->set_function_data(isolate_->heap()->undefined_value());
+      }
       candidate->set_code(lazy_compile);
     }
 
@@ -997,6 +1075,15 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
     isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, code_slot,
                                                            *code_slot);
 
+    if (bytecode_flushing) {
+      // The function data slot was skipped during marking, so a surviving
+      // bytecode array has to be recorded manually as well.
+      Object** function_data_slot = HeapObject::RawField(
+          candidate, SharedFunctionInfo::kFunctionDataOffset);
+      isolate_->heap()->mark_compact_collector()->RecordSlot(
+          candidate, function_data_slot, *function_data_slot);
+    }
+
     candidate = next_candidate;
   }
 
@@ -2018,7 +2105,12 @@ void MarkCompactCollector::MarkImplicitRefGroups(
 // After: the marking stack is empty, and all objects reachable from the
 // marking stack have been marked, or are overflowed in the heap.
 void MarkCompactCollector::EmptyMarkingDeque() {
+  const int prefetch_distance = FLAG_marking_prefetch_distance;
   while (!marking_deque_.IsEmpty()) {
+    // Issue a prefetch a fixed distance below the top so that each object's
+    // map word has a few pops worth of time to arrive in cache; popping an
+    // object and immediately loading its map otherwise takes a full miss.
+    if (prefetch_distance > 0) marking_deque_.PrefetchEntry(prefetch_distance);
     HeapObject* object = marking_deque_.Pop();
 
     DCHECK(!object->IsFiller());
@@ -2256,14 +2348,47 @@ class MarkCompactCollector::ObjectStatsVisitor
 };
 
 void MarkCompactCollector::VisitAllObjects(HeapObjectVisitor* visitor) {
-  SpaceIterator space_it(heap());
-  HeapObject* obj = nullptr;
-  while (space_it.has_next()) {
-    ObjectIterator* it = space_it.next();
-    while ((obj = it->Next()) != nullptr) {
-      visitor->Visit(obj);
+  // Drive paged space iteration with the mark bitmap, which is still valid
+  // here because this runs between marking and evacuation: live objects are
+  // located by find-next-set-bit scanning, with black area sizes taken from
+  // the bitmap run, and only the dead gaps between them are walked
+  // map-by-map. A mostly-live page therefore skips the per-object size
+  // computation and a mostly-dead page skips straight across the garbage.
+  PagedSpaces spaces(heap());
+  for (PagedSpace* space = spaces.next(); space != NULL;
+       space = spaces.next()) {
+    for (Page* page : *space) {
+      Address current = page->area_start();
+      LiveObjectIterator<kBlackObjects> it(page);
+      HeapObject* live = nullptr;
+      while ((live = it.Next()) != nullptr) {
+        while (current < live->address()) {
+          HeapObject* dead = HeapObject::FromAddress(current);
+          visitor->Visit(dead);
+          current += dead->Size();
+        }
+        visitor->Visit(live);
+        current = live->address() + live->Size();
+      }
+      while (current < page->area_end()) {
+        HeapObject* dead = HeapObject::FromAddress(current);
+        visitor->Visit(dead);
+        current += dead->Size();
+      }
     }
   }
+
+  // New space is small and large object space has one object per chunk, so
+  // both keep their object-by-object walks.
+  SemiSpaceIterator new_space_it(heap()->new_space());
+  for (HeapObject* obj = new_space_it.Next(); obj != nullptr;
+       obj = new_space_it.Next()) {
+    visitor->Visit(obj);
+  }
+  LargeObjectIterator lo_it(heap()->lo_space());
+  for (HeapObject* obj = lo_it.Next(); obj != nullptr; obj = lo_it.Next()) {
+    visitor->Visit(obj);
+  }
 }
 
 void MarkCompactCollector::RecordObjectStats() {
@@ -2291,6 +2416,9 @@ void MarkCompactCollector::MarkLiveObjects() {
   // with the C stack limit check.
   PostponeInterruptsScope postpone(isolate());
 
+  // The final pause owns the marking deque and bitmap exclusively.
+  heap()->concurrent_marking()->EnsureTaskCompleted();
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK_FINISH_INCREMENTAL);
     IncrementalMarking* incremental_marking = heap_->incremental_marking();
@@ -2396,6 +2524,12 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     InternalizedStringTableCleaner internalized_visitor(heap(), string_table);
     string_table->IterateElements(&internalized_visitor);
     string_table->ElementsRemoved(internalized_visitor.PointersRemoved());
+    // The pause only turns dead entries into holes; repairing the probe
+    // chains and shrinking the table happen in a task after the GC.
+    if (FLAG_compact_string_table_after_gc &&
+        internalized_visitor.PointersRemoved() > 0) {
+      heap()->PostStringTableCompactionTask();
+    }
 
     ExternalStringTableCleaner external_visitor(heap(), nullptr);
     heap()->external_string_table_.Iterate(&external_visitor);
@@ -3328,6 +3462,27 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   for (int i = 0; i < wanted_num_tasks; i++) {
     evacuators[i] = new Evacuator(this);
   }
+
+  // Negotiate per-evacuator target-page quotas up front, so that evacuators
+  // do not abort candidate pages just because a concurrent refill of their
+  // compaction space failed midway. Failure to reserve the full quota is
+  // fine; the evacuator then refills on demand as before.
+  intptr_t old_space_live_bytes = 0;
+  intptr_t code_space_live_bytes = 0;
+  for (Page* page : evacuation_candidates_) {
+    if (page->owner()->identity() == CODE_SPACE) {
+      code_space_live_bytes += page->LiveBytes();
+    } else {
+      old_space_live_bytes += page->LiveBytes();
+    }
+  }
+  for (int i = 0; i < wanted_num_tasks; i++) {
+    evacuators[i]->compaction_spaces()->Get(OLD_SPACE)->ReserveTargetCapacity(
+        old_space_live_bytes / wanted_num_tasks);
+    evacuators[i]->compaction_spaces()->Get(CODE_SPACE)->ReserveTargetCapacity(
+        code_space_live_bytes / wanted_num_tasks);
+  }
+
   job.Run(wanted_num_tasks, [evacuators](int i) { return evacuators[i]; });
   for (int i = 0; i < wanted_num_tasks; i++) {
     evacuators[i]->Finalize();
@@ -3608,13 +3763,20 @@ void MarkCompactCollector::EvacuateNewSpaceAndCandidates() {
 template <PointerDirection direction>
 class PointerUpdateJobTraits {
  public:
-  typedef int PerPageData;  // Per page data is not used in this job.
+  // Range of slot-set buckets of the chunk covered by this work item. Large
+  // pages are split into multiple items so that their slots can be updated
+  // by multiple tasks.
+  typedef std::pair<size_t, size_t> PerPageData;
   typedef int PerTaskData;  // Per task data is not used in this job.
 
   static bool ProcessPageInParallel(Heap* heap, PerTaskData, MemoryChunk* chunk,
-                                    PerPageData) {
-    UpdateUntypedPointers(heap, chunk);
-    UpdateTypedPointers(heap, chunk);
+                                    PerPageData buckets) {
+    UpdateUntypedPointers(heap, chunk, buckets.first, buckets.second);
+    // Typed slots are not bucketed, so they are processed by the work item
+    // that covers the beginning of the chunk.
+    if (buckets.first == 0) {
+      UpdateTypedPointers(heap, chunk);
+    }
     return true;
   }
   static const bool NeedSequentialFinalization = false;
@@ -3622,15 +3784,18 @@ class PointerUpdateJobTraits {
   }
 
  private:
-  static void UpdateUntypedPointers(Heap* heap, MemoryChunk* chunk) {
+  static void UpdateUntypedPointers(Heap* heap, MemoryChunk* chunk,
+                                    size_t start_bucket, size_t end_bucket) {
     if (direction == OLD_TO_NEW) {
-      RememberedSet<OLD_TO_NEW>::Iterate(chunk, [heap, chunk](Address slot) {
-        return CheckAndUpdateOldToNewSlot(heap, slot);
-      });
+      RememberedSet<OLD_TO_NEW>::Iterate(
+          chunk, start_bucket, end_bucket, [heap, chunk](Address slot) {
+            return CheckAndUpdateOldToNewSlot(heap, slot);
+          });
     } else {
-      RememberedSet<OLD_TO_OLD>::Iterate(chunk, [](Address slot) {
-        return UpdateSlot(reinterpret_cast<Object**>(slot));
-      });
+      RememberedSet<OLD_TO_OLD>::Iterate(
+          chunk, start_bucket, end_bucket, [](Address slot) {
+            return UpdateSlot(reinterpret_cast<Object**>(slot));
+          });
     }
   }
 
@@ -3702,8 +3867,18 @@ template <PointerDirection direction>
 void UpdatePointersInParallel(Heap* heap, base::Semaphore* semaphore) {
   PageParallelJob<PointerUpdateJobTraits<direction> > job(
       heap, heap->isolate()->cancelable_task_manager(), semaphore);
-  RememberedSet<direction>::IterateMemoryChunks(
-      heap, [&job](MemoryChunk* chunk) { job.AddPage(chunk, 0); });
+  RememberedSet<direction>::IterateMemoryChunks(heap, [&job](
+                                                          MemoryChunk* chunk) {
+    // Split the buckets of large pages into separate work items, so that a
+    // single huge page does not serialize the whole pass.
+    const size_t kMaxBucketsPerItem = 4;
+    size_t buckets = RememberedSet<direction>::NumberOfBuckets(chunk);
+    for (size_t start = 0; start < buckets; start += kMaxBucketsPerItem) {
+      job.AddPage(chunk, std::make_pair(start,
+                                        Min(start + kMaxBucketsPerItem,
+                                            buckets)));
+    }
+  });
   int num_pages = job.NumberOfPages();
   int num_tasks = NumberOfPointerUpdateTasks(num_pages);
   job.Run(num_tasks, [](int i) { return 0; });
@@ -5,6 +5,7 @@
 #include "src/heap/memory-reducer.h"
 
 #include "src/flags.h"
+#include "src/heap/gc-decision-log.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/utils.h"
@@ -66,6 +67,31 @@ void MemoryReducer::NotifyTimer(const Event& event) {
   DCHECK_EQ(kTimer, event.type);
   DCHECK_EQ(kWait, state_.action);
   state_ = Step(state_, event);
+  // Record or replay whether this timer event starts a memory reducer GC.
+  // On replay the recorded outcome overrides the state machine so that the
+  // original GC schedule is reproduced.
+  if (heap()->gc_decision_log() != NULL) {
+    bool run = state_.action == kRun;
+    int64_t inputs[] = {
+        state_.started_gcs,
+        static_cast<int64_t>(event.should_start_incremental_gc),
+        static_cast<int64_t>(event.can_start_incremental_gc)};
+    bool logged = heap()->gc_decision_log()->RecordOrReplay(
+                      GCDecisionLog::kMemoryReducerStartGC, run, inputs,
+                      arraysize(inputs), event.time_ms) != 0;
+    if (logged && !run) {
+      // Only force the GC if it is actually possible in this run; otherwise
+      // the divergence has already been counted by the log.
+      if (heap()->incremental_marking()->IsStopped() &&
+          FLAG_incremental_marking) {
+        state_ = State(kRun, state_.started_gcs + 1, 0.0,
+                       state_.last_gc_time_ms);
+      }
+    } else if (!logged && run) {
+      state_ = State(kWait, state_.started_gcs, event.time_ms + kLongDelayMs,
+                     state_.last_gc_time_ms);
+    }
+  }
   if (state_.action == kRun) {
     DCHECK(heap()->incremental_marking()->IsStopped());
     DCHECK(FLAG_incremental_marking);
@@ -115,6 +141,13 @@ void MemoryReducer::NotifyMarkCompact(const Event& event) {
                    state_.started_gcs,
                    state_.action == kWait ? "will do more" : "done");
     }
+    // The mutator is mostly idle while the memory reducer is running, so this
+    // is a good time to move objects off deprecated maps; the maps and their
+    // descriptor arrays then die in the next memory reducer GC.
+    if (FLAG_migrate_deprecated_maps_on_memory_reducer &&
+        state_.action == kWait) {
+      heap()->PostDeprecatedMapMigrationTask();
+    }
   }
 }
 
@@ -499,6 +499,9 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
     } else {
       // Visit all unoptimized code objects to prevent flushing them.
       StaticVisitor::MarkObject(heap, function->shared()->code());
+      if (function->shared()->HasBytecodeArray()) {
+        StaticVisitor::MarkObject(heap, function->shared()->bytecode_array());
+      }
     }
   }
   VisitJSFunctionStrongCode(map, object);
@@ -514,10 +517,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSRegExp(Map* map,
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitBytecodeArray(
     Map* map, HeapObject* object) {
+  // Only the tagged metadata slots of the header are visited; marking never
+  // touches the bytecodes, so marking cost does not grow with code size.
   StaticVisitor::VisitPointers(
       map->GetHeap(), object,
       HeapObject::RawField(object, BytecodeArray::kConstantPoolOffset),
       HeapObject::RawField(object, BytecodeArray::kFrameSizeOffset));
+  // The age counts collections since the last execution; the interpreter
+  // entry trampoline resets it.
+  BytecodeArray::cast(object)->MakeOlder();
 }
 
 
@@ -568,21 +576,26 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(Heap* heap,
                                                       JSFunction* function) {
   SharedFunctionInfo* shared_info = function->shared();
 
-  // Code is either on stack, in compilation cache or referenced
-  // by optimized version of function.
-  MarkBit code_mark = ObjectMarking::MarkBitFrom(function->code());
-  if (Marking::IsBlackOrGrey(code_mark)) {
-    return false;
-  }
-
   // We do not (yet) flush code for optimized functions.
   if (function->code() != shared_info->code()) {
     return false;
   }
 
-  // Check age of optimized code.
-  if (FLAG_age_code && !function->code()->IsOld()) {
-    return false;
+  // For interpreted functions the code is the entry trampoline, a builtin
+  // that is always marked; liveness is tracked through the mark on the
+  // bytecode array instead, which is checked in IsFlushable below.
+  if (!shared_info->HasBytecodeArray()) {
+    // Code is either on stack, in compilation cache or referenced
+    // by optimized version of function.
+    MarkBit code_mark = ObjectMarking::MarkBitFrom(function->code());
+    if (Marking::IsBlackOrGrey(code_mark)) {
+      return false;
+    }
+
+    // Check age of optimized code.
+    if (FLAG_age_code && !function->code()->IsOld()) {
+      return false;
+    }
   }
 
   return IsFlushable(heap, shared_info);
@@ -592,11 +605,29 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(Heap* heap,
 template <typename StaticVisitor>
 bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     Heap* heap, SharedFunctionInfo* shared_info) {
-  // Code is either on stack, in compilation cache or referenced
-  // by optimized version of function.
-  MarkBit code_mark = ObjectMarking::MarkBitFrom(shared_info->code());
-  if (Marking::IsBlackOrGrey(code_mark)) {
-    return false;
+  if (shared_info->HasBytecodeArray()) {
+    // The code of interpreted functions is the entry trampoline, a builtin
+    // that is always marked, so liveness of the bytecode is tracked through
+    // the mark on the bytecode array instead; interpreted frames reference
+    // the bytecode array strongly.
+    if (!FLAG_flush_bytecode) return false;
+
+    // The bytecode must not have been executed for several collections.
+    if (!shared_info->bytecode_array()->IsOld()) return false;
+
+    // Optimized code deoptimizes into the bytecode, so the bytecode has to
+    // stay as long as there is optimized code.
+    if (!shared_info->OptimizedCodeMapIsCleared()) return false;
+
+    // The debugger references the bytecode from the debug info.
+    if (shared_info->HasDebugInfo()) return false;
+  } else {
+    // Code is either on stack, in compilation cache or referenced
+    // by optimized version of function.
+    MarkBit code_mark = ObjectMarking::MarkBitFrom(shared_info->code());
+    if (Marking::IsBlackOrGrey(code_mark)) {
+      return false;
+    }
   }
 
   // The function must be compiled and have the source code available,
@@ -610,8 +641,11 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
-  // Only flush code for functions.
-  if (shared_info->code()->kind() != Code::FUNCTION) {
+  // Only flush code for functions. The checks against the code object do
+  // not apply to bytecode flushing, where the code is the shared entry
+  // trampoline; the bytecode age has already been checked above.
+  if (!shared_info->HasBytecodeArray() &&
+      shared_info->code()->kind() != Code::FUNCTION) {
     return false;
   }
 
@@ -637,8 +671,9 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
-  // Maintain debug break slots in the code.
-  if (shared_info->HasDebugCode()) {
+  // Maintain debug break slots in the code. HasDebugCode is trivially true
+  // for all bytecode, which is covered by the debug info check above.
+  if (!shared_info->HasBytecodeArray() && shared_info->HasDebugCode()) {
     return false;
   }
 
@@ -649,7 +684,8 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
   }
 
   // Check age of code. If code aging is disabled we never flush.
-  if (!FLAG_age_code || !shared_info->code()->IsOld()) {
+  if (!shared_info->HasBytecodeArray() &&
+      (!FLAG_age_code || !shared_info->code()->IsOld())) {
     return false;
   }
 
@@ -683,6 +719,14 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakCode(
 
   Object** start_slot =
       HeapObject::RawField(object, SharedFunctionInfo::kOptimizedCodeMapOffset);
+  if (SharedFunctionInfo::cast(object)->HasBytecodeArray()) {
+    // The bytecode array in the function data slot is treated weakly as
+    // well; interpreted frames reference the bytecode array strongly.
+    Object** function_data_slot =
+        HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset);
+    StaticVisitor::VisitPointers(heap, object, start_slot, function_data_slot);
+    start_slot = function_data_slot + 1;
+  }
   Object** end_slot = HeapObject::RawField(
       object, SharedFunctionInfo::BodyDescriptor::kEndOffset);
   StaticVisitor::VisitPointers(heap, object, start_slot, end_slot);
@@ -111,19 +111,39 @@ class RememberedSet {
   // SlotCallbackResult.
   template <typename Callback>
   static void Iterate(MemoryChunk* chunk, Callback callback) {
+    Iterate(chunk, 0, NumberOfBuckets(chunk), callback);
+  }
+
+  // Iterates and filters a contiguous range of slot-set buckets in the given
+  // memory chunk. Each bucket covers Page::kPageSize bytes of the chunk, so
+  // this allows the slots of a large page to be split across parallel tasks.
+  template <typename Callback>
+  static void Iterate(MemoryChunk* chunk, size_t start_bucket,
+                      size_t end_bucket, Callback callback) {
     SlotSet* slots = GetSlotSet(chunk);
     if (slots != nullptr) {
-      size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+      size_t buckets = NumberOfBuckets(chunk);
+      DCHECK_LE(end_bucket, buckets);
       int new_count = 0;
-      for (size_t page = 0; page < pages; page++) {
-        new_count += slots[page].Iterate(callback);
+      for (size_t bucket = start_bucket; bucket < end_bucket; bucket++) {
+        new_count += slots[bucket].Iterate(callback);
       }
-      if (new_count == 0) {
+      // The slot set may only be released when all of its buckets were
+      // iterated, since other tasks may still be processing the rest of
+      // the chunk.
+      if (new_count == 0 && start_bucket == 0 && end_bucket == buckets) {
         ReleaseSlotSet(chunk);
       }
     }
   }
 
+  // Returns the number of slot-set buckets of the given memory chunk. Large
+  // pages have one bucket per Page::kPageSize bytes, all other pages have
+  // exactly one bucket.
+  static size_t NumberOfBuckets(MemoryChunk* chunk) {
+    return (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+  }
+
   // Given a page and a typed slot in that page, this function adds the slot
   // to the remembered set.
   static void InsertTyped(Page* page, Address host_addr, SlotType slot_type,
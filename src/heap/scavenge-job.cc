@@ -5,6 +5,7 @@
 #include "src/heap/scavenge-job.h"
 
 #include "src/base/platform/time.h"
+#include "src/heap/gc-decision-log.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/isolate.h"
@@ -30,8 +31,19 @@ void ScavengeJob::IdleTask::RunInternal(double deadline_in_seconds) {
 
   job_->NotifyIdleTask();
 
-  if (ReachedIdleAllocationLimit(scavenge_speed_in_bytes_per_ms, new_space_size,
-                                 new_space_capacity)) {
+  bool reached_limit = ReachedIdleAllocationLimit(
+      scavenge_speed_in_bytes_per_ms, new_space_size, new_space_capacity);
+  if (heap->gc_decision_log() != NULL) {
+    int64_t inputs[] = {
+        static_cast<int64_t>(scavenge_speed_in_bytes_per_ms),
+        static_cast<int64_t>(new_space_size),
+        static_cast<int64_t>(new_space_capacity)};
+    reached_limit = heap->gc_decision_log()->RecordOrReplay(
+                        GCDecisionLog::kScavengeJobIdleLimitReached,
+                        reached_limit, inputs, arraysize(inputs),
+                        start_ms) != 0;
+  }
+  if (reached_limit) {
     if (EnoughIdleTimeForScavenge(
             idle_time_in_ms, scavenge_speed_in_bytes_per_ms, new_space_size)) {
       heap->CollectGarbage(NEW_SPACE, "idle task: scavenge");
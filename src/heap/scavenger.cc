@@ -4,9 +4,13 @@
 
 #include "src/heap/scavenger.h"
 
+#include <vector>
+
 #include "src/contexts.h"
 #include "src/heap/heap.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/page-parallel-job.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/scavenger-inl.h"
 #include "src/isolate.h"
 #include "src/log.h"
@@ -178,8 +182,13 @@ class ScavengingVisitor : public StaticVisitorBase {
                                    HeapObject* object, int object_size) {
     Heap* heap = map->GetHeap();
 
-    AllocationResult allocation =
-        heap->old_space()->AllocateRaw(object_size, alignment);
+    AllocationResult allocation;
+    if (object_size <= Scavenger::kMaxPromotionLabObjectSize) {
+      allocation =
+          heap->scavenge_collector()->AllocatePromoted(object_size, alignment);
+    } else {
+      allocation = heap->old_space()->AllocateRaw(object_size, alignment);
+    }
 
     HeapObject* target = NULL;  // Initialization to please compiler.
     if (allocation.To(&target)) {
@@ -387,6 +396,42 @@ void Scavenger::ScavengeObjectSlow(HeapObject** p, HeapObject* object) {
 }
 
 
+bool Scavenger::NewPromotionLab() {
+  AllocationResult result =
+      heap_->old_space()->AllocateRaw(kPromotionLabSize, kWordAligned);
+  LocalAllocationBuffer saved_old_buffer = promotion_lab_;
+  promotion_lab_ =
+      LocalAllocationBuffer::FromResult(heap_, result, kPromotionLabSize);
+  if (promotion_lab_.IsValid()) {
+    promotion_lab_.TryMerge(&saved_old_buffer);
+    return true;
+  }
+  return false;
+}
+
+
+AllocationResult Scavenger::AllocatePromoted(int object_size,
+                                             AllocationAlignment alignment) {
+  DCHECK_LE(object_size, kMaxPromotionLabObjectSize);
+  AllocationResult allocation =
+      promotion_lab_.AllocateRawAligned(object_size, alignment);
+  if (allocation.IsRetry()) {
+    if (!NewPromotionLab()) {
+      // Old space is close to its limit; take whatever the free list still
+      // hands out so that promotion only fails when the space is full.
+      return heap_->old_space()->AllocateRaw(object_size, alignment);
+    }
+    allocation = promotion_lab_.AllocateRawAligned(object_size, alignment);
+  }
+  return allocation;
+}
+
+
+void Scavenger::ClosePromotionLab() {
+  promotion_lab_ = LocalAllocationBuffer::InvalidBuffer();
+}
+
+
 void Scavenger::SelectScavengingVisitorsTable() {
   bool logging_and_profiling =
       FLAG_verify_predictable || isolate()->logger()->is_logging() ||
@@ -449,5 +494,62 @@ void ScavengeVisitor::ScavengePointer(Object** p) {
                             reinterpret_cast<HeapObject*>(object));
 }
 
+class ScavengeSlotScanJobTraits {
+ public:
+  typedef int PerPageData;  // Per page data is not used in this job.
+  // Buffer of slots that point into from space, filled in by each task.
+  typedef std::vector<Address>* PerTaskData;
+
+  static bool ProcessPageInParallel(Heap* heap, PerTaskData slots,
+                                    MemoryChunk* chunk, PerPageData) {
+    RememberedSet<OLD_TO_NEW>::Iterate(chunk, [heap, slots](Address addr) {
+      Object** slot = reinterpret_cast<Object**>(addr);
+      if (heap->InFromSpace(*slot)) {
+        // Copying the object is not thread-safe in this collector, so the
+        // slot is only recorded here and scavenged sequentially after the
+        // scan has finished.
+        slots->push_back(addr);
+        return KEEP_SLOT;
+      }
+      // The slot does not point into new space, so it is stale and can be
+      // dropped during the scan.
+      return REMOVE_SLOT;
+    });
+    return true;
+  }
+  static const bool NeedSequentialFinalization = false;
+  static void FinalizePageSequentially(Heap*, MemoryChunk*, bool, PerPageData) {
+  }
+};
+
+int NumberOfScavengeScanTasks(int pages) {
+  const int kMaxTasks = 4;
+  const int kPagesPerTask = 4;
+  return Min(kMaxTasks, (pages + kPagesPerTask - 1) / kPagesPerTask);
+}
+
+void Scavenger::ScavengeRememberedSetInParallel(Heap* heap,
+                                                base::Semaphore* semaphore) {
+  PageParallelJob<ScavengeSlotScanJobTraits> job(
+      heap, heap->isolate()->cancelable_task_manager(), semaphore);
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      heap, [&job](MemoryChunk* chunk) { job.AddPage(chunk, 0); });
+  int num_tasks = NumberOfScavengeScanTasks(job.NumberOfPages());
+  std::vector<std::vector<Address> > slot_buffers(num_tasks);
+  job.Run(num_tasks, [&slot_buffers](int i) { return &slot_buffers[i]; });
+  // Object copying is single-threaded, so the collected slots are drained on
+  // the main thread. Slots whose target got promoted or died are removed
+  // here because the parallel scan had to keep them.
+  for (std::vector<Address>& buffer : slot_buffers) {
+    for (Address slot_address : buffer) {
+      if (CheckAndScavengeObject(heap, slot_address) == REMOVE_SLOT) {
+        RememberedSet<OLD_TO_NEW>::Remove(
+            MemoryChunk::FromAnyPointerAddress(heap, slot_address),
+            slot_address);
+      }
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
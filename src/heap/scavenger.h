@@ -7,8 +7,13 @@
 
 #include "src/heap/objects-visiting.h"
 #include "src/heap/slot-set.h"
+#include "src/heap/spaces.h"
 
 namespace v8 {
+namespace base {
+class Semaphore;
+}  // namespace base
+
 namespace internal {
 
 typedef void (*ScavengingCallback)(Map* map, HeapObject** slot,
@@ -16,7 +21,14 @@ typedef void (*ScavengingCallback)(Map* map, HeapObject** slot,
 
 class Scavenger {
  public:
-  explicit Scavenger(Heap* heap) : heap_(heap) {}
+  // Size of the bump-pointer buffers promoted objects are packed into, and
+  // the maximum object size that goes through them. Larger objects are
+  // promoted through the old-space free list directly.
+  static const int kPromotionLabSize = 32 * KB;
+  static const int kMaxPromotionLabObjectSize = 4 * KB;
+
+  explicit Scavenger(Heap* heap)
+      : heap_(heap), promotion_lab_(LocalAllocationBuffer::InvalidBuffer()) {}
 
   // Initializes static visitor dispatch tables.
   static void Initialize();
@@ -32,16 +44,36 @@ class Scavenger {
   // Slow part of {ScavengeObject} above.
   static void ScavengeObjectSlow(HeapObject** p, HeapObject* object);
 
+  // Scans the old-to-new remembered set with parallel tasks and scavenges
+  // the discovered slots sequentially afterwards. Only used when
+  // FLAG_parallel_scavenge is enabled.
+  static void ScavengeRememberedSetInParallel(Heap* heap,
+                                              base::Semaphore* semaphore);
+
   // Chooses an appropriate static visitor table depending on the current state
   // of the heap (i.e. incremental marking, logging and profiling).
   void SelectScavengingVisitorsTable();
 
+  // Allocates old-space memory for a promoted object from the promotion
+  // buffer, so that objects which are scavenged together stay together on
+  // the target page. Falls back to a free-list allocation when the buffer
+  // cannot be refilled.
+  AllocationResult AllocatePromoted(int object_size,
+                                    AllocationAlignment alignment);
+
+  // Returns the tail of the current promotion buffer as a filler object at
+  // the end of a scavenge; the next sweep reclaims it.
+  void ClosePromotionLab();
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
  private:
+  bool NewPromotionLab();
+
   Heap* heap_;
   VisitorDispatchTable<ScavengingCallback> scavenging_visitors_table_;
+  LocalAllocationBuffer promotion_lab_;
 };
 
 
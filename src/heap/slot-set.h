@@ -6,6 +6,7 @@
 #define V8_SLOT_SET_H
 
 #include "src/allocation.h"
+#include "src/base/atomicops.h"
 #include "src/base/bits.h"
 #include "src/utils.h"
 
@@ -19,12 +20,19 @@ enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
 // operation.
 // The data structure assumes that the slots are pointer size aligned and
 // splits the valid slot offset range into kBuckets buckets.
-// Each bucket is a bitmap with a bit corresponding to a single slot offset.
+// Each bucket is encoded hierarchically: while a bucket holds only a few
+// slots they are packed directly into the bucket word (no heap allocation at
+// all); once the inline capacity is exceeded the bucket is upgraded to a
+// bitmap with a bit per slot offset. Pointer-sparse pages therefore pay a
+// single word per bucket instead of a bitmap.
 class SlotSet : public Malloced {
  public:
   SlotSet() {
+    STATIC_ASSERT(kMaxInlineSlots < (1 << kInlineCountBits));
+    STATIC_ASSERT(kInlineFieldShift + kMaxInlineSlots * kInlineFieldBits <=
+                  kPointerSize * kBitsPerByte);
     for (int i = 0; i < kBuckets; i++) {
-      bucket[i] = nullptr;
+      bucket[i] = 0;
     }
   }
 
@@ -37,26 +45,86 @@ class SlotSet : public Malloced {
   void SetPageStart(Address page_start) { page_start_ = page_start; }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
+  // Insert is safe to call concurrently from several threads; all other
+  // methods assume exclusive access.
   void Insert(int slot_offset) {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    if (bucket[bucket_index] == nullptr) {
-      bucket[bucket_index] = AllocateBucket();
+    int slot = cell_index * kBitsPerCell + bit_index;
+    base::AtomicWord* bucket_slot = &bucket[bucket_index];
+    while (true) {
+      base::AtomicWord word = base::Acquire_Load(bucket_slot);
+      if (word == 0) {
+        // Empty bucket: publish a one-entry inline bucket.
+        base::AtomicWord new_word = EncodeInlineBucket(&slot, 1);
+        if (base::Release_CompareAndSwap(bucket_slot, 0, new_word) == 0) {
+          return;
+        }
+        continue;
+      }
+      if (IsInlineBucket(word)) {
+        if (InlineBucketContains(word, slot)) return;
+        int count = InlineBucketCount(word);
+        if (count < kMaxInlineSlots) {
+          base::AtomicWord new_word = InlineBucketAdd(word, slot);
+          if (base::Release_CompareAndSwap(bucket_slot, word, new_word) ==
+              word) {
+            return;
+          }
+          continue;
+        }
+        // The inline bucket is full: upgrade it to a bitmap holding the
+        // inline slots plus the new one. If another thread raced us, its
+        // bucket is used and ours discarded.
+        uint32_t* new_bucket = AllocateBucket();
+        for (int i = 0; i < count; i++) {
+          int inline_slot = InlineBucketSlot(word, i);
+          new_bucket[inline_slot >> kBitsPerCellLog2] |=
+              1u << (inline_slot & (kBitsPerCell - 1));
+        }
+        new_bucket[cell_index] |= 1u << bit_index;
+        if (base::Release_CompareAndSwap(
+                bucket_slot, word,
+                reinterpret_cast<base::AtomicWord>(new_bucket)) == word) {
+          return;
+        }
+        DeleteArray<uint32_t>(new_bucket);
+        continue;
+      }
+      // Bitmap bucket. Concurrent inserts only ever add bits, so setting the
+      // bit with a compare-and-swap loop cannot lose updates.
+      uint32_t* current_bucket = BitmapFromWord(word);
+      base::Atomic32* cell =
+          reinterpret_cast<base::Atomic32*>(&current_bucket[cell_index]);
+      base::Atomic32 bit_mask = 1 << bit_index;
+      base::Atomic32 old_cell = base::NoBarrier_Load(cell);
+      while ((old_cell & bit_mask) == 0) {
+        base::Atomic32 prev = base::NoBarrier_CompareAndSwap(
+            cell, old_cell, old_cell | bit_mask);
+        if (prev == old_cell) break;
+        old_cell = prev;
+      }
+      return;
     }
-    bucket[bucket_index][cell_index] |= 1u << bit_index;
   }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   void Remove(int slot_offset) {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    if (bucket[bucket_index] != nullptr) {
-      uint32_t cell = bucket[bucket_index][cell_index];
-      if (cell) {
-        uint32_t bit_mask = 1u << bit_index;
-        if (cell & bit_mask) {
-          bucket[bucket_index][cell_index] ^= bit_mask;
-        }
+    base::AtomicWord word = bucket[bucket_index];
+    if (word == 0) return;
+    if (IsInlineBucket(word)) {
+      int slot = cell_index * kBitsPerCell + bit_index;
+      bucket[bucket_index] = InlineBucketRemoveRange(word, slot, slot + 1);
+      return;
+    }
+    uint32_t* cells = BitmapFromWord(word);
+    uint32_t cell = cells[cell_index];
+    if (cell) {
+      uint32_t bit_mask = 1u << bit_index;
+      if (cell & bit_mask) {
+        cells[cell_index] ^= bit_mask;
       }
     }
   }
@@ -70,57 +138,37 @@ class SlotSet : public Malloced {
     SlotToIndices(start_offset, &start_bucket, &start_cell, &start_bit);
     int end_bucket, end_cell, end_bit;
     SlotToIndices(end_offset, &end_bucket, &end_cell, &end_bit);
-    uint32_t start_mask = (1u << start_bit) - 1;
-    uint32_t end_mask = ~((1u << end_bit) - 1);
-    if (start_bucket == end_bucket && start_cell == end_cell) {
-      MaskCell(start_bucket, start_cell, start_mask | end_mask);
-      return;
-    }
-    int current_bucket = start_bucket;
-    int current_cell = start_cell;
-    MaskCell(current_bucket, current_cell, start_mask);
-    current_cell++;
-    if (current_bucket < end_bucket) {
-      if (bucket[current_bucket] != nullptr) {
-        while (current_cell < kCellsPerBucket) {
-          bucket[current_bucket][current_cell] = 0;
-          current_cell++;
-        }
+    int start_slot = start_cell * kBitsPerCell + start_bit;
+    int end_slot = end_cell * kBitsPerCell + end_bit;
+    for (int bucket_index = start_bucket;
+         bucket_index <= end_bucket && bucket_index < kBuckets;
+         bucket_index++) {
+      int from = bucket_index == start_bucket ? start_slot : 0;
+      int to = bucket_index == end_bucket ? end_slot : kBitsPerBucket;
+      if (from == to) continue;
+      base::AtomicWord word = bucket[bucket_index];
+      if (word == 0) continue;
+      if (from == 0 && to == kBitsPerBucket) {
+        ReleaseBucket(bucket_index);
+      } else if (IsInlineBucket(word)) {
+        bucket[bucket_index] = InlineBucketRemoveRange(word, from, to);
+      } else {
+        RemoveRangeFromBitmap(BitmapFromWord(word), from, to);
       }
-      // The rest of the current bucket is cleared.
-      // Move on to the next bucket.
-      current_bucket++;
-      current_cell = 0;
     }
-    DCHECK(current_bucket == end_bucket ||
-           (current_bucket < end_bucket && current_cell == 0));
-    while (current_bucket < end_bucket) {
-      ReleaseBucket(current_bucket);
-      current_bucket++;
-    }
-    // All buckets between start_bucket and end_bucket are cleared.
-    DCHECK(current_bucket == end_bucket && current_cell <= end_cell);
-    if (current_bucket == kBuckets || bucket[current_bucket] == nullptr) {
-      return;
-    }
-    while (current_cell < end_cell) {
-      bucket[current_bucket][current_cell] = 0;
-      current_cell++;
-    }
-    // All cells between start_cell and end_cell are cleared.
-    DCHECK(current_bucket == end_bucket && current_cell == end_cell);
-    MaskCell(end_bucket, end_cell, end_mask);
   }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   bool Lookup(int slot_offset) {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    if (bucket[bucket_index] != nullptr) {
-      uint32_t cell = bucket[bucket_index][cell_index];
-      return (cell & (1u << bit_index)) != 0;
+    base::AtomicWord word = bucket[bucket_index];
+    if (word == 0) return false;
+    if (IsInlineBucket(word)) {
+      return InlineBucketContains(word, cell_index * kBitsPerCell + bit_index);
     }
-    return false;
+    uint32_t cell = BitmapFromWord(word)[cell_index];
+    return (cell & (1u << bit_index)) != 0;
   }
 
   // Iterate over all slots in the set and for each slot invoke the callback.
@@ -136,36 +184,54 @@ class SlotSet : public Malloced {
   int Iterate(Callback callback) {
     int new_count = 0;
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
-      if (bucket[bucket_index] != nullptr) {
-        int in_bucket_count = 0;
-        uint32_t* current_bucket = bucket[bucket_index];
-        int cell_offset = bucket_index * kBitsPerBucket;
-        for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
-          if (current_bucket[i]) {
-            uint32_t cell = current_bucket[i];
-            uint32_t old_cell = cell;
-            uint32_t new_cell = cell;
-            while (cell) {
-              int bit_offset = base::bits::CountTrailingZeros32(cell);
-              uint32_t bit_mask = 1u << bit_offset;
-              uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
-              if (callback(page_start_ + slot) == KEEP_SLOT) {
-                ++in_bucket_count;
-              } else {
-                new_cell ^= bit_mask;
-              }
-              cell ^= bit_mask;
-            }
-            if (old_cell != new_cell) {
-              current_bucket[i] = new_cell;
-            }
+      base::AtomicWord word = bucket[bucket_index];
+      if (word == 0) continue;
+      int bucket_offset = bucket_index * kBitsPerBucket;
+      if (IsInlineBucket(word)) {
+        int count = InlineBucketCount(word);
+        int kept_slots[kMaxInlineSlots];
+        int kept = 0;
+        for (int i = 0; i < count; i++) {
+          int slot = InlineBucketSlot(word, i);
+          uint32_t offset = (bucket_offset + slot) << kPointerSizeLog2;
+          if (callback(page_start_ + offset) == KEEP_SLOT) {
+            kept_slots[kept++] = slot;
           }
         }
-        if (in_bucket_count == 0) {
-          ReleaseBucket(bucket_index);
+        if (kept != count) {
+          bucket[bucket_index] = EncodeInlineBucket(kept_slots, kept);
         }
-        new_count += in_bucket_count;
+        new_count += kept;
+        continue;
       }
+      int in_bucket_count = 0;
+      uint32_t* current_bucket = BitmapFromWord(word);
+      int cell_offset = bucket_offset;
+      for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
+        if (current_bucket[i]) {
+          uint32_t cell = current_bucket[i];
+          uint32_t old_cell = cell;
+          uint32_t new_cell = cell;
+          while (cell) {
+            int bit_offset = base::bits::CountTrailingZeros32(cell);
+            uint32_t bit_mask = 1u << bit_offset;
+            uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
+            if (callback(page_start_ + slot) == KEEP_SLOT) {
+              ++in_bucket_count;
+            } else {
+              new_cell ^= bit_mask;
+            }
+            cell ^= bit_mask;
+          }
+          if (old_cell != new_cell) {
+            current_bucket[i] = new_cell;
+          }
+        }
+      }
+      if (in_bucket_count == 0) {
+        ReleaseBucket(bucket_index);
+      }
+      new_count += in_bucket_count;
     }
     return new_count;
   }
@@ -180,6 +246,106 @@ class SlotSet : public Malloced {
   static const int kBitsPerBucketLog2 = kCellsPerBucketLog2 + kBitsPerCellLog2;
   static const int kBuckets = kMaxSlots / kCellsPerBucket / kBitsPerCell;
 
+  // Inline bucket encoding. A bucket word is either 0 (empty), a pointer to
+  // a cell bitmap (tag bit clear; bitmaps are at least pointer aligned), or
+  // an inline set of up to kMaxInlineSlots in-bucket slot indices:
+  //
+  //   bit 0:                 kInlineTag
+  //   bits 1..3:             number of slots
+  //   bits 4+i*10..13+i*10:  i-th in-bucket slot index
+  static const base::AtomicWord kInlineTag = 1;
+  static const int kInlineCountShift = 1;
+  static const int kInlineCountBits = 3;
+  static const int kInlineFieldShift =
+      kInlineCountShift + kInlineCountBits;
+  static const int kInlineFieldBits = kBitsPerBucketLog2;
+  static const int kMaxInlineSlots =
+      (kPointerSize * kBitsPerByte - kInlineFieldShift) / kInlineFieldBits;
+
+  static bool IsInlineBucket(base::AtomicWord word) {
+    return (word & kInlineTag) != 0;
+  }
+
+  static uint32_t* BitmapFromWord(base::AtomicWord word) {
+    DCHECK(!IsInlineBucket(word));
+    return reinterpret_cast<uint32_t*>(word);
+  }
+
+  static int InlineBucketCount(base::AtomicWord word) {
+    return static_cast<int>((word >> kInlineCountShift) &
+                            ((1 << kInlineCountBits) - 1));
+  }
+
+  static int InlineBucketSlot(base::AtomicWord word, int i) {
+    return static_cast<int>(
+        (word >> (kInlineFieldShift + i * kInlineFieldBits)) &
+        ((1 << kInlineFieldBits) - 1));
+  }
+
+  static base::AtomicWord EncodeInlineBucket(const int* slots, int count) {
+    DCHECK_LE(count, kMaxInlineSlots);
+    if (count == 0) return 0;
+    base::AtomicWord word =
+        kInlineTag |
+        (static_cast<base::AtomicWord>(count) << kInlineCountShift);
+    for (int i = 0; i < count; i++) {
+      word |= static_cast<base::AtomicWord>(slots[i])
+              << (kInlineFieldShift + i * kInlineFieldBits);
+    }
+    return word;
+  }
+
+  static bool InlineBucketContains(base::AtomicWord word, int slot) {
+    int count = InlineBucketCount(word);
+    for (int i = 0; i < count; i++) {
+      if (InlineBucketSlot(word, i) == slot) return true;
+    }
+    return false;
+  }
+
+  static base::AtomicWord InlineBucketAdd(base::AtomicWord word, int slot) {
+    int count = InlineBucketCount(word);
+    DCHECK_LT(count, kMaxInlineSlots);
+    base::AtomicWord new_word =
+        word + (static_cast<base::AtomicWord>(1) << kInlineCountShift);
+    new_word |= static_cast<base::AtomicWord>(slot)
+                << (kInlineFieldShift + count * kInlineFieldBits);
+    return new_word;
+  }
+
+  // Drops all slots in [from, to) from an inline bucket word.
+  static base::AtomicWord InlineBucketRemoveRange(base::AtomicWord word,
+                                                  int from, int to) {
+    int kept_slots[kMaxInlineSlots];
+    int kept = 0;
+    int count = InlineBucketCount(word);
+    for (int i = 0; i < count; i++) {
+      int slot = InlineBucketSlot(word, i);
+      if (slot < from || slot >= to) kept_slots[kept++] = slot;
+    }
+    return EncodeInlineBucket(kept_slots, kept);
+  }
+
+  // Clears all bits in [from, to) of a cell bitmap; the range must not span
+  // the whole bucket.
+  void RemoveRangeFromBitmap(uint32_t* cells, int from, int to) {
+    int from_cell = from >> kBitsPerCellLog2;
+    int to_cell = to >> kBitsPerCellLog2;
+    uint32_t from_mask = (1u << (from & (kBitsPerCell - 1))) - 1;
+    uint32_t to_mask = ~((1u << (to & (kBitsPerCell - 1))) - 1);
+    if (from_cell == to_cell) {
+      cells[from_cell] &= from_mask | to_mask;
+      return;
+    }
+    cells[from_cell] &= from_mask;
+    for (int i = from_cell + 1; i < to_cell; i++) {
+      cells[i] = 0;
+    }
+    if (to_cell < kCellsPerBucket) {
+      cells[to_cell] &= to_mask;
+    }
+  }
+
   uint32_t* AllocateBucket() {
     uint32_t* result = NewArray<uint32_t>(kCellsPerBucket);
     for (int i = 0; i < kCellsPerBucket; i++) {
@@ -189,21 +355,11 @@ class SlotSet : public Malloced {
   }
 
   void ReleaseBucket(int bucket_index) {
-    DeleteArray<uint32_t>(bucket[bucket_index]);
-    bucket[bucket_index] = nullptr;
-  }
-
-  void MaskCell(int bucket_index, int cell_index, uint32_t mask) {
-    if (bucket_index < kBuckets) {
-      uint32_t* cells = bucket[bucket_index];
-      if (cells != nullptr && cells[cell_index] != 0) {
-        cells[cell_index] &= mask;
-      }
-    } else {
-      // GCC bug 59124: Emits wrong warnings
-      // "array subscript is above array bounds"
-      UNREACHABLE();
+    base::AtomicWord word = bucket[bucket_index];
+    if (word != 0 && !IsInlineBucket(word)) {
+      DeleteArray<uint32_t>(BitmapFromWord(word));
     }
+    bucket[bucket_index] = 0;
   }
 
   // Converts the slot offset into bucket/cell/bit index.
@@ -217,7 +373,7 @@ class SlotSet : public Malloced {
     *bit_index = slot & (kBitsPerCell - 1);
   }
 
-  uint32_t* bucket[kBuckets];
+  base::AtomicWord bucket[kBuckets];
   Address page_start_;
 };
 
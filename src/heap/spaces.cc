@@ -125,6 +125,17 @@ bool CodeRange::SetUp(size_t requested) {
 
   // We are sure that we have mapped a block of requested addresses.
   DCHECK(code_range_->size() == requested);
+  if (FLAG_numa_node >= 0) {
+    base::OS::BindMemoryToNode(code_range_->address(), code_range_->size(),
+                               FLAG_numa_node);
+  }
+  if (FLAG_huge_pages) {
+    if (base::OS::AdviseHugePages(code_range_->address(),
+                                  code_range_->size())) {
+      isolate_->counters()->huge_pages_advised_kb()->Increment(
+          static_cast<int>(code_range_->size() / KB));
+    }
+  }
   Address base = reinterpret_cast<Address>(code_range_->address());
 
   // On some platforms, specifically Win64, we need to reserve some pages at
@@ -318,6 +329,10 @@ void MemoryAllocator::TearDown() {
     FreeMemory(reinterpret_cast<Address>(chunk), MemoryChunk::kPageSize,
                NOT_EXECUTABLE);
   }
+  while ((chunk = unmapper()->GetMemoryChunkSafe<Unmapper::kPooledLarge>()) !=
+         nullptr) {
+    FreeMemory(chunk->reserved_memory(), NOT_EXECUTABLE);
+  }
 
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK_EQ(size_.Value(), 0);
@@ -380,10 +395,42 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   }
   // Non-regular chunks.
   while ((chunk = GetMemoryChunkSafe<kNonRegular>()) != nullptr) {
+    if (TryPoolLargeChunk(chunk)) continue;
     allocator_->PerformFreeMemory(chunk);
   }
 }
 
+bool MemoryAllocator::Unmapper::TryPoolLargeChunk(MemoryChunk* chunk) {
+  if (FLAG_large_page_pool_size == 0) return false;
+  if (chunk->executable() == EXECUTABLE) return false;
+  if (!chunk->reserved_memory()->IsReserved()) return false;
+  const size_t size = chunk->size();
+  base::LockGuard<base::AdaptiveMutex> guard(&mutex_);
+  if (pooled_large_bytes_ + size >
+      static_cast<size_t>(FLAG_large_page_pool_size) * MB) {
+    return false;
+  }
+  chunk->ReleaseAllocatedMemory();
+  chunks_[kPooledLarge].push_back(chunk);
+  pooled_large_bytes_ += size;
+  return true;
+}
+
+MemoryChunk* MemoryAllocator::Unmapper::TryGetPooledLargeChunkSafe(
+    size_t size) {
+  base::LockGuard<base::AdaptiveMutex> guard(&mutex_);
+  for (auto it = chunks_[kPooledLarge].begin();
+       it != chunks_[kPooledLarge].end(); ++it) {
+    MemoryChunk* chunk = *it;
+    if (chunk->size() >= size && chunk->size() <= 2 * size) {
+      chunks_[kPooledLarge].erase(it);
+      pooled_large_bytes_ -= chunk->size();
+      return chunk;
+    }
+  }
+  return nullptr;
+}
+
 void MemoryAllocator::Unmapper::ReconsiderDelayedChunks() {
   std::list<MemoryChunk*> delayed_chunks(std::move(delayed_regular_chunks_));
   // Move constructed, so the permanent list should be empty.
@@ -446,6 +493,13 @@ Address MemoryAllocator::ReserveAlignedMemory(size_t size, size_t alignment,
   base::VirtualMemory reservation(size, alignment);
 
   if (!reservation.IsReserved()) return NULL;
+  if (FLAG_numa_node >= 0) {
+    // Without an explicit policy the chunk's physical pages land on the
+    // node of whichever thread faults them in first, which interleaves the
+    // heap across nodes once GC worker threads touch it.
+    base::OS::BindMemoryToNode(reservation.address(), reservation.size(),
+                               FLAG_numa_node);
+  }
   size_.Increment(static_cast<intptr_t>(reservation.size()));
   Address base =
       RoundUp(static_cast<Address>(reservation.address()), alignment);
@@ -526,6 +580,7 @@ MemoryChunk* MemoryChunk::Initialize(Heap* heap, Address base, size_t size,
   chunk->set_prev_chunk(nullptr);
   chunk->local_tracker_ = nullptr;
   chunk->black_area_end_marker_map_ = nullptr;
+  chunk->write_unprotect_counter_ = 0;
 
   DCHECK(OFFSET_OF(MemoryChunk, flags_) == kFlagsOffset);
   DCHECK(OFFSET_OF(MemoryChunk, live_byte_count_) == kLiveBytesOffset);
@@ -542,6 +597,36 @@ MemoryChunk* MemoryChunk::Initialize(Heap* heap, Address base, size_t size,
 }
 
 
+void MemoryChunk::SetReadAndExecutable() {
+  DCHECK(FLAG_write_protect_code_memory);
+  DCHECK(IsFlagSet(IS_EXECUTABLE));
+  // A page that was committed after the last protection pass has a counter
+  // of zero but is still writable; it is picked up by the next pass.
+  if (write_unprotect_counter_ == 0) return;
+  write_unprotect_counter_--;
+  if (write_unprotect_counter_ == 0) {
+    // A concurrent sweeper may still write free-list entries into this page;
+    // leave it writable and let the pass after the next GC protect it.
+    if (concurrent_sweeping_state().Value() != kSweepingDone) return;
+    DCHECK(IsAddressAligned(area_start_,
+                            static_cast<intptr_t>(base::OS::CommitPageSize())));
+    base::OS::ProtectCode(area_start_,
+                          static_cast<size_t>(area_end_ - area_start_));
+  }
+}
+
+void MemoryChunk::SetReadWriteAndExecutable() {
+  DCHECK(FLAG_write_protect_code_memory);
+  DCHECK(IsFlagSet(IS_EXECUTABLE));
+  write_unprotect_counter_++;
+  if (write_unprotect_counter_ == 1) {
+    DCHECK(IsAddressAligned(area_start_,
+                            static_cast<intptr_t>(base::OS::CommitPageSize())));
+    base::OS::UnprotectCode(area_start_,
+                            static_cast<size_t>(area_end_ - area_start_));
+  }
+}
+
 // Commit MemoryChunk area to the requested size.
 bool MemoryChunk::CommitArea(size_t requested) {
   size_t guard_size =
@@ -730,6 +815,17 @@ MemoryChunk* MemoryAllocator::AllocateChunk(intptr_t reserve_area_size,
     area_end = area_start + commit_area_size;
   }
 
+  // Old space and code space chunks are long-lived and densely accessed, so
+  // huge page backing pays for itself in TLB hits. Chunks carved out of the
+  // code range are already covered by the advice given at range reservation.
+  if (FLAG_huge_pages && owner != NULL && reservation.IsReserved() &&
+      (owner->identity() == OLD_SPACE || owner->identity() == CODE_SPACE)) {
+    if (base::OS::AdviseHugePages(reservation.address(), reservation.size())) {
+      isolate_->counters()->huge_pages_advised_kb()->Increment(
+          static_cast<int>(reservation.size() / KB));
+    }
+  }
+
   // Use chunk_size for statistics and callbacks because we assume that they
   // treat reserved but not-yet committed memory regions of chunks as allocated.
   isolate_->counters()->memory_allocated()->Increment(
@@ -764,6 +860,45 @@ void Page::ResetFreeListStatistics() {
   available_in_free_list_ = 0;
 }
 
+size_t Page::ShrinkToHighWaterMark() {
+  // Shrink pages to high water mark. The water mark points either to a filler
+  // or the area_end.
+  HeapObject* filler = HeapObject::FromAddress(HighWaterMark());
+  if (filler->address() == area_end()) return 0;
+  CHECK(filler->IsFiller());
+  if (!filler->IsFreeSpace()) return 0;
+
+#ifdef DEBUG
+  // Check the the filler is indeed the last filler on the page.
+  HeapObjectIterator it(this);
+  HeapObject* filler2 = nullptr;
+  for (HeapObject* obj = it.Next(); obj != nullptr; obj = it.Next()) {
+    filler2 = HeapObject::FromAddress(obj->address() + obj->Size());
+  }
+  if (filler2 == nullptr || filler2->address() == area_end()) return 0;
+  DCHECK(filler2->IsFiller());
+  DCHECK_EQ(filler->address(), filler2->address());
+#endif  // DEBUG
+
+  // Keep a filler of at least FreeSpace size at the end so that the page
+  // stays iterable after the shrink.
+  size_t unused = RoundDown(
+      static_cast<size_t>(area_end() - filler->address() -
+                          (FreeSpace::kNextOffset + kPointerSize)),
+      static_cast<size_t>(base::OS::CommitPageSize()));
+  if (unused > 0) {
+    heap()->CreateFillerObjectAt(
+        filler->address(),
+        static_cast<int>(area_end() - filler->address() - unused),
+        ClearRecordedSlots::kNo);
+    heap()->memory_allocator()->PartialFreeMemory(
+        this, address() + size() - unused);
+    CHECK(filler->IsFiller());
+    CHECK_EQ(filler->address() + filler->Size(), area_end());
+  }
+  return unused;
+}
+
 void MemoryAllocator::PartialFreeMemory(MemoryChunk* chunk,
                                         Address start_free) {
   // We do not allow partial shrink for code.
@@ -781,6 +916,7 @@ void MemoryAllocator::PartialFreeMemory(MemoryChunk* chunk,
   isolate_->counters()->memory_allocated()->Decrement(
       static_cast<int>(to_free_size));
   chunk->set_size(size - to_free_size);
+  chunk->set_area_end(start_free);
 
   reservation->ReleasePartial(start_free);
 }
@@ -881,17 +1017,50 @@ template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, SemiSpace>(
     intptr_t size, SemiSpace* owner, Executability executable);
 template Page*
+MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+    intptr_t size, PagedSpace* owner, Executability executable);
+template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, SemiSpace>(
     intptr_t size, SemiSpace* owner, Executability executable);
 
 LargePage* MemoryAllocator::AllocateLargePage(intptr_t size,
                                               LargeObjectSpace* owner,
                                               Executability executable) {
-  MemoryChunk* chunk = AllocateChunk(size, size, executable, owner);
+  MemoryChunk* chunk = nullptr;
+  if (executable == NOT_EXECUTABLE) {
+    chunk = AllocateLargePagePooled(static_cast<size_t>(size), owner);
+  }
+  if (chunk == nullptr) {
+    chunk = AllocateChunk(size, size, executable, owner);
+  }
   if (chunk == nullptr) return nullptr;
   return LargePage::Initialize(isolate_->heap(), chunk, executable, owner);
 }
 
+MemoryChunk* MemoryAllocator::AllocateLargePagePooled(size_t object_area_size,
+                                                      LargeObjectSpace* owner) {
+  // Mirrors the chunk size AllocateChunk would reserve for a non-executable
+  // chunk of the requested area size.
+  const size_t required_size =
+      RoundUp(MemoryChunk::kObjectStartOffset + object_area_size,
+              base::OS::CommitPageSize());
+  MemoryChunk* chunk = unmapper()->TryGetPooledLargeChunkSafe(required_size);
+  if (chunk == nullptr) return nullptr;
+  const Address start = chunk->address();
+  const size_t chunk_size = chunk->size();
+  const Address area_start = start + MemoryChunk::kObjectStartOffset;
+  const Address area_end = start + chunk_size;
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(area_start, chunk_size - MemoryChunk::kObjectStartOffset);
+  }
+  base::VirtualMemory reservation;
+  reservation.TakeControl(chunk->reserved_memory());
+  MemoryChunk::Initialize(isolate_->heap(), start, chunk_size, area_start,
+                          area_end, NOT_EXECUTABLE, owner, &reservation);
+  size_.Increment(static_cast<intptr_t>(chunk_size));
+  return chunk;
+}
+
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
@@ -1032,8 +1201,14 @@ static SlotSet* AllocateSlotSet(size_t size, Address page_start) {
 }
 
 void MemoryChunk::AllocateOldToNewSlots() {
-  DCHECK(nullptr == old_to_new_slots_);
-  old_to_new_slots_ = AllocateSlotSet(size_, address());
+  // May race with the concurrent store-buffer processing task; whoever loses
+  // the publishing race discards its allocation.
+  SlotSet* slot_set = AllocateSlotSet(size_, address());
+  if (base::Release_CompareAndSwap(
+          reinterpret_cast<base::AtomicWord*>(&old_to_new_slots_), 0,
+          reinterpret_cast<base::AtomicWord>(slot_set)) != 0) {
+    delete[] slot_set;
+  }
 }
 
 void MemoryChunk::ReleaseOldToNewSlots() {
@@ -1099,13 +1274,32 @@ STATIC_ASSERT(static_cast<ObjectSpace>(1 << AllocationSpace::CODE_SPACE) ==
 STATIC_ASSERT(static_cast<ObjectSpace>(1 << AllocationSpace::MAP_SPACE) ==
               ObjectSpace::kObjectSpaceMapSpace);
 
-void Space::AllocationStep(Address soon_object, int size) {
+void Space::AllocationStepSlow(Address soon_object, int size) {
   if (!allocation_observers_paused_) {
+    // Report all bytes accumulated since the last notification in one go;
+    // the observers keep their own counters, so the aggregate decrement is
+    // equivalent to notifying them for every single allocation.
+    int bytes_allocated = static_cast<int>(allocation_step_pending_bytes_);
     for (int i = 0; i < allocation_observers_->length(); ++i) {
       AllocationObserver* o = (*allocation_observers_)[i];
-      o->AllocationStep(size, soon_object, size);
+      o->AllocationStep(bytes_allocated, soon_object, size);
+    }
+  }
+  StartNextAllocationStep();
+}
+
+void Space::StartNextAllocationStep() {
+  allocation_step_pending_bytes_ = 0;
+  // With no observers (or while they are paused) the countdown degenerates
+  // to a bound that merely keeps the pending byte count from overflowing.
+  intptr_t countdown = kMaxInt;
+  if (!allocation_observers_paused_) {
+    for (int i = 0; i < allocation_observers_->length(); ++i) {
+      countdown =
+          Min(countdown, (*allocation_observers_)[i]->bytes_to_next_step());
     }
   }
+  allocation_step_countdown_ = countdown;
 }
 
 PagedSpace::PagedSpace(Heap* heap, AllocationSpace space,
@@ -1165,6 +1359,22 @@ void PagedSpace::RefillFreeList() {
   accounting_stats_.IncreaseCapacity(added);
 }
 
+bool PagedSpace::RefillLabBackground(LocalAllocationBuffer* lab,
+                                     int size_in_bytes) {
+  DCHECK(identity() == OLD_SPACE);
+  base::LockGuard<base::Mutex> guard(&space_mutex_);
+  int node_size = 0;
+  FreeSpace* node = free_list_.TryRemoveMemory(size_in_bytes, &node_size);
+  if (node == nullptr) return false;
+  // The whole node is accounted as allocated; whatever the buffer does not
+  // hand out is turned into a filler when it is closed.
+  Allocate(node_size);
+  AllocationResult result(HeapObject::FromAddress(node->address()));
+  *lab = LocalAllocationBuffer::FromResult(heap(), result, node_size);
+  DCHECK(lab->IsValid());
+  return true;
+}
+
 void PagedSpace::MergeCompactionSpace(CompactionSpace* other) {
   DCHECK(identity() == other->identity());
   // Unmerged fields:
@@ -1243,7 +1453,17 @@ bool PagedSpace::Expand() {
 
   if (!heap()->CanExpandOldGeneration(size)) return false;
 
-  Page* p = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  Page* p;
+  if (executable() == NOT_EXECUTABLE &&
+      size == static_cast<int>(MemoryChunk::kAllocatableMemory)) {
+    // Prefer a pooled page, or one queued for unmapping, over going back to
+    // the OS; allocation-heavy phases otherwise cause constant mmap/munmap
+    // churn. AllocatePage falls back to a fresh chunk if the pool is empty.
+    p = heap()->memory_allocator()->AllocatePage<MemoryAllocator::kPooled>(
+        size, this, executable());
+  } else {
+    p = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  }
   if (p == nullptr) return false;
 
   AccountCommitted(static_cast<intptr_t>(p->size()));
@@ -1298,6 +1518,20 @@ void PagedSpace::MarkAllocationInfoBlack() {
   }
 }
 
+void PagedSpace::ShrinkImmortalImmovablePages() {
+  DCHECK(!heap()->deserialization_complete());
+  MemoryChunk::UpdateHighWaterMark(allocation_info_.top());
+  EmptyAllocationInfo();
+  ResetFreeList();
+
+  for (Page* page : *this) {
+    DCHECK(page->IsFlagSet(Page::NEVER_EVACUATE));
+    size_t unused = page->ShrinkToHighWaterMark();
+    accounting_stats_.DecreaseCapacity(unused);
+    AccountUncommitted(static_cast<intptr_t>(unused));
+  }
+}
+
 // Empty space allocation info, returning unused area to free list.
 void PagedSpace::EmptyAllocationInfo() {
   // Mark the old linear allocation area with a free space map so it can be
@@ -1480,6 +1714,45 @@ void NewSpace::Grow() {
 }
 
 
+void NewSpace::ResizeTo(int new_capacity) {
+  new_capacity = RoundUp(new_capacity, Page::kPageSize);
+  // Never shrink below what is currently in use, with the same slack that
+  // Shrink keeps.
+  new_capacity = Max(new_capacity, RoundUp(2 * SizeAsInt(), Page::kPageSize));
+  new_capacity =
+      Max(Min(new_capacity, MaximumCapacity()), InitialTotalCapacity());
+  if (new_capacity > TotalCapacity()) {
+    if (to_space_.GrowTo(new_capacity)) {
+      // Only grow from space if we managed to grow to-space.
+      if (!from_space_.GrowTo(new_capacity)) {
+        // If we managed to grow to-space but couldn't grow from-space,
+        // attempt to shrink to-space.
+        if (!to_space_.ShrinkTo(from_space_.current_capacity())) {
+          // We are in an inconsistent state because we could not
+          // commit/uncommit memory from new space.
+          CHECK(false);
+        }
+      }
+    }
+  } else if (new_capacity < TotalCapacity()) {
+    if (to_space_.ShrinkTo(new_capacity)) {
+      // Only shrink from-space if we managed to shrink to-space.
+      from_space_.Reset();
+      if (!from_space_.ShrinkTo(new_capacity)) {
+        // If we managed to shrink to-space but couldn't shrink from
+        // space, attempt to grow to-space again.
+        if (!to_space_.GrowTo(from_space_.current_capacity())) {
+          // We are in an inconsistent state because we could not
+          // commit/uncommit memory from new space.
+          CHECK(false);
+        }
+      }
+    }
+  }
+  DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
+}
+
+
 void NewSpace::Shrink() {
   int new_capacity = Max(InitialTotalCapacity(), 2 * SizeAsInt());
   int rounded_new_capacity = RoundUp(new_capacity, Page::kPageSize);
@@ -2553,6 +2826,16 @@ HeapObject* FreeList::Allocate(int size_in_bytes) {
   return new_node;
 }
 
+FreeSpace* FreeList::TryRemoveMemory(int size_in_bytes, int* node_size) {
+  DCHECK(0 < size_in_bytes);
+  DCHECK(size_in_bytes <= kMaxBlockSize);
+  DCHECK(IsAligned(size_in_bytes, kPointerSize));
+  FreeSpace* node = FindNodeFor(size_in_bytes, node_size);
+  DCHECK_IMPLIES(node != nullptr,
+                 !MarkCompactCollector::IsOnEvacuationCandidate(node));
+  return node;
+}
+
 intptr_t FreeList::EvictFreeListItems(Page* page) {
   intptr_t sum = 0;
   page->ForAllFreeListCategories(
@@ -2752,6 +3035,23 @@ HeapObject* CompactionSpace::SweepAndRetryAllocation(int size_in_bytes) {
 }
 
 
+bool CompactionSpace::ReserveTargetCapacity(intptr_t live_bytes) {
+  // Memory the sweeper has already returned is what on-demand refills would
+  // hand out first; grab it before falling back to fresh pages.
+  intptr_t reserved = free_list_.Available();
+  while (reserved < live_bytes) {
+    RefillFreeList();
+    if (free_list_.Available() == reserved) break;
+    reserved = free_list_.Available();
+  }
+  while (reserved < live_bytes) {
+    if (!Expand()) return false;
+    reserved = free_list_.Available();
+  }
+  return true;
+}
+
+
 HeapObject* PagedSpace::SlowAllocateRaw(int size_in_bytes) {
   const int kMaxPagesToSweep = 1;
 
@@ -353,7 +353,8 @@ class MemoryChunk {
       + FreeListCategory::kSize * kNumberOfCategories +
       kPointerSize  // LocalArrayBufferTracker* local_tracker_;
       // std::unordered_set<Address>* black_area_end_marker_map_
-      + kPointerSize;
+      + kPointerSize
+      + kIntptrSize;  // intptr_t write_unprotect_counter_
 
   // We add some more space to the computed header size to amount for missing
   // alignment requirements in our computation.
@@ -447,13 +448,21 @@ class MemoryChunk {
   size_t size() const { return size_; }
   void set_size(size_t size) { size_ = size; }
 
+  void set_area_end(Address area_end) { area_end_ = area_end; }
+
   inline Heap* heap() const { return heap_; }
 
   inline SkipList* skip_list() { return skip_list_; }
 
   inline void set_skip_list(SkipList* skip_list) { skip_list_ = skip_list; }
 
-  inline SlotSet* old_to_new_slots() { return old_to_new_slots_; }
+  // The old-to-new slot set is inserted into concurrently by the store
+  // buffer processing task, so it is published with release-acquire
+  // semantics; the other slot sets are main-thread only.
+  inline SlotSet* old_to_new_slots() {
+    return reinterpret_cast<SlotSet*>(base::Acquire_Load(
+        reinterpret_cast<base::AtomicWord*>(&old_to_new_slots_)));
+  }
   inline SlotSet* old_to_old_slots() { return old_to_old_slots_; }
   inline TypedSlotSet* typed_old_to_new_slots() {
     return typed_old_to_new_slots_;
@@ -557,6 +566,14 @@ class MemoryChunk {
     return IsFlagSet(IS_EXECUTABLE) ? EXECUTABLE : NOT_EXECUTABLE;
   }
 
+  // Write protection of executable pages, see --write-protect-code-memory.
+  // Calls nest: the page only becomes read+execute again when as many
+  // SetReadAndExecutable calls have been made as SetReadWriteAndExecutable
+  // calls before. Pages are committed writable, so a page that has never
+  // been protected ignores the first unbalanced SetReadAndExecutable call.
+  void SetReadAndExecutable();
+  void SetReadWriteAndExecutable();
+
   bool InNewSpace() {
     return (flags_ & ((1 << IN_FROM_SPACE) | (1 << IN_TO_SPACE))) != 0;
   }
@@ -693,6 +710,10 @@ class MemoryChunk {
   // Stores the end addresses of black areas.
   std::unordered_set<Address>* black_area_end_marker_map_;
 
+  // Counts the number of currently active SetReadWriteAndExecutable scopes
+  // on this page. The page is read+execute only iff the counter is zero.
+  intptr_t write_unprotect_counter_;
+
  private:
   void InitializeReservedMemory() { reservation_.Reset(); }
 
@@ -805,6 +826,10 @@ class Page : public MemoryChunk {
 
   void ResetFreeListStatistics();
 
+  // Frees the unused OS pages between the high water mark and the area end,
+  // leaving a filler behind. Returns the number of bytes freed.
+  size_t ShrinkToHighWaterMark();
+
   int LiveBytesFromFreeList() {
     return static_cast<int>(area_size() - wasted_memory() -
                             available_in_free_list());
@@ -880,6 +905,8 @@ class Space : public Malloced {
   Space(Heap* heap, AllocationSpace id, Executability executable)
       : allocation_observers_(new List<AllocationObserver*>()),
         allocation_observers_paused_(false),
+        allocation_step_countdown_(kMaxInt),
+        allocation_step_pending_bytes_(0),
         heap_(heap),
         id_(id),
         executable_(executable),
@@ -898,24 +925,38 @@ class Space : public Malloced {
 
   virtual void AddAllocationObserver(AllocationObserver* observer) {
     allocation_observers_->Add(observer);
+    StartNextAllocationStep();
   }
 
   virtual void RemoveAllocationObserver(AllocationObserver* observer) {
     bool removed = allocation_observers_->RemoveElement(observer);
     USE(removed);
     DCHECK(removed);
+    StartNextAllocationStep();
   }
 
   virtual void PauseAllocationObservers() {
     allocation_observers_paused_ = true;
+    StartNextAllocationStep();
   }
 
   virtual void ResumeAllocationObservers() {
     allocation_observers_paused_ = false;
+    StartNextAllocationStep();
+  }
+
+  // Notifies allocation observers of an allocation. The countdown tracks
+  // the distance to the nearest observer step, the same trick the new
+  // space plays with its inline allocation limit, so allocations that do
+  // not complete a step only pay for an add and a compare here.
+  void AllocationStep(Address soon_object, int size) {
+    allocation_step_pending_bytes_ += size;
+    if (V8_UNLIKELY(allocation_step_pending_bytes_ >=
+                    allocation_step_countdown_)) {
+      AllocationStepSlow(soon_object, size);
+    }
   }
 
-  void AllocationStep(Address soon_object, int size);
-
   // Return the total amount committed memory for this space, i.e., allocatable
   // memory and page headers.
   virtual intptr_t CommittedMemory() { return committed_; }
@@ -962,9 +1003,22 @@ class Space : public Malloced {
 #endif
 
  protected:
+  // Delivers the bytes accumulated since the last step to the observers
+  // and re-arms the countdown.
+  void AllocationStepSlow(Address soon_object, int size);
+
+  // Resets the accumulated bytes and recomputes the countdown as the
+  // smallest remaining step distance across the registered observers.
+  void StartNextAllocationStep();
+
   std::unique_ptr<List<AllocationObserver*>> allocation_observers_;
   bool allocation_observers_paused_;
 
+  // Bytes left until the nearest observer is due for a step, and the bytes
+  // allocated since the observers were last notified.
+  intptr_t allocation_step_countdown_;
+  intptr_t allocation_step_pending_bytes_;
+
  private:
   Heap* heap_;
   AllocationSpace id_;
@@ -1161,6 +1215,7 @@ class MemoryAllocator {
 
     explicit Unmapper(MemoryAllocator* allocator)
         : allocator_(allocator),
+          pooled_large_bytes_(0),
           pending_unmapping_tasks_semaphore_(0),
           concurrent_unmapping_tasks_active_(0) {}
 
@@ -1190,21 +1245,29 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Removes a pooled dead large chunk whose committed size fits the
+    // requested size, or returns nullptr. A chunk matches if it wastes at
+    // most half of its committed memory, which partitions the pool into
+    // power-of-two size classes without keeping a table per class.
+    MemoryChunk* TryGetPooledLargeChunkSafe(size_t size);
+
     void FreeQueuedChunks();
     bool WaitUntilCompleted();
 
    private:
     enum ChunkQueueType {
-      kRegular,     // Pages of kPageSize that do not live in a CodeRange and
-                    // can thus be used for stealing.
-      kNonRegular,  // Large chunks and executable chunks.
-      kPooled,      // Pooled chunks, already uncommited and ready for reuse.
+      kRegular,      // Pages of kPageSize that do not live in a CodeRange and
+                     // can thus be used for stealing.
+      kNonRegular,   // Large chunks and executable chunks.
+      kPooled,       // Pooled chunks, already uncommited and ready for reuse.
+      kPooledLarge,  // Dead large chunks kept committed for reuse, capped by
+                     // --large-page-pool-size.
       kNumberOfChunkQueues,
     };
 
     template <ChunkQueueType type>
     void AddMemoryChunkSafe(MemoryChunk* chunk) {
-      base::LockGuard<base::Mutex> guard(&mutex_);
+      base::LockGuard<base::AdaptiveMutex> guard(&mutex_);
       if (type != kRegular || allocator_->CanFreeMemoryChunk(chunk)) {
         chunks_[type].push_back(chunk);
       } else {
@@ -1215,7 +1278,7 @@ class MemoryAllocator {
 
     template <ChunkQueueType type>
     MemoryChunk* GetMemoryChunkSafe() {
-      base::LockGuard<base::Mutex> guard(&mutex_);
+      base::LockGuard<base::AdaptiveMutex> guard(&mutex_);
       if (chunks_[type].empty()) return nullptr;
       MemoryChunk* chunk = chunks_[type].front();
       chunks_[type].pop_front();
@@ -1225,13 +1288,21 @@ class MemoryAllocator {
     void ReconsiderDelayedChunks();
     void PerformFreeMemoryOnQueuedChunks();
 
-    base::Mutex mutex_;
+    // Diverts a dead large chunk into the large page pool instead of
+    // unmapping it. Fails if the chunk does not qualify or the pool is full.
+    bool TryPoolLargeChunk(MemoryChunk* chunk);
+
+    // The queue operations are tiny critical sections contended by sweeper
+    // tasks, which is what AdaptiveMutex's spinning path is for.
+    base::AdaptiveMutex mutex_;
     MemoryAllocator* allocator_;
     std::list<MemoryChunk*> chunks_[kNumberOfChunkQueues];
     // Delayed chunks cannot be processed in the current unmapping cycle because
     // of dependencies such as an active sweeper.
     // See MemoryAllocator::CanFreeMemoryChunk.
     std::list<MemoryChunk*> delayed_regular_chunks_;
+    // Committed bytes held in the kPooledLarge queue. Guarded by mutex_.
+    size_t pooled_large_bytes_;
     base::Semaphore pending_unmapping_tasks_semaphore_;
     intptr_t concurrent_unmapping_tasks_active_;
 
@@ -1381,6 +1452,11 @@ class MemoryAllocator {
   template <typename SpaceType>
   MemoryChunk* AllocatePagePooled(SpaceType* owner);
 
+  // Tries to reuse a pooled dead large chunk for an object area of the given
+  // size. Returns nullptr if the pool holds no matching chunk.
+  MemoryChunk* AllocateLargePagePooled(size_t object_area_size,
+                                       LargeObjectSpace* owner);
+
   Isolate* isolate_;
 
   CodeRange* code_range_;
@@ -1732,6 +1808,14 @@ class FreeList {
   // should be a non-zero multiple of the word size.
   MUST_USE_RESULT HeapObject* Allocate(int size_in_bytes);
 
+  // Removes a block of at least {size_in_bytes} from the free list without
+  // touching the owner's linear allocation area. The actual size of the
+  // removed node is written to {node_size}. The caller must hold the owning
+  // space's mutex and is responsible for accounting. Returns nullptr if no
+  // large enough node is found.
+  MUST_USE_RESULT FreeSpace* TryRemoveMemory(int size_in_bytes,
+                                             int* node_size);
+
   // Clear the free list.
   void Reset();
 
@@ -2089,6 +2173,18 @@ class PagedSpace : public Space {
   MUST_USE_RESULT inline AllocationResult AllocateRawUnalignedSynchronized(
       int size_in_bytes);
 
+  // Refills {lab} with a block of at least {size_in_bytes} taken from this
+  // space's free list under the space mutex, so that a background thread can
+  // bump-allocate out of the buffer without further synchronization. In
+  // contrast to AllocateRawUnalignedSynchronized this leaves the space's own
+  // linear allocation area alone; callers must still not race with
+  // unsynchronized main-thread free-list allocation, i.e. the main thread
+  // has to be parked or allocating from its linear area only. The unused
+  // tail of the buffer becomes a filler object when the buffer is closed.
+  // Returns false if no large enough block is available.
+  MUST_USE_RESULT bool RefillLabBackground(LocalAllocationBuffer* lab,
+                                           int size_in_bytes);
+
   // Allocate the requested number of bytes in the space double aligned if
   // possible, return a failure object if not.
   MUST_USE_RESULT inline AllocationResult AllocateRawAligned(
@@ -2129,6 +2225,12 @@ class PagedSpace : public Space {
   // Empty space allocation info, returning unused area to free list.
   void EmptyAllocationInfo();
 
+  // Shrinks the pages holding the immortal immovable snapshot objects to
+  // their high water mark and releases the unused tail to the OS. Embedders
+  // running many isolates otherwise pay for the committed tail of every
+  // snapshot page in every isolate. Called once after deserialization.
+  void ShrinkImmortalImmovablePages();
+
   void MarkAllocationInfoBlack();
 
   void Allocate(int bytes) { accounting_stats_.AllocateBytes(bytes); }
@@ -2528,6 +2630,12 @@ class NewSpace : public Space {
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Resize the capacity of the semispaces to approximately |new_capacity|,
+  // bounded by the initial and maximum capacity and never below what is
+  // currently in use. Combines the Grow and Shrink paths for the adaptive
+  // semispace controller.
+  void ResizeTo(int new_capacity);
+
   // Return the allocated bytes in the active semispace.
   intptr_t Size() override {
     return to_space_.pages_used() * Page::kAllocatableMemory +
@@ -2816,6 +2924,13 @@ class CompactionSpace : public PagedSpace {
 
   bool is_local() override { return true; }
 
+  // Reserves target memory for about |live_bytes| of evacuated objects up
+  // front, first from pages the sweeper has returned and then from fresh
+  // pages, so that parallel evacuation does not have to compete for refills
+  // and abort pages midway. Returns false if the full quota could not be
+  // reserved; evacuation then falls back to refilling on demand.
+  bool ReserveTargetCapacity(intptr_t live_bytes);
+
  protected:
   // The space is temporary and not included in any snapshots.
   bool snapshotable() override { return false; }
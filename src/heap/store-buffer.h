@@ -7,7 +7,9 @@
 
 #include "src/allocation.h"
 #include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/cancelable-task.h"
 #include "src/globals.h"
 #include "src/heap/slot-set.h"
 
@@ -15,11 +17,14 @@ namespace v8 {
 namespace internal {
 
 // Intermediate buffer that accumulates old-to-new stores from the generated
-// code. On buffer overflow the slots are moved to the remembered set.
+// code. Uses two buffers: while the mutator fills one, a background task
+// moves the entries of the other one to the remembered set, so overflow
+// does not stall the mutator on the whole drain.
 class StoreBuffer {
  public:
   static const int kStoreBufferSize = 1 << (14 + kPointerSizeLog2);
   static const int kStoreBufferMask = kStoreBufferSize - 1;
+  static const int kStoreBuffers = 2;
 
   static void StoreBufferOverflow(Isolate* isolate);
 
@@ -30,19 +35,58 @@ class StoreBuffer {
   // Used to add entries from generated code.
   inline Address* top_address() { return reinterpret_cast<Address*>(&top_); }
 
-  void MoveEntriesToRememberedSet();
+  // Moves all entries of all buffers to the remembered set, waiting for any
+  // concurrent processing to finish. Called by the GC before it uses the
+  // remembered set.
+  void MoveAllEntriesToRememberedSet();
 
  private:
+  // Task that concurrently processes the full store buffer.
+  class Task : public CancelableTask {
+   public:
+    Task(Isolate* isolate, StoreBuffer* store_buffer)
+        : CancelableTask(isolate), store_buffer_(store_buffer) {}
+    virtual ~Task() {}
+
+   private:
+    void RunInternal() override {
+      store_buffer_->ConcurrentlyProcessStoreBuffer();
+    }
+    StoreBuffer* store_buffer_;
+    DISALLOW_COPY_AND_ASSIGN(Task);
+  };
+
+  // Makes the other buffer the current one, records the top of the full
+  // buffer, and schedules a task to process it.
+  void FlipStoreBuffers();
+
+  void MoveEntriesToRememberedSet(int index);
+  void ConcurrentlyProcessStoreBuffer();
+
   Heap* heap_;
 
   Address* top_;
 
-  // The start and the limit of the buffer that contains store slots
-  // added from the generated code.
-  Address* start_;
-  Address* limit_;
+  // The start and the limit of the buffers that contain store slots
+  // added from the generated code. The two buffers are adjacent and share
+  // the alignment that lets generated code detect overflow with a bit test
+  // on the top pointer.
+  Address* start_[kStoreBuffers];
+  Address* limit_[kStoreBuffers];
+
+  // At most one lazy_top_ pointer is set at any time.
+  Address* lazy_top_[kStoreBuffers];
+
+  // The index of the buffer the mutator currently appends to.
+  int current_;
+
+  // We only want to have at most one concurrent processing task running.
+  bool task_running_;
 
   base::VirtualMemory* virtual_memory_;
+
+  // Serializes concurrent and main-thread processing of the buffers.
+  base::Mutex mutex_;
 };
 
 }  // namespace internal
@@ -64,6 +64,7 @@ void IC::SetTargetAtAddress(Address address, Code* target,
           target->kind() != Code::KEYED_STORE_IC));
 
   Heap* heap = target->GetHeap();
+  CodePageMemoryModificationScope modification_scope(address);
   Code* old_target = GetTargetAtAddress(address, constant_pool);
 #ifdef DEBUG
   // STORE_IC and KEYED_STORE_IC use Code::extra_ic_state() to mark
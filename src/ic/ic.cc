@@ -1071,8 +1071,32 @@ Handle<Object> LoadIC::GetMapIndependentHandler(LookupIterator* lookup) {
   Handle<JSObject> holder = lookup->GetHolder<JSObject>();
   bool receiver_is_holder = receiver.is_identical_to(holder);
   switch (lookup->state()) {
-    case LookupIterator::INTERCEPTOR:
+    case LookupIterator::INTERCEPTOR: {
+      if (holder->GetNamedInterceptor()->stable_per_map()) {
+        // The embedder has declared that this interceptor's decision whether
+        // to handle a given name never changes for objects of a single map.
+        // Probe it once; if it passes on this name, cache the handler for the
+        // property found behind it so that repeated accesses skip the
+        // interceptor entirely.
+        LookupIterator probe = *lookup;
+        bool done = false;
+        Handle<Object> result;
+        if (JSObject::GetPropertyWithInterceptor(&probe, &done)
+                .ToHandle(&result)) {
+          if (!done) {
+            LookupIterator it = *lookup;
+            it.Next();
+            LookupForRead(&it);
+            if (it.IsFound()) return ComputeHandler(&it);
+          }
+        } else {
+          // The interceptor threw; the actual load will run it again and
+          // report the exception.
+          isolate()->clear_pending_exception();
+        }
+      }
       break;  // Custom-compiled handler.
+    }
 
     case LookupIterator::ACCESSOR: {
       // Use simple field loads for some well-known callback properties.
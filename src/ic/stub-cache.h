@@ -91,9 +91,14 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
+  // Table sizes are baked into the probe sequences that the architecture
+  // back ends and the CodeStubAssembler emit, so they can only be changed
+  // here. Megamorphic-heavy workloads thrash the tables well before the
+  // entries go stale, so they are sized generously; a table is only a few
+  // hundred kilobytes of off-heap memory per isolate.
+  static const int kPrimaryTableBits = 13;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  static const int kSecondaryTableBits = 11;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   // Some magic number used in primary and secondary hash computations.
@@ -680,6 +680,7 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
       register_allocator_(nullptr),
       generator_resume_points_(info->literal()->yield_count(), info->zone()),
       generator_state_(),
+      suspended_register_count_(0),
       loop_depth_(0),
       home_object_symbol_(info->isolate()->factory()->home_object_symbol()),
       prototype_string_(info->isolate()->factory()->prototype_string()) {
@@ -688,7 +689,14 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
 Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(Isolate* isolate) {
   AllocateDeferredConstants();
   if (HasStackOverflow()) return Handle<BytecodeArray>();
-  return builder()->ToBytecodeArray(isolate);
+  Handle<BytecodeArray> bytecode_array = builder()->ToBytecodeArray(isolate);
+  if (IsResumableFunction(info()->literal()->kind())) {
+    // Only registers allocated at some suspend point can be live across it,
+    // so the register file saved on suspension can be limited to the largest
+    // allocation watermark seen at any of the yields.
+    bytecode_array->set_suspended_register_count(suspended_register_count_);
+  }
+  return bytecode_array;
 }
 
 void BytecodeGenerator::AllocateDeferredConstants() {
@@ -1954,6 +1962,14 @@ void BytecodeGenerator::VisitVariableLoad(Variable* variable,
     }
     case VariableLocation::GLOBAL:
     case VariableLocation::UNALLOCATED: {
+      // Handle known global constants like 'undefined' specially to avoid a
+      // load from a global cell for them.
+      Handle<Object> constant_value =
+          info()->isolate()->factory()->GlobalConstantFor(variable->name());
+      if (!constant_value.is_null()) {
+        builder()->LoadLiteral(constant_value);
+        break;
+      }
       builder()->LoadGlobal(feedback_index(slot), typeof_mode);
       break;
     }
@@ -2360,6 +2376,13 @@ void BytecodeGenerator::VisitYield(Yield* expr) {
 
   Register generator = VisitForRegisterValue(expr->generator_object());
 
+  // Every register live across this suspend point has been allocated by now,
+  // so the current allocation watermark bounds the registers that have to be
+  // persisted.
+  suspended_register_count_ =
+      std::max(suspended_register_count_,
+               builder()->fixed_and_temporary_register_count());
+
   // Save context, registers, and state. Then return.
   builder()
       ->LoadLiteral(Smi::FromInt(expr->yield_id()))
@@ -226,6 +226,7 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
 
   ZoneVector<BytecodeLabel> generator_resume_points_;
   Register generator_state_;
+  int suspended_register_count_;
   int loop_depth_;
 
   Handle<Name> home_object_symbol_;
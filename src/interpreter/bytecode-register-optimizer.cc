@@ -40,6 +40,12 @@ class BytecodeRegisterOptimizer::RegisterInfo final : public ZoneObject {
   // no materialized equivalent exists.
   RegisterInfo* GetMaterializedEquivalentOtherThan(Register reg);
 
+  // Get the member of this register's equivalence set with the lowest
+  // register index that is materialized and not register |reg|. Lower
+  // indices are preferred because they encode more compactly as
+  // operands. Returns nullptr if no materialized equivalent exists.
+  RegisterInfo* GetLowestIndexMaterializedEquivalentOtherThan(Register reg);
+
   // Get a member of this register's equivalence set that is intended
   // to be materialized in place of this register (which is currently
   // materialized). The best candidate is deemed to be the register
@@ -146,6 +152,23 @@ BytecodeRegisterOptimizer::RegisterInfo::GetMaterializedEquivalentOtherThan(
   return nullptr;
 }
 
+BytecodeRegisterOptimizer::RegisterInfo*
+BytecodeRegisterOptimizer::RegisterInfo::
+    GetLowestIndexMaterializedEquivalentOtherThan(Register reg) {
+  RegisterInfo* visitor = this;
+  RegisterInfo* best_info = nullptr;
+  do {
+    if (visitor->materialized() && visitor->register_value() != reg &&
+        (best_info == nullptr ||
+         visitor->register_value() < best_info->register_value())) {
+      best_info = visitor;
+    }
+    visitor = visitor->next_;
+  } while (visitor != this);
+
+  return best_info;
+}
+
 BytecodeRegisterOptimizer::RegisterInfo*
 BytecodeRegisterOptimizer::RegisterInfo::GetEquivalentToMaterialize() {
   DCHECK(this->materialized());
@@ -359,11 +382,11 @@ BytecodeRegisterOptimizer::GetMaterializedEquivalent(RegisterInfo* info) {
 BytecodeRegisterOptimizer::RegisterInfo*
 BytecodeRegisterOptimizer::GetMaterializedEquivalentNotAccumulator(
     RegisterInfo* info) {
-  if (info->materialized()) {
-    return info;
-  }
-
-  RegisterInfo* result = info->GetMaterializedEquivalentOtherThan(accumulator_);
+  // Pick the materialized equivalent with the lowest register index,
+  // even when |info| itself is materialized, so operands reference
+  // parameters and low locals where possible and stay narrow.
+  RegisterInfo* result =
+      info->GetLowestIndexMaterializedEquivalentOtherThan(accumulator_);
   if (result == nullptr) {
     Materialize(info);
     result = info;
@@ -469,13 +492,9 @@ Register BytecodeRegisterOptimizer::GetEquivalentRegisterForInputOperand(
   // locals and parameters, the RegInfo state is created in the
   // BytecodeRegisterOptimizer constructor.
   RegisterInfo* reg_info = GetOrCreateRegisterInfo(reg);
-  if (reg_info->materialized()) {
-    return reg;
-  } else {
-    RegisterInfo* equivalent_info =
-        GetMaterializedEquivalentNotAccumulator(reg_info);
-    return equivalent_info->register_value();
-  }
+  RegisterInfo* equivalent_info =
+      GetMaterializedEquivalentNotAccumulator(reg_info);
+  return equivalent_info->register_value();
 }
 
 void BytecodeRegisterOptimizer::PrepareRegisterInputOperand(
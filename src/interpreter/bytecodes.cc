@@ -577,14 +577,33 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
     switch (bytecode) {
       case Bytecode::kLdaZero:
       case Bytecode::kLdaSmi:
+      case Bytecode::kLdaUndefined:
       case Bytecode::kLdaNull:
       case Bytecode::kLdaTheHole:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaConstant:
+      case Bytecode::kLdaGlobal:
+      case Bytecode::kLdaContextSlot:
+      case Bytecode::kLdaNamedProperty:
+      case Bytecode::kLdaKeyedProperty:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseXor:
+      case Bytecode::kBitwiseAnd:
+      case Bytecode::kShiftLeft:
+      case Bytecode::kShiftRight:
+      case Bytecode::kShiftRightLogical:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftLeftSmi:
+      case Bytecode::kShiftRightSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
@@ -1005,17 +1005,25 @@ Node* InterpreterAssembler::RegisterCount() {
   return Word32Sar(frame_size, Int32Constant(kPointerSizeLog2));
 }
 
+Node* InterpreterAssembler::SuspendedRegisterCount() {
+  Node* bytecode_array = LoadRegister(Register::bytecode_array());
+  return LoadObjectField(bytecode_array,
+                         BytecodeArray::kSuspendedRegisterCountOffset,
+                         MachineType::Int32());
+}
+
 Node* InterpreterAssembler::ExportRegisterFile(Node* array) {
   if (FLAG_debug_code) {
     Node* array_size = LoadAndUntagFixedArrayBaseLength(array);
-    AbortIfWordNotEqual(
-        array_size, RegisterCount(), kInvalidRegisterFileInGenerator);
+    AbortIfWordNotEqual(array_size, SuspendedRegisterCount(),
+                        kInvalidRegisterFileInGenerator);
   }
 
   Variable var_index(this, MachineRepresentation::kWord32);
   var_index.Bind(Int32Constant(0));
 
-  // Iterate over register file and write values into array.
+  // Iterate over the registers that can be live across a suspend and write
+  // their values into the array; registers above that range are dead here.
   // The mapping of register to array index must match that used in
   // BytecodeGraphBuilder::VisitResumeGenerator.
   Label loop(this, &var_index), done_loop(this);
@@ -1023,7 +1031,7 @@ Node* InterpreterAssembler::ExportRegisterFile(Node* array) {
   Bind(&loop);
   {
     Node* index = var_index.value();
-    Node* condition = Int32LessThan(index, RegisterCount());
+    Node* condition = Int32LessThan(index, SuspendedRegisterCount());
     GotoUnless(condition, &done_loop);
 
     Node* reg_index =
@@ -1043,8 +1051,8 @@ Node* InterpreterAssembler::ExportRegisterFile(Node* array) {
 Node* InterpreterAssembler::ImportRegisterFile(Node* array) {
   if (FLAG_debug_code) {
     Node* array_size = LoadAndUntagFixedArrayBaseLength(array);
-    AbortIfWordNotEqual(
-        array_size, RegisterCount(), kInvalidRegisterFileInGenerator);
+    AbortIfWordNotEqual(array_size, SuspendedRegisterCount(),
+                        kInvalidRegisterFileInGenerator);
   }
 
   Variable var_index(this, MachineRepresentation::kWord32);
@@ -1057,7 +1065,7 @@ Node* InterpreterAssembler::ImportRegisterFile(Node* array) {
   Bind(&loop);
   {
     Node* index = var_index.value();
-    Node* condition = Int32LessThan(index, RegisterCount());
+    Node* condition = Int32LessThan(index, SuspendedRegisterCount());
     GotoUnless(condition, &done_loop);
 
     Node* value = LoadFixedArrayElement(array, index);
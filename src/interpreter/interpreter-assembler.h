@@ -56,6 +56,10 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Number of registers.
   compiler::Node* RegisterCount();
 
+  // Number of registers that have to be saved and restored across a suspend,
+  // as recorded on the bytecode array.
+  compiler::Node* SuspendedRegisterCount();
+
   // Backup/restore register file to/from a fixed array of the correct length.
   compiler::Node* ExportRegisterFile(compiler::Node* array);
   compiler::Node* ImportRegisterFile(compiler::Node* array);
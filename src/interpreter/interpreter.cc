@@ -11,6 +11,7 @@
 #include "src/code-factory.h"
 #include "src/compiler.h"
 #include "src/factory.h"
+#include "src/ic/handler-configuration.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
@@ -622,10 +623,68 @@ Node* Interpreter::BuildLoadNamedProperty(Callable ic,
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
   Node* context = __ GetContext();
-  return __ CallStub(
-      ic.descriptor(), code_target, context, Arg(Descriptor::kReceiver, object),
-      Arg(Descriptor::kName, name), Arg(Descriptor::kSlot, smi_slot),
-      Arg(Descriptor::kVector, type_feedback_vector));
+
+  Variable var_result(assembler, MachineRepresentation::kTagged);
+  Label call_ic(assembler, Label::kDeferred), done(assembler);
+
+  // Fast path for monomorphic feedback with a Smi handler encoding a tagged
+  // field load, which covers the majority of named property loads. Anything
+  // else (polymorphic or megamorphic feedback, double fields, handlers that
+  // are code objects) is left to the LoadIC stub.
+  __ GotoIf(__ WordIsSmi(object), &call_ic);
+  Node* receiver_map = __ LoadMap(object);
+  int32_t header_size = FixedArray::kHeaderSize - kHeapObjectTag;
+  Node* offset = __ ElementOffsetFromIndex(smi_slot, FAST_HOLEY_ELEMENTS,
+                                           CodeStubAssembler::SMI_PARAMETERS,
+                                           header_size);
+  Node* feedback =
+      __ Load(MachineType::AnyTagged(), type_feedback_vector, offset);
+  // It is safe to look at WeakCell::kValueOffset whatever the slot holds,
+  // see CodeStubAssembler::TryMonomorphicCase.
+  __ GotoUnless(__ WordEqual(receiver_map, __ LoadWeakCellValue(feedback)),
+                &call_ic);
+  Node* handler =
+      __ Load(MachineType::AnyTagged(), type_feedback_vector,
+              __ IntPtrAdd(offset, __ IntPtrConstant(kPointerSize)));
+  __ GotoUnless(__ WordIsSmi(handler), &call_ic);
+
+  // |handler| is a Smi, encoding what to do. See handler-configuration.h
+  // for the encoding format.
+  {
+    Label out_of_object(assembler);
+    Node* handler_word = __ SmiUntag(handler);
+    Node* inobject_bit = __ WordAnd(
+        handler_word, __ IntPtrConstant(FieldOffsetIsInobject::kMask));
+    Node* double_bit =
+        __ WordAnd(handler_word, __ IntPtrConstant(FieldOffsetIsDouble::kMask));
+    Node* field_offset =
+        __ WordSar(handler_word, __ IntPtrConstant(FieldOffsetOffset::kShift));
+    __ GotoUnless(__ WordEqual(double_bit, __ IntPtrConstant(0)), &call_ic);
+
+    __ GotoIf(__ WordEqual(inobject_bit, __ IntPtrConstant(0)),
+              &out_of_object);
+    var_result.Bind(__ LoadObjectField(object, field_offset));
+    __ Goto(&done);
+
+    __ Bind(&out_of_object);
+    Node* properties = __ LoadProperties(object);
+    var_result.Bind(__ LoadObjectField(properties, field_offset));
+    __ Goto(&done);
+  }
+
+  __ Bind(&call_ic);
+  {
+    Node* result = __ CallStub(ic.descriptor(), code_target, context,
+                               Arg(Descriptor::kReceiver, object),
+                               Arg(Descriptor::kName, name),
+                               Arg(Descriptor::kSlot, smi_slot),
+                               Arg(Descriptor::kVector, type_feedback_vector));
+    var_result.Bind(result);
+    __ Goto(&done);
+  }
+
+  __ Bind(&done);
+  return var_result.value();
 }
 
 // LdaNamedProperty <object> <name_index> <slot>
@@ -2104,6 +2163,11 @@ void Interpreter::DoCreateRestParameter(InterpreterAssembler* assembler) {
 // StackCheck
 //
 // Performs a stack guard check.
+// Note: the explicit limit compare below is deliberate. A guard-page probe
+// would save the compare, but interrupts are delivered by lowering the limit
+// (see StackGuard), which a memory-protection scheme could only emulate with
+// platform signal handling; the portable load-and-compare keeps stack checks
+// and interrupt delivery unified.
 void Interpreter::DoStackCheck(InterpreterAssembler* assembler) {
   Label ok(assembler), stack_check_interrupt(assembler, Label::kDeferred);
 
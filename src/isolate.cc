@@ -9,6 +9,7 @@
 #include <fstream>  // NOLINT(readability/streams)
 #include <sstream>
 
+#include "src/ast/ast-value-factory.h"
 #include "src/ast/context-slot-cache.h"
 #include "src/base/accounting-allocator.h"
 #include "src/base/hashmap.h"
@@ -21,6 +22,7 @@
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
 #include "src/compilation-statistics.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/crankshaft/hydrogen.h"
 #include "src/debug/debug.h"
@@ -1084,8 +1086,22 @@ Object* Isolate::Throw(Object* exception, MessageLocation* location) {
     debug()->OnThrow(exception_handle);
   }
 
+  // The message object is only consumed once the exception reaches the top
+  // level or an external handler; a JavaScript catch block drops it on
+  // unwinding. When the handler search predicts a genuine catch block, skip
+  // materializing the message with its location computation and stack walk,
+  // so that control-flow style uses of try/catch do not pay for it. Handlers
+  // that rethrow, including finally blocks, are predicted UNCAUGHT and still
+  // get a message here; an explicit rethrow from a catch block creates a
+  // fresh message at the rethrow site.
+  bool predicted_caught_by_javascript =
+      FLAG_lazy_exception_messages && requires_message &&
+      !rethrowing_message && !bootstrapper()->IsActive() &&
+      PredictExceptionCatcher() == CAUGHT_BY_JAVASCRIPT;
+
   // Generate the message if required.
-  if (requires_message && !rethrowing_message) {
+  if (requires_message && !rethrowing_message &&
+      !predicted_caught_by_javascript) {
     MessageLocation computed_location;
     // If no location was specified we try to use a computed one instead.
     if (location == NULL && ComputeLocation(&computed_location)) {
@@ -1319,6 +1335,7 @@ Isolate::CatchType Isolate::PredictExceptionCatcher() {
       JavaScriptFrame* js_frame = static_cast<JavaScriptFrame*>(frame);
       HandlerTable::CatchPrediction prediction = PredictException(js_frame);
       if (prediction == HandlerTable::DESUGARING) return CAUGHT_BY_DESUGARING;
+      if (prediction == HandlerTable::PROMISE) return CAUGHT_BY_PROMISE;
       if (prediction != HandlerTable::UNCAUGHT) return CAUGHT_BY_JAVASCRIPT;
     }
 
@@ -1930,8 +1947,12 @@ Isolate::Isolate(bool enable_serializer)
       keyed_lookup_cache_(NULL),
       context_slot_cache_(NULL),
       descriptor_lookup_cache_(NULL),
+      prototype_lookup_cache_(NULL),
+      source_position_lookup_cache_(NULL),
+      value_serializer_buffer_hint_(0),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
+      ast_string_constants_(NULL),
       allocator_(FLAG_trace_gc_object_stats
                      ? new VerboseAccountingAllocator(&heap_, 256 * KB)
                      : new base::AccountingAllocator()),
@@ -1940,6 +1961,7 @@ Isolate::Isolate(bool enable_serializer)
       inner_pointer_to_code_cache_(NULL),
       global_handles_(NULL),
       eternal_handles_(NULL),
+      persistent_handle_arena_list_(NULL),
       thread_manager_(NULL),
       has_installed_extensions_(false),
       regexp_stack_(NULL),
@@ -1960,10 +1982,13 @@ Isolate::Isolate(bool enable_serializer)
       function_entry_hook_(NULL),
       deferred_handles_head_(NULL),
       optimizing_compile_dispatcher_(NULL),
+      compiler_dispatcher_(NULL),
       stress_deopt_count_(0),
       virtual_handler_register_(NULL),
       virtual_slot_register_(NULL),
       next_optimization_id_(0),
+      json_stringify_part_length_hint_(0),
+      inlining_budget_(0),
       js_calls_from_api_counter_(0),
 #if TRACE_MAPS
       next_unique_sfi_id_(0),
@@ -2069,6 +2094,9 @@ void Isolate::Deinit() {
     optimizing_compile_dispatcher_ = NULL;
   }
 
+  delete compiler_dispatcher_;
+  compiler_dispatcher_ = NULL;
+
   if (heap_.mark_compact_collector()->sweeping_in_progress()) {
     heap_.mark_compact_collector()->EnsureSweepingCompleted();
   }
@@ -2145,6 +2173,9 @@ Isolate::~Isolate() {
   delete unicode_cache_;
   unicode_cache_ = NULL;
 
+  delete ast_string_constants_;
+  ast_string_constants_ = NULL;
+
   delete date_cache_;
   date_cache_ = NULL;
 
@@ -2156,6 +2187,10 @@ Isolate::~Isolate() {
 
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = NULL;
+  delete prototype_lookup_cache_;
+  prototype_lookup_cache_ = NULL;
+  delete source_position_lookup_cache_;
+  source_position_lookup_cache_ = NULL;
   delete context_slot_cache_;
   context_slot_cache_ = NULL;
   delete keyed_lookup_cache_;
@@ -2310,6 +2345,8 @@ bool Isolate::Init(Deserializer* des) {
   keyed_lookup_cache_ = new KeyedLookupCache();
   context_slot_cache_ = new ContextSlotCache();
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  prototype_lookup_cache_ = new PrototypeLookupCache();
+  source_position_lookup_cache_ = new SourcePositionLookupCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
@@ -2388,6 +2425,8 @@ bool Isolate::Init(Deserializer* des) {
     optimizing_compile_dispatcher_ = new OptimizingCompileDispatcher(this);
   }
 
+  compiler_dispatcher_ = new CompilerDispatcher(this, FLAG_stack_size);
+
   // Initialize runtime profiler before deserialization, because collections may
   // occur, clearing/updating ICs.
   runtime_profiler_ = new RuntimeProfiler(this);
@@ -2560,7 +2599,8 @@ void Isolate::UnlinkDeferredHandles(DeferredHandles* deferred) {
 
 void Isolate::DumpAndResetCompilationStats() {
   if (turbo_statistics() != nullptr) {
-    DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp);
+    DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+           FLAG_turbo_stats_json_file != nullptr);
 
     OFStream os(stdout);
     if (FLAG_turbo_stats) {
@@ -2571,6 +2611,17 @@ void Isolate::DumpAndResetCompilationStats() {
       AsPrintableStatistics ps = {*turbo_statistics(), true};
       os << ps << std::endl;
     }
+    if (FLAG_turbo_stats_json_file != nullptr) {
+      std::ofstream json_file(FLAG_turbo_stats_json_file,
+                              std::ios_base::trunc);
+      if (json_file.is_open()) {
+        AsJSONStatistics js = {*turbo_statistics()};
+        json_file << js;
+      } else {
+        PrintF(stderr, "Could not write TurboFan statistics to %s\n",
+               FLAG_turbo_stats_json_file);
+      }
+    }
   }
   if (hstatistics() != nullptr) hstatistics()->Print();
   delete turbo_statistics_;
@@ -2792,6 +2843,15 @@ CallInterfaceDescriptorData* Isolate::call_descriptor_data(int index) {
 }
 
 
+const AstStringConstants* Isolate::ast_string_constants() {
+  DCHECK(ThreadId::Current().Equals(thread_id()));
+  if (ast_string_constants_ == NULL) {
+    ast_string_constants_ = new AstStringConstants(this, heap()->HashSeed());
+  }
+  return ast_string_constants_;
+}
+
+
 base::RandomNumberGenerator* Isolate::random_number_generator() {
   if (random_number_generator_ == NULL) {
     if (FLAG_random_seed != 0) {
@@ -2927,15 +2987,24 @@ void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
   Handle<FixedArray> queue(heap()->microtask_queue(), this);
   int num_tasks = pending_microtask_count();
   DCHECK(num_tasks <= queue->length());
-  if (num_tasks == 0) {
-    queue = factory()->NewFixedArray(8);
-    heap()->set_microtask_queue(*queue);
-  } else if (num_tasks == queue->length()) {
-    queue = factory()->CopyFixedArrayAndGrow(queue, num_tasks);
+  if (num_tasks == queue->length()) {
+    // Grow the ring buffer, moving the pending tasks back to the front of
+    // the new backing store. The backing store is retained between
+    // checkpoints, so this only happens when the high watermark of pending
+    // microtasks grows.
+    Handle<FixedArray> new_queue = factory()->NewFixedArray(
+        Max(kMinimumMicrotaskCapacity, 2 * num_tasks));
+    for (int i = 0; i < num_tasks; i++) {
+      new_queue->set(
+          i, queue->get((microtask_queue_start() + i) % queue->length()));
+    }
+    set_microtask_queue_start(0);
+    queue = new_queue;
     heap()->set_microtask_queue(*queue);
   }
-  DCHECK(queue->get(num_tasks)->IsUndefined(this));
-  queue->set(num_tasks, *microtask);
+  int slot = (microtask_queue_start() + num_tasks) % queue->length();
+  DCHECK(queue->get(slot)->IsUndefined(this));
+  queue->set(slot, *microtask);
   set_pending_microtask_count(num_tasks + 1);
 }
 
@@ -2954,43 +3023,51 @@ void Isolate::RunMicrotasks() {
 void Isolate::RunMicrotasksInternal() {
   while (pending_microtask_count() > 0) {
     HandleScope scope(this);
-    int num_tasks = pending_microtask_count();
+    // Consume one task at a time from the front of the ring buffer, since
+    // running a microtask may enqueue further microtasks (and thereby grow
+    // or even replace the backing store).
     Handle<FixedArray> queue(heap()->microtask_queue(), this);
-    DCHECK(num_tasks <= queue->length());
-    set_pending_microtask_count(0);
-    heap()->set_microtask_queue(heap()->empty_fixed_array());
-
-    Isolate* isolate = this;
-    FOR_WITH_HANDLE_SCOPE(isolate, int, i = 0, i, i < num_tasks, i++, {
-      Handle<Object> microtask(queue->get(i), this);
-      if (microtask->IsJSFunction()) {
-        Handle<JSFunction> microtask_function =
-            Handle<JSFunction>::cast(microtask);
-        SaveContext save(this);
-        set_context(microtask_function->context()->native_context());
-        handle_scope_implementer_->EnterMicrotaskContext(
-            handle(microtask_function->context(), this));
-        MaybeHandle<Object> maybe_exception;
-        MaybeHandle<Object> result = Execution::TryCall(
-            this, microtask_function, factory()->undefined_value(), 0, NULL,
-            &maybe_exception);
-        handle_scope_implementer_->LeaveMicrotaskContext();
-        // If execution is terminating, just bail out.
-        if (result.is_null() && maybe_exception.is_null()) {
-          // Clear out any remaining callbacks in the queue.
-          heap()->set_microtask_queue(heap()->empty_fixed_array());
-          set_pending_microtask_count(0);
-          return;
-        }
-      } else {
-        Handle<CallHandlerInfo> callback_info =
-            Handle<CallHandlerInfo>::cast(microtask);
-        v8::MicrotaskCallback callback =
-            v8::ToCData<v8::MicrotaskCallback>(callback_info->callback());
-        void* data = v8::ToCData<void*>(callback_info->data());
-        callback(data);
+    int start = microtask_queue_start();
+    Handle<Object> microtask(queue->get(start), this);
+    queue->set_undefined(start);
+    set_microtask_queue_start((start + 1) % queue->length());
+    set_pending_microtask_count(pending_microtask_count() - 1);
+
+    if (microtask->IsJSFunction()) {
+      Handle<JSFunction> microtask_function =
+          Handle<JSFunction>::cast(microtask);
+      SaveContext save(this);
+      set_context(microtask_function->context()->native_context());
+      handle_scope_implementer_->EnterMicrotaskContext(
+          handle(microtask_function->context(), this));
+      MaybeHandle<Object> maybe_exception;
+      MaybeHandle<Object> result = Execution::TryCall(
+          this, microtask_function, factory()->undefined_value(), 0, NULL,
+          &maybe_exception);
+      handle_scope_implementer_->LeaveMicrotaskContext();
+      // If execution is terminating, just bail out.
+      if (result.is_null() && maybe_exception.is_null()) {
+        // Clear out any remaining callbacks in the queue.
+        heap()->set_microtask_queue(heap()->empty_fixed_array());
+        set_microtask_queue_start(0);
+        set_pending_microtask_count(0);
+        return;
       }
-    });
+    } else {
+      Handle<CallHandlerInfo> callback_info =
+          Handle<CallHandlerInfo>::cast(microtask);
+      v8::MicrotaskCallback callback =
+          v8::ToCData<v8::MicrotaskCallback>(callback_info->callback());
+      void* data = v8::ToCData<void*>(callback_info->data());
+      callback(data);
+    }
+  }
+
+  // Don't let an occasional deep cascade of microtasks pin a large backing
+  // store beyond the checkpoint that drained it.
+  if (heap()->microtask_queue()->length() > kMaximumRetainedMicrotaskCapacity) {
+    heap()->set_microtask_queue(heap()->empty_fixed_array());
+    set_microtask_queue_start(0);
   }
 }
 
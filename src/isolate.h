@@ -35,6 +35,7 @@ class RandomNumberGenerator;
 
 namespace internal {
 
+class AstStringConstants;
 class BasicBlockProfiler;
 class Bootstrapper;
 class CancelableTaskManager;
@@ -61,11 +62,13 @@ class HandleScopeImplementer;
 class HeapProfiler;
 class HStatistics;
 class HTracer;
+class CompilerDispatcher;
 class InlineRuntimeFunctionsTable;
 class InnerPointerToCodeCache;
 class Logger;
 class MaterializedObjectStore;
 class OptimizingCompileDispatcher;
+class PersistentHandleArena;
 class RegExpStack;
 class RuntimeProfiler;
 class SaveContext;
@@ -398,6 +401,7 @@ class ThreadLocalTop BASE_EMBEDDED {
   V(int, bad_char_shift_table, kUC16AlphabetSize)                              \
   V(int, good_suffix_shift_table, (kBMMaxShift + 1))                           \
   V(int, suffix_table, (kBMMaxShift + 1))                                      \
+  V(uc16, string_search_cached_pattern, kBMMaxShift)                           \
   V(uint32_t, private_random_seed, 2)                                          \
   ISOLATE_INIT_DEBUG_ARRAY_LIST(V)
 
@@ -420,6 +424,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(base::HashMap*, external_reference_map, nullptr)                          \
   V(base::HashMap*, root_index_map, nullptr)                                  \
   V(int, pending_microtask_count, 0)                                          \
+  V(int, microtask_queue_start, 0)                                            \
   V(HStatistics*, hstatistics, nullptr)                                       \
   V(CompilationStatistics*, turbo_statistics, nullptr)                        \
   V(HTracer*, htracer, nullptr)                                               \
@@ -430,6 +435,10 @@ typedef List<HeapObject*> DebugObjectCache;
   V(const v8::StartupData*, snapshot_blob, nullptr)                           \
   V(int, code_and_metadata_size, 0)                                           \
   V(int, bytecode_and_metadata_size, 0)                                       \
+  /* Pattern the StringSearch shift tables were last populated for. */        \
+  V(int, string_search_cached_pattern_length, -1)                             \
+  V(int, string_search_cached_pattern_char_size, 0)                           \
+  V(bool, string_search_good_suffix_table_valid, false)                       \
   /* true if being profiled. Causes collection of extra compile info. */      \
   V(bool, is_profiling, false)                                                \
   /* true if a trace is being formatted through Error.prepareStackTrace. */   \
@@ -750,7 +759,8 @@ class Isolate {
     NOT_CAUGHT,
     CAUGHT_BY_JAVASCRIPT,
     CAUGHT_BY_EXTERNAL,
-    CAUGHT_BY_DESUGARING
+    CAUGHT_BY_DESUGARING,
+    CAUGHT_BY_PROMISE
   };
   CatchType PredictExceptionCatcher();
 
@@ -882,6 +892,25 @@ class Isolate {
     return descriptor_lookup_cache_;
   }
 
+  PrototypeLookupCache* prototype_lookup_cache() {
+    return prototype_lookup_cache_;
+  }
+
+  SourcePositionLookupCache* source_position_lookup_cache() {
+    return source_position_lookup_cache_;
+  }
+
+  // Hint for the initial capacity of ValueSerializer's output buffer, set
+  // from the size of the last released buffer. Messaging workloads tend to
+  // produce similarly sized messages, so serialization can allocate its
+  // buffer in one step instead of repeatedly growing and copying it.
+  size_t value_serializer_buffer_hint() const {
+    return value_serializer_buffer_hint_;
+  }
+  void set_value_serializer_buffer_hint(size_t size) {
+    value_serializer_buffer_hint_ = size;
+  }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -895,6 +924,10 @@ class Isolate {
     return unicode_cache_;
   }
 
+  // The shared table of common parser-internal strings, created on first
+  // use. Must be called on the main thread.
+  const AstStringConstants* ast_string_constants();
+
   InnerPointerToCodeCache* inner_pointer_to_code_cache() {
     return inner_pointer_to_code_cache_;
   }
@@ -903,6 +936,15 @@ class Isolate {
 
   EternalHandles* eternal_handles() { return eternal_handles_; }
 
+  // Head of the list of live persistent handle arenas; their handles are
+  // strong roots.
+  PersistentHandleArena* persistent_handle_arena_list() {
+    return persistent_handle_arena_list_;
+  }
+  void set_persistent_handle_arena_list(PersistentHandleArena* arena) {
+    persistent_handle_arena_list_ = arena;
+  }
+
   ThreadManager* thread_manager() { return thread_manager_; }
 
   unibrow::Mapping<unibrow::Ecma262UnCanonicalize>* jsregexp_uncanonicalize() {
@@ -1048,6 +1090,8 @@ class Isolate {
     return optimizing_compile_dispatcher_;
   }
 
+  CompilerDispatcher* compiler_dispatcher() { return compiler_dispatcher_; }
+
   int id() const { return static_cast<int>(id_); }
 
   HStatistics* GetHStatistics();
@@ -1083,6 +1127,20 @@ class Isolate {
     return id;
   }
 
+  // Remembers how large the string builder of the last JSON.stringify call
+  // grew, so that the next call can size its initial part accordingly.
+  int json_stringify_part_length_hint() const {
+    return json_stringify_part_length_hint_;
+  }
+  void set_json_stringify_part_length_hint(int hint) {
+    json_stringify_part_length_hint_ = hint;
+  }
+
+  // Embedder-provided cumulative inlining budget (in AST nodes) for the
+  // optimizing compiler; 0 means use the default from the command line.
+  int inlining_budget() const { return inlining_budget_; }
+  void set_inlining_budget(int budget) { inlining_budget_ = budget; }
+
   void IncrementJsCallsFromApiCounter() { ++js_calls_from_api_counter_; }
 
   unsigned int js_calls_from_api_counter() {
@@ -1276,6 +1334,13 @@ class Isolate {
   // the frame.
   void RemoveMaterializedObjectsOnUnwind(StackFrame* frame);
 
+  // The microtask queue is a ring buffer over a FixedArray that is kept
+  // alive between checkpoints; it grows to the high watermark of pending
+  // microtasks and is only dropped again when it exceeds the retained
+  // capacity below after a full drain.
+  static const int kMinimumMicrotaskCapacity = 8;
+  static const int kMaximumRetainedMicrotaskCapacity = 1024;
+
   void RunMicrotasksInternal();
 
   const char* RAILModeName(RAILMode rail_mode) const {
@@ -1323,15 +1388,20 @@ class Isolate {
   KeyedLookupCache* keyed_lookup_cache_;
   ContextSlotCache* context_slot_cache_;
   DescriptorLookupCache* descriptor_lookup_cache_;
+  PrototypeLookupCache* prototype_lookup_cache_;
+  SourcePositionLookupCache* source_position_lookup_cache_;
+  size_t value_serializer_buffer_hint_;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
+  AstStringConstants* ast_string_constants_;
   base::AccountingAllocator* allocator_;
   Zone* runtime_zone_;
   Zone* interface_descriptor_zone_;
   InnerPointerToCodeCache* inner_pointer_to_code_cache_;
   GlobalHandles* global_handles_;
   EternalHandles* eternal_handles_;
+  PersistentHandleArena* persistent_handle_arena_list_;
   ThreadManager* thread_manager_;
   RuntimeState runtime_state_;
   Builtins builtins_;
@@ -1405,6 +1475,7 @@ class Isolate {
 
   DeferredHandles* deferred_handles_head_;
   OptimizingCompileDispatcher* optimizing_compile_dispatcher_;
+  CompilerDispatcher* compiler_dispatcher_;
 
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_;
@@ -1414,6 +1485,10 @@ class Isolate {
 
   int next_optimization_id_;
 
+  int json_stringify_part_length_hint_;
+
+  int inlining_budget_;
+
   // Counts javascript calls from the API. Wraps around on overflow.
   unsigned int js_calls_from_api_counter_;
 
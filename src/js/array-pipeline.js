@@ -0,0 +1,161 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+(function(global, utils) {
+
+"use strict";
+
+%CheckIsBootstrapping();
+
+// -------------------------------------------------------------------
+// Imports
+
+var GlobalArray = global.Array;
+var InternalArray = utils.InternalArray;
+
+// -------------------------------------------------------------------
+// Lazy array pipelines.
+//
+// A pipeline records a chain of map/filter stages over a source array
+// without materializing intermediate arrays; the single loop over the
+// source runs when a terminal operation (toArray, forEach, reduce) is
+// called. Unlike chained Array.prototype.map/filter, stage callbacks
+// are interleaved per element rather than run array-at-a-time, and only
+// the terminal operation allocates.
+
+var kMapStage = 0;
+var kFilterStage = 1;
+
+function Pipeline(array, kinds, callbacks, receivers) {
+  this.array_ = array;
+  this.kinds_ = kinds;
+  this.callbacks_ = callbacks;
+  this.receivers_ = receivers;
+}
+
+function PipelineExtend(pipeline, kind, f, receiver) {
+  if (!IS_CALLABLE(f)) throw %make_type_error(kCalledNonCallable, f);
+  var stage_count = pipeline.kinds_.length;
+  var kinds = new InternalArray(stage_count + 1);
+  var callbacks = new InternalArray(stage_count + 1);
+  var receivers = new InternalArray(stage_count + 1);
+  for (var i = 0; i < stage_count; i++) {
+    kinds[i] = pipeline.kinds_[i];
+    callbacks[i] = pipeline.callbacks_[i];
+    receivers[i] = pipeline.receivers_[i];
+  }
+  kinds[stage_count] = kind;
+  callbacks[stage_count] = f;
+  receivers[stage_count] = receiver;
+  return new Pipeline(pipeline.array_, kinds, callbacks, receivers);
+}
+
+// Holds the transformed element after a successful PipelineApplyStages
+// call; a JS function cannot return both the "kept" bit and the value.
+var pipeline_value;
+
+function PipelineApplyStages(pipeline, element, i, array) {
+  var kinds = pipeline.kinds_;
+  var callbacks = pipeline.callbacks_;
+  var receivers = pipeline.receivers_;
+  for (var s = 0; s < kinds.length; s++) {
+    if (kinds[s] === kMapStage) {
+      element = %_Call(callbacks[s], receivers[s], element, i, array);
+    } else if (!%_Call(callbacks[s], receivers[s], element, i, array)) {
+      return false;
+    }
+  }
+  pipeline_value = element;
+  return true;
+}
+
+function PipelineMap(f, receiver) {
+  return PipelineExtend(this, kMapStage, f, receiver);
+}
+
+function PipelineFilter(f, receiver) {
+  return PipelineExtend(this, kFilterStage, f, receiver);
+}
+
+function PipelineToArray() {
+  var array = this.array_;
+  var length = TO_LENGTH(array.length);
+  var result = new GlobalArray();
+  var result_length = 0;
+  for (var i = 0; i < length; i++) {
+    if (i in array) {
+      if (PipelineApplyStages(this, array[i], i, array)) {
+        %CreateDataProperty(result, result_length, pipeline_value);
+        result_length++;
+      }
+    }
+  }
+  return result;
+}
+
+function PipelineForEach(f, receiver) {
+  if (!IS_CALLABLE(f)) throw %make_type_error(kCalledNonCallable, f);
+  var array = this.array_;
+  var length = TO_LENGTH(array.length);
+  for (var i = 0; i < length; i++) {
+    if (i in array) {
+      if (PipelineApplyStages(this, array[i], i, array)) {
+        %_Call(f, receiver, pipeline_value, i, array);
+      }
+    }
+  }
+}
+
+function PipelineReduce(callback, current) {
+  if (!IS_CALLABLE(callback)) {
+    throw %make_type_error(kCalledNonCallable, callback);
+  }
+
+  var array = this.array_;
+  var length = TO_LENGTH(array.length);
+  var i = 0;
+  find_initial: if (arguments.length < 2) {
+    for (; i < length; i++) {
+      if (i in array && PipelineApplyStages(this, array[i], i, array)) {
+        current = pipeline_value;
+        i++;
+        break find_initial;
+      }
+    }
+    throw %make_type_error(kReduceNoInitial);
+  }
+
+  for (; i < length; i++) {
+    if (i in array) {
+      if (PipelineApplyStages(this, array[i], i, array)) {
+        current = %_Call(callback, UNDEFINED, current, pipeline_value, i,
+                         array);
+      }
+    }
+  }
+  return current;
+}
+%FunctionSetLength(PipelineReduce, 1);
+
+function ArrayPipeline() {
+  CHECK_OBJECT_COERCIBLE(this, "Array.prototype.pipeline");
+  return new Pipeline(TO_OBJECT(this), new InternalArray(),
+                      new InternalArray(), new InternalArray());
+}
+
+// -------------------------------------------------------------------
+
+utils.InstallFunctions(Pipeline.prototype, DONT_ENUM, [
+  "map", PipelineMap,
+  "filter", PipelineFilter,
+  "toArray", PipelineToArray,
+  "forEach", PipelineForEach,
+  "reduce", PipelineReduce
+]);
+
+utils.InstallFunctions(GlobalArray.prototype, DONT_ENUM, [
+  "pipeline", ArrayPipeline
+]);
+
+});
@@ -711,7 +711,8 @@ function InnerArraySort(array, length, comparefn) {
   // In-place QuickSort algorithm.
   // For short (length <= 22) arrays, insertion sort is used for efficiency.
 
-  if (!IS_CALLABLE(comparefn)) {
+  var use_default_comparefn = !IS_CALLABLE(comparefn);
+  if (use_default_comparefn) {
     comparefn = function (x, y) {
       if (x === y) return 0;
       if (%_IsSmi(x) && %_IsSmi(y)) {
@@ -982,7 +983,12 @@ function InnerArraySort(array, length, comparefn) {
     num_non_undefined = SafeRemoveArrayHoles(array);
   }
 
-  QuickSort(array, 0, num_non_undefined);
+  // With the default comparator, smi-only arrays can be sorted entirely in
+  // C++; %SortSmiElements returns false if the array is not eligible.
+  if (!use_default_comparefn || !%_IsSmi(num_non_undefined) ||
+      !%SortSmiElements(array, num_non_undefined)) {
+    QuickSort(array, 0, num_non_undefined);
+  }
 
   if (!is_array && (num_non_undefined + 1 < max_prototype_element)) {
     // For compatibility with JSC, we shadow any elements in the prototype
@@ -348,6 +348,42 @@ function RegExpSubclassTest(string) {
                         'RegExp.prototype.test', this);
   }
   string = TO_STRING(string);
+
+  // An unmodified JSRegExp with the original exec method only needs to know
+  // whether there is a match; constructing the result array and the capture
+  // substrings can be skipped entirely.  The match registers stay in the
+  // RegExpLastMatchInfo array, which also keeps the legacy RegExp static
+  // properties working.
+  if (IS_REGEXP(this) && this.exec === RegExpSubclassExecJS) {
+    var lastIndex = this.lastIndex;
+
+    // Conversion is required by the ES2015 specification (RegExpBuiltinExec
+    // algorithm, step 4) even if the value is discarded for non-global
+    // RegExps.
+    var i = TO_LENGTH(lastIndex);
+
+    if (REGEXP_GLOBAL(this) || REGEXP_STICKY(this)) {
+      if (i > string.length) {
+        this.lastIndex = 0;
+        return false;
+      }
+      // matchIndices is either null or the RegExpLastMatchInfo array.
+      var matchIndices = %_RegExpExec(this, string, i, RegExpLastMatchInfo);
+      if (IS_NULL(matchIndices)) {
+        this.lastIndex = 0;
+        return false;
+      }
+      this.lastIndex = RegExpLastMatchInfo[CAPTURE1];
+      return true;
+    }
+    var matchIndices = %_RegExpExec(this, string, 0, RegExpLastMatchInfo);
+    if (IS_NULL(matchIndices)) {
+      this.lastIndex = 0;
+      return false;
+    }
+    return true;
+  }
+
   var match = RegExpSubclassExec(this, string);
   return !IS_NULL(match);
 }
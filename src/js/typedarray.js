@@ -21,9 +21,7 @@ var GlobalArrayBuffer = global.ArrayBuffer;
 var GlobalArrayBufferPrototype = GlobalArrayBuffer.prototype;
 var GlobalDataView = global.DataView;
 var GlobalObject = global.Object;
-var InnerArrayCopyWithin;
 var InnerArrayEvery;
-var InnerArrayFill;
 var InnerArrayFilter;
 var InnerArrayFind;
 var InnerArrayFindIndex;
@@ -35,7 +33,6 @@ var InnerArraySome;
 var InnerArraySort;
 var InnerArrayToLocaleString;
 var InternalArray = utils.InternalArray;
-var IsNaN;
 var MaxSimple;
 var MinSimple;
 var PackedArrayReverse;
@@ -71,9 +68,7 @@ utils.Import(function(from) {
   ArrayValues = from.ArrayValues;
   GetIterator = from.GetIterator;
   GetMethod = from.GetMethod;
-  InnerArrayCopyWithin = from.InnerArrayCopyWithin;
   InnerArrayEvery = from.InnerArrayEvery;
-  InnerArrayFill = from.InnerArrayFill;
   InnerArrayFilter = from.InnerArrayFilter;
   InnerArrayFind = from.InnerArrayFind;
   InnerArrayFindIndex = from.InnerArrayFindIndex;
@@ -84,7 +79,6 @@ utils.Import(function(from) {
   InnerArraySome = from.InnerArraySome;
   InnerArraySort = from.InnerArraySort;
   InnerArrayToLocaleString = from.InnerArrayToLocaleString;
-  IsNaN = from.IsNaN;
   MaxSimple = from.MaxSimple;
   MinSimple = from.MinSimple;
   PackedArrayReverse = from.PackedArrayReverse;
@@ -447,8 +441,19 @@ function TypedArrayCopyWithin(target, start, end) {
 
   var length = %_TypedArrayGetLength(this);
 
-  // TODO(littledan): Replace with a memcpy for better performance
-  return InnerArrayCopyWithin(target, start, end, this, length);
+  target = TO_INTEGER(target);
+  var to = target < 0 ? MaxSimple(length + target, 0)
+                      : MinSimple(target, length);
+  start = TO_INTEGER(start);
+  var from = start < 0 ? MaxSimple(length + start, 0)
+                       : MinSimple(start, length);
+  end = IS_UNDEFINED(end) ? length : TO_INTEGER(end);
+  var final = end < 0 ? MaxSimple(length + end, 0) : MinSimple(end, length);
+
+  var count = MinSimple(final - from, length - to);
+  // The elements are copied with a single memmove on the backing store.
+  if (count > 0) %TypedArrayCopyWithin(this, to, from, count);
+  return this;
 }
 %FunctionSetLength(TypedArrayCopyWithin, 2);
 
@@ -481,7 +486,16 @@ function TypedArrayFill(value, start, end) {
 
   var length = %_TypedArrayGetLength(this);
 
-  return InnerArrayFill(value, start, end, this, length);
+  value = TO_NUMBER(value);
+  var i = IS_UNDEFINED(start) ? 0 : TO_INTEGER(start);
+  var final = IS_UNDEFINED(end) ? length : TO_INTEGER(end);
+
+  i = i < 0 ? MaxSimple(length + i, 0) : MinSimple(i, length);
+  final = final < 0 ? MaxSimple(length + final, 0) : MinSimple(final, length);
+
+  // The elements are stored with a single typed fill of the backing store.
+  if (final > i) %TypedArrayFill(this, value, i, final);
+  return this;
 }
 %FunctionSetLength(TypedArrayFill, 1);
 
@@ -536,32 +550,17 @@ function TypedArrayReverse() {
 }
 
 
-function TypedArrayComparefn(x, y) {
-  if (x === 0 && x === y) {
-    x = 1 / x;
-    y = 1 / y;
-  }
-  if (x < y) {
-    return -1;
-  } else if (x > y) {
-    return 1;
-  } else if (IsNaN(x) && IsNaN(y)) {
-    return IsNaN(y) ? 0 : 1;
-  } else if (IsNaN(x)) {
-    return 1;
-  }
-  return 0;
-}
-
-
 // ES6 draft 05-18-15, section 22.2.3.25
 function TypedArraySort(comparefn) {
   if (!IS_TYPEDARRAY(this)) throw %make_type_error(kNotTypedArray);
 
   var length = %_TypedArrayGetLength(this);
 
+  // Without a comparison function the elements are sorted by their numeric
+  // value directly on the backing store, with -0 before +0 and NaNs at the
+  // end.
   if (IS_UNDEFINED(comparefn)) {
-    comparefn = TypedArrayComparefn;
+    return %TypedArraySortFast(this);
   }
 
   return InnerArraySort(this, length, comparefn);
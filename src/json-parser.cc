@@ -776,6 +776,31 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Bulk-scan for the next structural character: the closing quote, an
+    // escape, or a control character. Words consisting of plain characters
+    // are skipped in one step; the per-character loop below handles the tail
+    // and the found character. No allocation can happen while the raw
+    // character pointer is held.
+    DisallowHeapAllocation no_gc;
+    static const uintptr_t kOnes =
+        kUintptrAllBitsSet / 0xFF;          // 0x0101...01
+    static const uintptr_t kHighs = kOnes << 7;  // 0x8080...80
+    const uint8_t* chars = seq_source_->GetChars();
+    int position = position_;
+    while (position + static_cast<int>(sizeof(uintptr_t)) <= source_length_) {
+      uintptr_t w = ReadUnalignedValue<uintptr_t>(chars + position);
+      uintptr_t quotes = w ^ (kOnes * '"');
+      uintptr_t escapes = w ^ (kOnes * '\\');
+      uintptr_t found = ((quotes - kOnes) & ~quotes & kHighs) |
+                        ((escapes - kOnes) & ~escapes & kHighs) |
+                        ((w - (kOnes * 0x20)) & ~w & kHighs);
+      if (found != 0) break;
+      position += sizeof(uintptr_t);
+    }
+    position_ = position;
+    c0_ = position_ < source_length_ ? chars[position_] : kEndOfString;
+  }
   // Fast case for Latin1 only without escape characters.
   do {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
@@ -808,5 +833,30 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
 template class JsonParser<true>;
 template class JsonParser<false>;
 
+JsonChunkedAssembler::JsonChunkedAssembler(Isolate* isolate)
+    : isolate_(isolate) {}
+
+bool JsonChunkedAssembler::Append(const uint8_t* chunk, size_t length) {
+  if (buffer_.size() + length > static_cast<size_t>(String::kMaxLength)) {
+    return false;
+  }
+  buffer_.insert(buffer_.end(), chunk, chunk + length);
+  return true;
+}
+
+MaybeHandle<Object> JsonChunkedAssembler::Parse() {
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate_, source,
+      isolate_->factory()->NewStringFromOneByte(Vector<const uint8_t>(
+          buffer_.data(), static_cast<int>(buffer_.size()))),
+      Object);
+  // Drop the off-heap copy before parsing to keep the peak memory usage at
+  // one copy of the payload plus the object graph.
+  std::vector<uint8_t>().swap(buffer_);
+  return JsonParser<true>::Parse(isolate_, source,
+                                 isolate_->factory()->undefined_value());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_JSON_PARSER_H_
 #define V8_JSON_PARSER_H_
 
+#include <vector>
+
 #include "src/factory.h"
 #include "src/objects.h"
 
@@ -32,6 +34,29 @@ class JsonParseInternalizer BASE_EMBEDDED {
   Handle<JSReceiver> reviver_;
 };
 
+// Accumulates one-byte JSON text as it arrives from the embedder, e.g. off
+// the network, and parses it in one go. This saves the embedder from
+// materializing the payload as a V8 string itself, which would typically
+// build a cons string chunk by chunk and then pay for an extra copy when the
+// parser flattens it.
+class JsonChunkedAssembler {
+ public:
+  explicit JsonChunkedAssembler(Isolate* isolate);
+
+  // Appends a chunk of one-byte JSON text. Returns false if the assembled
+  // source would exceed the maximal string length.
+  bool Append(const uint8_t* chunk, size_t length);
+
+  // Parses the assembled source. May only be called once.
+  MUST_USE_RESULT MaybeHandle<Object> Parse();
+
+ private:
+  Isolate* isolate_;
+  std::vector<uint8_t> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonChunkedAssembler);
+};
+
 // A simple json parser.
 template <bool seq_one_byte>
 class JsonParser BASE_EMBEDDED {
@@ -82,7 +82,10 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\374\0      \375\0      \376\0      \377\0      ";
 
 JsonStringifier::JsonStringifier(Isolate* isolate)
-    : isolate_(isolate), builder_(isolate), gap_(nullptr), indent_(0) {
+    : isolate_(isolate),
+      builder_(isolate, isolate->json_stringify_part_length_hint()),
+      gap_(nullptr),
+      indent_(0) {
   tojson_string_ = factory()->toJSON_string();
   stack_ = factory()->NewJSArray(8);
 }
@@ -96,7 +99,11 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   }
   Result result = SerializeObject(object);
   if (result == UNCHANGED) return factory()->undefined_value();
-  if (result == SUCCESS) return builder_.Finish();
+  if (result == SUCCESS) {
+    // Seed the next stringify with the part length this one ramped up to.
+    isolate_->set_json_stringify_part_length_hint(builder_.part_length());
+    return builder_.Finish();
+  }
   DCHECK(result == EXCEPTION);
   return MaybeHandle<Object>();
 }
@@ -368,11 +375,36 @@ JsonStringifier::Result JsonStringifier::SerializeJSValue(
   return SUCCESS;
 }
 
+namespace {
+
+// Appends the NUL-terminated ASCII digits produced by IntToCString or
+// DoubleToCString. When the current part has enough room the characters are
+// written into it in one batch, bypassing the per-character bounds checks of
+// IncrementalStringBuilder::AppendCString.
+void AppendNumberChars(IncrementalStringBuilder* builder, const char* chars) {
+  int length = StrLength(chars);
+  if (builder->CurrentPartCanFit(length)) {
+    if (builder->CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+      IncrementalStringBuilder::NoExtendBuilder<uint8_t> no_extend(builder,
+                                                                   length);
+      no_extend.AppendCString(chars);
+    } else {
+      IncrementalStringBuilder::NoExtendBuilder<uc16> no_extend(builder,
+                                                                length);
+      no_extend.AppendCString(chars);
+    }
+  } else {
+    builder->AppendCString(chars);
+  }
+}
+
+}  // namespace
+
 JsonStringifier::Result JsonStringifier::SerializeSmi(Smi* object) {
   static const int kBufferSize = 100;
   char chars[kBufferSize];
   Vector<char> buffer(chars, kBufferSize);
-  builder_.AppendCString(IntToCString(object->value(), buffer));
+  AppendNumberChars(&builder_, IntToCString(object->value(), buffer));
   return SUCCESS;
 }
 
@@ -384,7 +416,7 @@ JsonStringifier::Result JsonStringifier::SerializeDouble(double number) {
   static const int kBufferSize = 100;
   char chars[kBufferSize];
   Vector<char> buffer(chars, kBufferSize);
-  builder_.AppendCString(DoubleToCString(number, buffer));
+  AppendNumberChars(&builder_, DoubleToCString(number, buffer));
   return SUCCESS;
 }
 
@@ -519,15 +551,17 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!js_obj->HasIndexedInterceptor());
     DCHECK(!js_obj->HasNamedInterceptor());
     Handle<Map> map(js_obj->map());
+    Handle<DescriptorArray> descriptors(map->instance_descriptors(), isolate_);
+    int limit = map->NumberOfOwnDescriptors();
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
-    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
-      Handle<Name> name(map->instance_descriptors()->GetKey(i), isolate_);
+    for (int i = 0; i < limit; i++) {
+      Handle<Name> name(descriptors->GetKey(i), isolate_);
       // TODO(rossberg): Should this throw?
       if (!name->IsString()) continue;
       Handle<String> key = Handle<String>::cast(name);
-      PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+      PropertyDetails details = descriptors->GetDetails(i);
       if (details.IsDontEnum()) continue;
       Handle<Object> property;
       if (details.type() == DATA && *map == js_obj->map()) {
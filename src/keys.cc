@@ -573,6 +573,14 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   if (length == 0) {
     return isolate->factory()->empty_fixed_array();
   }
+  // Reuse the enumeration computed by a previous key collection if the
+  // dictionary has not been mutated since. The cache is only written when
+  // every live entry is enumerable, so a hit is valid for both collection
+  // modes and produces no shadowing keys.
+  if (FixedArray* enum_cache = T::ShapeT::GetEnumCache(*dictionary)) {
+    DCHECK_EQ(length, enum_cache->length());
+    return handle(enum_cache, isolate);
+  }
   Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
   T::CopyEnumKeysTo(dictionary, storage, mode, accumulator);
   return storage;
@@ -612,13 +620,22 @@ Maybe<bool> KeyAccumulator::CollectOwnPropertyNames(Handle<JSReceiver> receiver,
       int limit = object->map()->NumberOfOwnDescriptors();
       Handle<DescriptorArray> descs(object->map()->instance_descriptors(),
                                     isolate_);
-      // First collect the strings,
-      int first_symbol =
-          CollectOwnPropertyNamesInternal<true>(object, this, descs, 0, limit);
-      // then the symbols.
-      if (first_symbol != -1) {
-        CollectOwnPropertyNamesInternal<false>(object, this, descs,
-                                               first_symbol, limit);
+      if (filter_ & SKIP_STRINGS) {
+        // Only symbols can pass the filter; collect them in a single pass.
+        // String-keyed shadowing properties need not be recorded since any
+        // string key from the prototype chain is filtered out as well.
+        CollectOwnPropertyNamesInternal<false>(object, this, descs, 0, limit);
+      } else {
+        // First collect the strings,
+        int first_symbol = CollectOwnPropertyNamesInternal<true>(
+            object, this, descs, 0, limit);
+        // then the symbols. The symbol pass contributes nothing when the
+        // filter skips symbols: symbol keys are rejected before they are
+        // added or recorded as shadowing.
+        if (first_symbol != -1 && !(filter_ & SKIP_SYMBOLS)) {
+          CollectOwnPropertyNamesInternal<false>(object, this, descs,
+                                                 first_symbol, limit);
+        }
       }
     } else if (object->IsJSGlobalObject()) {
       GlobalDictionary::CollectKeysTo(
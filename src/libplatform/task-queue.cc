@@ -11,37 +11,89 @@
 namespace v8 {
 namespace platform {
 
-TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
+TaskQueue::TaskQueue() : process_queue_semaphore_(0) {
+  terminated_.SetValue(false);
+}
 
 
 TaskQueue::~TaskQueue() {
   base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(terminated_.Value());
+  DCHECK(shared_queue_.IsEmpty());
+  for (SubQueue* sub_queue : sub_queues_) {
+    DCHECK(sub_queue->IsEmpty());
+    delete sub_queue;
+  }
+  DCHECK(overflow_tasks_.empty());
 }
 
 
-void TaskQueue::Append(Task* task) {
+int TaskQueue::RegisterWorker() {
   base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(task);
+  DCHECK(!terminated_.Value());
+  sub_queues_.push_back(new SubQueue());
+  return static_cast<int>(sub_queues_.size() - 1);
+}
+
+
+void TaskQueue::Append(Task* task) {
+  DCHECK(!terminated_.Value());
+  // The sub-queue vector does not grow after worker registration, so it can
+  // be read without lock_ here.
+  SubQueue* queue = &shared_queue_;
+  if (!sub_queues_.empty()) {
+    queue = sub_queues_[next_sub_queue_.Increment(1) % sub_queues_.size()];
+  }
+  bool enqueued = queue->Enqueue(task);
+  if (!enqueued && queue != &shared_queue_) {
+    enqueued = shared_queue_.Enqueue(task);
+  }
+  if (!enqueued) {
+    // All lock-free queues are full; spill into the overflow queue.
+    base::LockGuard<base::Mutex> guard(&overflow_lock_);
+    overflow_tasks_.push_back(task);
+  }
+  // Always signal: skipping the wakeup based on an idle-worker count would
+  // need fences on both sides of the handshake, since the count can be read
+  // before the enqueue above is visible to a worker that is about to park.
   process_queue_semaphore_.Signal();
 }
 
 
-Task* TaskQueue::GetNext() {
+Task* TaskQueue::TryGetNext(int worker_index) {
+  Task* task = nullptr;
+  if (worker_index != kNoWorkerIndex &&
+      sub_queues_[worker_index]->Dequeue(&task)) {
+    return task;
+  }
+  if (shared_queue_.Dequeue(&task)) return task;
+  {
+    base::LockGuard<base::Mutex> guard(&overflow_lock_);
+    if (!overflow_tasks_.empty()) {
+      task = overflow_tasks_.front();
+      overflow_tasks_.pop_front();
+      return task;
+    }
+  }
+  {
+    base::LockGuard<base::Mutex> guard(&lock_);
+    // Steal from the other workers' sub-queues.
+    for (size_t i = 0; i < sub_queues_.size(); i++) {
+      if (static_cast<int>(i) == worker_index) continue;
+      if (sub_queues_[i]->Dequeue(&task)) return task;
+    }
+  }
+  return nullptr;
+}
+
+
+Task* TaskQueue::GetNext(int worker_index) {
   for (;;) {
-    {
-      base::LockGuard<base::Mutex> guard(&lock_);
-      if (!task_queue_.empty()) {
-        Task* result = task_queue_.front();
-        task_queue_.pop();
-        return result;
-      }
-      if (terminated_) {
-        process_queue_semaphore_.Signal();
-        return NULL;
-      }
+    Task* task = TryGetNext(worker_index);
+    if (task != nullptr) return task;
+    if (terminated_.Value()) {
+      process_queue_semaphore_.Signal();
+      return nullptr;
     }
     process_queue_semaphore_.Wait();
   }
@@ -49,18 +101,25 @@ Task* TaskQueue::GetNext() {
 
 
 void TaskQueue::Terminate() {
-  base::LockGuard<base::Mutex> guard(&lock_);
-  DCHECK(!terminated_);
-  terminated_ = true;
+  DCHECK(!terminated_.Value());
+  terminated_.SetValue(true);
   process_queue_semaphore_.Signal();
 }
 
 void TaskQueue::BlockUntilQueueEmptyForTesting() {
   for (;;) {
+    bool empty = shared_queue_.IsEmpty();
     {
       base::LockGuard<base::Mutex> guard(&lock_);
-      if (task_queue_.empty()) return;
+      for (SubQueue* sub_queue : sub_queues_) {
+        if (!sub_queue->IsEmpty()) empty = false;
+      }
+    }
+    {
+      base::LockGuard<base::Mutex> guard(&overflow_lock_);
+      if (!overflow_tasks_.empty()) empty = false;
     }
+    if (empty) return;
     base::OS::Sleep(base::TimeDelta::FromMilliseconds(5));
   }
 }
@@ -5,8 +5,11 @@
 #ifndef V8_LIBPLATFORM_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_TASK_QUEUE_H_
 
-#include <queue>
+#include <deque>
+#include <vector>
 
+#include "src/base/atomic-utils.h"
+#include "src/base/bounded-mpmc-queue.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/semaphore.h"
@@ -20,15 +23,28 @@ namespace platform {
 
 class TaskQueue {
  public:
+  static const int kNoWorkerIndex = -1;
+
   TaskQueue();
   ~TaskQueue();
 
-  // Appends a task to the queue. The queue takes ownership of |task|.
+  // Registers a worker with the queue and returns the index of its local
+  // sub-queue. Appended tasks are distributed round-robin across the local
+  // sub-queues; a worker that runs out of local tasks steals from the other
+  // workers' sub-queues. All workers must be registered before the first
+  // task is appended.
+  int RegisterWorker();
+
+  // Appends a task to the queue. The queue takes ownership of |task|. The
+  // fast path is lock-free; a lock is only taken when the bounded sub-queues
+  // overflow.
   void Append(Task* task);
 
-  // Returns the next task to process. Blocks if no task is available. Returns
-  // NULL if the queue is terminated.
-  Task* GetNext();
+  // Returns the next task to process on behalf of the worker with the given
+  // index, preferring the worker's own sub-queue. Blocks if no task is
+  // available anywhere. Returns NULL if the queue is terminated. Consumers
+  // that are not registered workers pass kNoWorkerIndex.
+  Task* GetNext(int worker_index = kNoWorkerIndex);
 
   // Terminate the queue.
   void Terminate();
@@ -36,12 +52,26 @@ class TaskQueue {
  private:
   FRIEND_TEST(WorkerThreadTest, PostSingleTask);
 
+  // Must be a power of two. When a sub-queue overflows, tasks spill first
+  // into the shared queue and then into the locked overflow queue.
+  static const size_t kSubQueueCapacity = 1024;
+  typedef base::BoundedMpmcQueue<Task*, kSubQueueCapacity> SubQueue;
+
+  // Returns the next available task without blocking, or nullptr.
+  Task* TryGetNext(int worker_index);
+
   void BlockUntilQueueEmptyForTesting();
 
   base::Semaphore process_queue_semaphore_;
+  // Protects the sub_queues_ vector itself.
   base::Mutex lock_;
-  std::queue<Task*> task_queue_;
-  bool terminated_;
+  SubQueue shared_queue_;
+  std::vector<SubQueue*> sub_queues_;
+  base::AtomicNumber<size_t> next_sub_queue_;
+  // Spill-over for tasks appended while the lock-free queues are full.
+  base::Mutex overflow_lock_;
+  std::deque<Task*> overflow_tasks_;
+  base::AtomicValue<bool> terminated_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
 };
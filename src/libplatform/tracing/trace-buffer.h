@@ -32,7 +32,10 @@ class TraceBufferRingBuffer : public TraceBuffer {
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
   size_t NextChunkIndex(size_t index) const;
 
-  mutable base::Mutex mutex_;
+  // The critical sections are a handful of loads and stores, so the
+  // spinning mutex keeps AddTraceEvent at its inline fast path while
+  // tracing is enabled.
+  mutable base::AdaptiveMutex mutex_;
   size_t max_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
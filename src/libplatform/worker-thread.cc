@@ -11,7 +11,9 @@ namespace v8 {
 namespace platform {
 
 WorkerThread::WorkerThread(TaskQueue* queue)
-    : Thread(Options("V8 WorkerThread")), queue_(queue) {
+    : Thread(Options("V8 WorkerThread")),
+      queue_(queue),
+      index_(queue->RegisterWorker()) {
   Start();
 }
 
@@ -22,7 +24,7 @@ WorkerThread::~WorkerThread() {
 
 
 void WorkerThread::Run() {
-  while (Task* task = queue_->GetNext()) {
+  while (Task* task = queue_->GetNext(index_)) {
     task->Run();
     delete task;
   }
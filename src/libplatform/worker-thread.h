@@ -28,6 +28,8 @@ class WorkerThread : public base::Thread {
   friend class QuitTask;
 
   TaskQueue* queue_;
+  // Index of this worker's local sub-queue in |queue_|.
+  int index_;
 
   DISALLOW_COPY_AND_ASSIGN(WorkerThread);
 };
@@ -56,15 +56,95 @@ void LookupIterator::Start() {
   JSReceiver* holder = *holder_;
   Map* map = holder->map();
 
+  if (!is_element && TryCachedPrototypeLookup(map)) return;
+
   state_ = LookupInHolder<is_element>(map, holder);
   if (IsFound()) return;
 
   NextInternal<is_element>(map, holder);
+
+  if (!is_element) MaybeCachePrototypeLookup();
 }
 
 template void LookupIterator::Start<true>();
 template void LookupIterator::Start<false>();
 
+bool LookupIterator::TryCachedPrototypeLookup(Map* receiver_map) {
+  DisallowHeapAllocation no_gc;
+  if (!check_prototype_chain()) return false;
+  if (interceptor_state_ != InterceptorState::kUninitialized) return false;
+  JSObject* holder;
+  int descriptor_number;
+  if (!isolate_->prototype_lookup_cache()->Lookup(receiver_map, *name_,
+                                                  &holder,
+                                                  &descriptor_number)) {
+    return false;
+  }
+  // The valid cell proves that neither the receiver map's prototype nor any
+  // object above it on the chain has changed shape since the entry was
+  // recorded, so the holder's map and descriptors are unchanged as well.
+  DescriptorArray* descriptors = holder->map()->instance_descriptors();
+  DCHECK_EQ(*name_, descriptors->GetKey(descriptor_number));
+  number_ = static_cast<uint32_t>(descriptor_number);
+  property_details_ = descriptors->GetDetails(descriptor_number);
+  has_property_ = true;
+  state_ = property_details_.kind() == v8::internal::kData ? DATA : ACCESSOR;
+  holder_ = handle(holder, isolate_);
+  return true;
+}
+
+void LookupIterator::MaybeCachePrototypeLookup() {
+  DisallowHeapAllocation no_gc;
+  if (state_ != DATA && state_ != ACCESSOR) return;
+  if (!check_prototype_chain()) return;
+  if (interceptor_state_ != InterceptorState::kUninitialized) return;
+  // Lookups that end on the receiver itself are served by the descriptor
+  // lookup cache already.
+  if (*holder_ == *initial_holder_) return;
+  Map* receiver_map = initial_holder_->map();
+  if (receiver_map->instance_type() <= LAST_SPECIAL_RECEIVER_TYPE) return;
+  if (receiver_map->is_dictionary_map()) return;
+  // Walk the chain again and only record the result when every map up to and
+  // including the holder's is a fast-mode prototype map: those are exactly
+  // the maps whose shape changes go through map migration and thereby
+  // invalidate the validity cell the entry is guarded by. Dictionary-mode
+  // prototypes mutate in place without migrating, so they cannot be covered.
+  JSObject* holder = JSObject::cast(*holder_);
+  Cell* validity_cell = nullptr;
+  for (Object* current = receiver_map->prototype();;) {
+    if (!current->IsJSObject()) return;
+    JSObject* proto = JSObject::cast(current);
+    Map* proto_map = proto->map();
+    if (proto_map->instance_type() <= LAST_SPECIAL_RECEIVER_TYPE) return;
+    if (proto_map->is_dictionary_map()) return;
+    if (!proto_map->is_prototype_map()) return;
+    if (validity_cell == nullptr) {
+      // The cell guarding the chain lives on the receiver map's prototype.
+      // Recording must not allocate, so only reuse a cell that IC handler
+      // compilation has already created for this chain.
+      Object* maybe_proto_info = proto_map->prototype_info();
+      if (!maybe_proto_info->IsPrototypeInfo()) return;
+      Object* maybe_cell =
+          PrototypeInfo::cast(maybe_proto_info)->validity_cell();
+      if (!maybe_cell->IsCell()) return;
+      validity_cell = Cell::cast(maybe_cell);
+      if (validity_cell->value() !=
+          Smi::FromInt(Map::kPrototypeChainValid)) {
+        return;
+      }
+      if (heap()->InNewSpace(validity_cell)) return;
+    }
+    if (proto == holder) break;
+    current = proto_map->prototype();
+  }
+  // The cache survives scavenges without being cleared, so it must not hold
+  // pointers into new space.
+  if (heap()->InNewSpace(holder)) return;
+  isolate_->prototype_lookup_cache()->Update(receiver_map, *name_,
+                                             validity_cell, holder,
+                                             static_cast<int>(number_));
+}
+
 void LookupIterator::Next() {
   DCHECK_NE(JSPROXY, state_);
   DCHECK_NE(TRANSITION, state_);
@@ -292,6 +292,13 @@ class LookupIterator final BASE_EMBEDDED {
   void Start();
   template <bool is_element>
   void NextInternal(Map* map, JSReceiver* holder);
+  // Support for the isolate's PrototypeLookupCache: a named lookup that
+  // walked a chain of fast-mode maps and ended at a property on a prototype
+  // is remembered keyed on the receiver map, guarded by the prototype chain
+  // validity cell, so the next lookup for the same receiver map can jump
+  // straight to the holder.
+  bool TryCachedPrototypeLookup(Map* receiver_map);
+  void MaybeCachePrototypeLookup();
   template <bool is_element>
   inline State LookupInHolder(Map* map, JSReceiver* holder) {
     return map->instance_type() <= LAST_SPECIAL_RECEIVER_TYPE
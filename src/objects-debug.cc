@@ -1038,6 +1038,9 @@ void DebugInfo::DebugInfoVerify() {
   VerifyPointer(shared());
   VerifyPointer(debug_bytecode_array());
   VerifyPointer(break_points());
+  VerifyPointer(inspection_count());
+  VerifyPointer(inspection_position());
+  VerifyPointer(inspection_arguments());
 }
 
 
@@ -3159,11 +3159,15 @@ int HashTable<Derived, Shape, Key>::FindEntry(Isolate* isolate, Key key,
   Object* the_hole = isolate->heap()->the_hole_value();
   while (true) {
     Object* element = KeyAt(entry);
+    // Start fetching the next probe slot while the current key is examined;
+    // in large dictionaries successive probes rarely share a cache line.
+    uint32_t next_entry = NextProbe(entry, count++, capacity);
+    V8_PREFETCH_FOR_READ(RawFieldOfElementAt(EntryToIndex(next_entry)));
     // Empty entry. Uses raw unchecked accessors because it is called by the
     // string table during bootstrapping.
     if (element == undefined) break;
     if (element != the_hole && Shape::IsMatch(key, element)) return entry;
-    entry = NextProbe(entry, count++, capacity);
+    entry = next_entry;
   }
   return kNotFound;
 }
@@ -4121,6 +4125,18 @@ int BytecodeArray::register_count() const {
 }
 
 
+void BytecodeArray::set_suspended_register_count(int count) {
+  DCHECK_GE(count, 0);
+  DCHECK_LE(count, register_count());
+  WRITE_INT_FIELD(this, kSuspendedRegisterCountOffset, count);
+}
+
+
+int BytecodeArray::suspended_register_count() const {
+  return READ_INT_FIELD(this, kSuspendedRegisterCountOffset);
+}
+
+
 void BytecodeArray::set_parameter_count(int number_of_parameters) {
   DCHECK_GE(number_of_parameters, 0);
   // Parameter count is stored as the size on stack of the parameters to allow
@@ -4148,6 +4164,26 @@ void BytecodeArray::set_osr_loop_nesting_level(int depth) {
   WRITE_INT8_FIELD(this, kOSRNestingLevelOffset, depth);
 }
 
+int BytecodeArray::bytecode_age() const {
+  return READ_INT8_FIELD(this, kBytecodeAgeOffset);
+}
+
+void BytecodeArray::set_bytecode_age(int age) {
+  DCHECK(kNoAgeBytecodeAge <= age && age <= kMaxInt8);
+  WRITE_INT8_FIELD(this, kBytecodeAgeOffset, age);
+}
+
+void BytecodeArray::MakeOlder() {
+  int age = bytecode_age();
+  if (age < FLAG_bytecode_old_age && age < kMaxInt8) {
+    set_bytecode_age(age + 1);
+  }
+}
+
+bool BytecodeArray::IsOld() const {
+  return bytecode_age() >= FLAG_bytecode_old_age;
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -5713,6 +5749,7 @@ BOOL_ACCESSORS(InterceptorInfo, flags, can_intercept_symbols,
                kCanInterceptSymbolsBit)
 BOOL_ACCESSORS(InterceptorInfo, flags, all_can_read, kAllCanReadBit)
 BOOL_ACCESSORS(InterceptorInfo, flags, non_masking, kNonMasking)
+BOOL_ACCESSORS(InterceptorInfo, flags, stable_per_map, kStablePerMapBit)
 
 ACCESSORS(CallHandlerInfo, callback, Object, kCallbackOffset)
 ACCESSORS(CallHandlerInfo, data, Object, kDataOffset)
@@ -5742,6 +5779,8 @@ ACCESSORS(FunctionTemplateInfo, access_check_info, Object,
           kAccessCheckInfoOffset)
 ACCESSORS(FunctionTemplateInfo, shared_function_info, Object,
           kSharedFunctionInfoOffset)
+ACCESSORS(FunctionTemplateInfo, cached_template_map, Object,
+          kCachedTemplateMapOffset)
 
 SMI_ACCESSORS(FunctionTemplateInfo, flag, kFlagOffset)
 
@@ -5848,6 +5887,11 @@ void Script::set_origin_options(ScriptOriginOptions origin_options) {
 ACCESSORS(DebugInfo, shared, SharedFunctionInfo, kSharedFunctionInfoIndex)
 ACCESSORS(DebugInfo, debug_bytecode_array, Object, kDebugBytecodeArrayIndex)
 ACCESSORS(DebugInfo, break_points, FixedArray, kBreakPointsStateIndex)
+ACCESSORS(DebugInfo, inspection_count, Object, kInspectionCountIndex)
+ACCESSORS(DebugInfo, inspection_position, Object, kInspectionPositionIndex)
+ACCESSORS(DebugInfo, inspection_arguments, Object, kInspectionArgumentsIndex)
+
+bool DebugInfo::IsUnderInspection() { return inspection_count()->IsSmi(); }
 
 bool DebugInfo::HasDebugBytecodeArray() {
   return debug_bytecode_array()->IsBytecodeArray();
@@ -6096,6 +6140,8 @@ BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_default_constructor,
                kIsDefaultConstructor)
 BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, is_asm_wasm_broken,
                kIsAsmWasmBroken)
+BOOL_ACCESSORS(SharedFunctionInfo, compiler_hints, marked_for_tier_up,
+               kMarkedForTierUp)
 
 inline bool SharedFunctionInfo::is_resumable() const {
   return is_generator() || is_async();
@@ -6890,6 +6936,16 @@ void JSArrayBuffer::set_is_shared(bool value) {
 }
 
 
+bool JSArrayBuffer::has_guard_region() {
+  return HasGuardRegion::decode(bit_field());
+}
+
+
+void JSArrayBuffer::set_has_guard_region(bool value) {
+  set_bit_field(HasGuardRegion::update(bit_field(), value));
+}
+
+
 Object* JSArrayBufferView::byte_offset() const {
   if (WasNeutered()) return Smi::FromInt(0);
   return Object::cast(READ_FIELD(this, kByteOffsetOffset));
@@ -7263,10 +7319,22 @@ inline void StringHasher::AddCharacters(const Char* chars, int length) {
       }
     }
   }
+  DCHECK(i == length || !is_array_index_);
+  // Bulk path. The Jenkins one-at-a-time hash is a sequential dependency
+  // chain by construction, so the published hash values rule out processing
+  // several characters in parallel; instead keep the running hash in a
+  // register and unroll so the loop overhead hides behind the chain.
+  uint32_t running_hash = raw_running_hash_;
+  for (; i + 4 <= length; i += 4) {
+    running_hash = AddCharacterCore(running_hash, chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 1]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 2]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 3]);
+  }
   for (; i < length; i++) {
-    DCHECK(!is_array_index_);
-    AddCharacter(chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i]);
   }
+  raw_running_hash_ = running_hash;
 }
 
 
@@ -7689,6 +7757,7 @@ void Dictionary<Derived, Shape, Key>::SetEntry(int entry,
                                                Handle<Object> value,
                                                PropertyDetails details) {
   Shape::SetEntry(static_cast<Derived*>(this), entry, key, value, details);
+  Shape::InvalidateEnumCache(static_cast<Derived*>(this));
 }
 
 
@@ -7826,6 +7895,45 @@ bool GlobalDictionaryShape::IsDeleted(Dictionary* dict, int entry) {
 }
 
 
+template <typename Dictionary>
+FixedArray* NameDictionaryShape::GetEnumCache(Dictionary* dict) {
+  return dict->HasEnumCache() ? dict->GetEnumCache() : nullptr;
+}
+
+
+template <typename Dictionary>
+void NameDictionaryShape::SetEnumCache(Dictionary* dict, FixedArray* keys) {
+  dict->SetEnumCache(keys);
+}
+
+
+template <typename Dictionary>
+void NameDictionaryShape::InvalidateEnumCache(Dictionary* dict) {
+  dict->ClearEnumCache();
+}
+
+
+bool NameDictionary::HasEnumCache() {
+  return get(kEnumCacheIndex)->IsFixedArray();
+}
+
+
+FixedArray* NameDictionary::GetEnumCache() {
+  DCHECK(HasEnumCache());
+  return FixedArray::cast(get(kEnumCacheIndex));
+}
+
+
+void NameDictionary::SetEnumCache(FixedArray* keys) {
+  set(kEnumCacheIndex, keys);
+}
+
+
+void NameDictionary::ClearEnumCache() {
+  set(kEnumCacheIndex, Smi::FromInt(0));
+}
+
+
 bool ObjectHashTableShape::IsMatch(Handle<Object> key, Object* other) {
   return key->SameValue(other);
 }
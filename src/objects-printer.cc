@@ -1279,6 +1279,7 @@ void DebugInfo::DebugInfoPrint(std::ostream& os) {  // NOLINT
   HeapObject::PrintHeader(os, "DebugInfo");
   os << "\n - shared: " << Brief(shared());
   os << "\n - debug bytecode array: " << Brief(debug_bytecode_array());
+  os << "\n - inspection count: " << Brief(inspection_count());
   os << "\n - break_points: ";
   break_points()->Print(os);
 }
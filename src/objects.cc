@@ -53,6 +53,7 @@
 #include "src/prototype.h"
 #include "src/regexp/jsregexp.h"
 #include "src/safepoint-table.h"
+#include "src/shared-backing-store-registry.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/source-position-table.h"
 #include "src/string-builder.h"
@@ -2086,6 +2087,74 @@ std::ostream& operator<<(std::ostream& os, const Brief& v) {
 }
 
 
+// static
+int Smi::LexicographicCompare(int x_value, int y_value) {
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return EQUAL;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0) return x_value < y_value ? LESS : GREATER;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return LESS;
+    if (x_value >= 0) return GREATER;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros32(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros32(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  int tie = EQUAL;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = LESS;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = GREATER;
+  }
+
+  if (x_scaled < y_scaled) return LESS;
+  if (x_scaled > y_scaled) return GREATER;
+  return tie;
+}
+
 void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
   os << value();
 }
@@ -9352,6 +9421,56 @@ Handle<Map> Map::PrepareForDataProperty(Handle<Map> map, int descriptor,
 }
 
 
+MaybeHandle<Map> Map::CreateForLiteral(Handle<Map> map,
+                                       Handle<FixedArray> names,
+                                       Handle<FixedArray> values,
+                                       int number_of_properties) {
+  Isolate* isolate = map->GetIsolate();
+  DCHECK(!map->is_dictionary_map());
+  if (number_of_properties == 0) return map;
+  // Only fresh shapes are built here: the map must still be bare and must
+  // not know the first name yet. Once the shape exists, walking the
+  // transition tree one property at a time does not allocate either.
+  if (map->NumberOfOwnDescriptors() != 0) return MaybeHandle<Map>();
+  if (number_of_properties > map->unused_property_fields()) {
+    return MaybeHandle<Map>();
+  }
+  if (TransitionArray::SearchTransition(*map, kData,
+                                        Name::cast(names->get(0)), NONE) !=
+      NULL) {
+    return MaybeHandle<Map>();
+  }
+  if (!TransitionArray::CanHaveMoreTransitions(map)) return MaybeHandle<Map>();
+
+  Handle<DescriptorArray> descriptors =
+      DescriptorArray::Allocate(isolate, 0, number_of_properties);
+  int current_offset = 0;
+  for (int i = 0; i < number_of_properties; i++) {
+    Handle<Name> name(Name::cast(names->get(i)), isolate);
+    DCHECK(name->IsUniqueName());
+    if (descriptors->Search(*name, i) != DescriptorArray::kNotFound) {
+      // Duplicate property names have last-one-wins semantics that only the
+      // one-at-a-time path implements.
+      return MaybeHandle<Map>();
+    }
+    Handle<Object> value(values->get(i), isolate);
+    if (value->IsJSFunction()) {
+      DataConstantDescriptor d(name, value, NONE);
+      descriptors->Append(&d);
+    } else {
+      // TODO(verwaest): Support tracking representations in the boilerplate.
+      DataDescriptor d(name, current_offset, NONE, Representation::Tagged());
+      current_offset += d.GetDetails().field_width_in_words();
+      descriptors->Append(&d);
+    }
+  }
+
+  Handle<LayoutDescriptor> full_layout_descriptor =
+      LayoutDescriptor::New(map, descriptors, number_of_properties);
+  return AddMissingTransitions(map, descriptors, full_layout_descriptor);
+}
+
+
 Handle<Map> Map::TransitionToDataProperty(Handle<Map> map, Handle<Name> name,
                                           Handle<Object> value,
                                           PropertyAttributes attributes,
@@ -11059,7 +11178,18 @@ void String::WriteToFlat(String* src,
         if (to - boundary >= boundary - from) {
           // Right hand side is longer.  Recurse over left.
           if (from < boundary) {
-            WriteToFlat(first, sink, from, boundary);
+            // When repeatedly prepending to a string, we get a cons string
+            // that is unbalanced to the right.  Inline the common case of a
+            // sequential left child to avoid a recursive call per fragment.
+            if (from == 0 && first->IsSeqOneByteString()) {
+              CopyChars(sink, SeqOneByteString::cast(first)->GetChars(),
+                        boundary);
+            } else if (from == 0 && first->IsSeqTwoByteString()) {
+              CopyChars(sink, SeqTwoByteString::cast(first)->GetChars(),
+                        boundary);
+            } else {
+              WriteToFlat(first, sink, from, boundary);
+            }
             if (from == 0 && cons_string->second() == first) {
               CopyChars(sink + boundary, sink, boundary);
               return;
@@ -11084,6 +11214,10 @@ void String::WriteToFlat(String* src,
               CopyChars(sink + boundary - from,
                         SeqOneByteString::cast(second)->GetChars(),
                         to - boundary);
+            } else if (second->IsSeqTwoByteString()) {
+              CopyChars(sink + boundary - from,
+                        SeqTwoByteString::cast(second)->GetChars(),
+                        to - boundary);
             } else {
               WriteToFlat(second,
                           sink + boundary - from,
@@ -11166,13 +11300,15 @@ Handle<FixedArray> String::CalculateLineEnds(Handle<String> src,
 }
 
 
-// Compares the contents of two strings by reading and comparing
-// int-sized blocks of characters.
+// Compares the contents of two strings of the same width for equality.
+// Unlike CompareChars no lexicographic order is needed, so two-byte contents
+// can be compared as raw bytes as well; memcmp compares a word or more at a
+// time.
 template <typename Char>
 static inline bool CompareRawStringContents(const Char* const a,
                                             const Char* const b,
                                             int length) {
-  return CompareChars(a, b, length) == 0;
+  return memcmp(a, b, length * sizeof(Char)) == 0;
 }
 
 
@@ -11317,6 +11453,20 @@ class StringComparator {
 };
 
 
+// Returns the start of the one-byte characters of a string whose contents
+// are flat without indirection, i.e. a sequential or external one-byte
+// string, or NULL otherwise.
+static inline const uint8_t* OneByteCharsOrNull(String* string) {
+  if (string->IsSeqOneByteString()) {
+    return SeqOneByteString::cast(string)->GetChars();
+  }
+  if (string->IsExternalOneByteString()) {
+    return ExternalOneByteString::cast(string)->GetChars();
+  }
+  return NULL;
+}
+
+
 bool String::SlowEquals(String* other) {
   DisallowHeapAllocation no_gc;
   // Fast check: negative check with lengths.
@@ -11348,10 +11498,12 @@ bool String::SlowEquals(String* other) {
   // before we try to flatten the strings.
   if (this->Get(0) != other->Get(0)) return false;
 
-  if (IsSeqOneByteString() && other->IsSeqOneByteString()) {
-    const uint8_t* str1 = SeqOneByteString::cast(this)->GetChars();
-    const uint8_t* str2 = SeqOneByteString::cast(other)->GetChars();
-    return CompareRawStringContents(str1, str2, len);
+  // External one-byte strings hold flat contents just like sequential ones,
+  // so they take part in the bulk comparison as well.
+  const uint8_t* str1 = OneByteCharsOrNull(this);
+  if (str1 != NULL) {
+    const uint8_t* str2 = OneByteCharsOrNull(other);
+    if (str2 != NULL) return CompareRawStringContents(str1, str2, len);
   }
 
   StringComparator comparator;
@@ -13762,6 +13914,8 @@ void Code::Relocate(intptr_t delta) {
 
 
 void Code::CopyFrom(const CodeDesc& desc) {
+  CodePageMemoryModificationScope modification_scope(address());
+
   // copy code
   CopyBytes(instruction_start(), desc.buffer,
             static_cast<size_t>(desc.instr_size));
@@ -13898,11 +14052,25 @@ int AbstractCode::SourcePosition(int offset) {
   int position = 0;
   // Subtract one because the current PC is one instruction after the call site.
   if (IsCode()) offset--;
-  for (SourcePositionTableIterator iterator(source_position_table());
+  // Decoding is linear in the table size; consult the cache first so that
+  // repeatedly symbolizing the same frames (e.g. while capturing many stack
+  // traces) pays for the decode only once.
+  ByteArray* table = source_position_table();
+  SourcePositionLookupCache* cache =
+      GetIsolate()->source_position_lookup_cache();
+  int cached_position = cache->Lookup(table, offset);
+  if (cached_position != SourcePositionLookupCache::kAbsent) {
+    return cached_position;
+  }
+  for (SourcePositionTableIterator iterator(table);
        !iterator.done() && iterator.code_offset() <= offset;
        iterator.Advance()) {
     position = iterator.source_position();
   }
+  // The table is tenured, so the cached raw pointer stays valid until the
+  // cache is cleared for mark-compact.
+  DCHECK(!GetHeap()->InNewSpace(table));
+  cache->Update(table, offset, position);
   return position;
 }
 
@@ -16477,10 +16645,15 @@ int NameDictionaryBase<Derived, Shape>::FindEntry(Handle<Name> key) {
   Isolate* isolate = this->GetIsolate();
   while (true) {
     Object* element = this->KeyAt(entry);
+    // Hide the latency of a miss on the next probe slot behind the current
+    // key comparison; dictionary-mode lookups are dominated by cache misses.
+    uint32_t next_entry = Derived::NextProbe(entry, count++, capacity);
+    V8_PREFETCH_FOR_READ(
+        this->RawFieldOfElementAt(Derived::EntryToIndex(next_entry)));
     if (element->IsUndefined(isolate)) break;  // Empty entry.
     if (*key == element) return entry;
     DCHECK(element->IsTheHole(isolate) || element->IsUniqueName());
-    entry = Derived::NextProbe(entry, count++, capacity);
+    entry = next_entry;
   }
   return Derived::kNotFound;
 }
@@ -17290,6 +17463,22 @@ void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
 }
 
 
+void StringTable::CompactDeadEntries(Isolate* isolate) {
+  HandleScope scope(isolate);
+  Handle<StringTable> table = isolate->factory()->string_table();
+  // We need a key instance for the virtual hash function.
+  InternalizedStringKey dummy_key(isolate->factory()->empty_string());
+  // An insertion since the GC may already have rehashed the table; only
+  // repair the probe chains while the holes still make up a noticeable
+  // fraction of the capacity.
+  if (table->NumberOfDeletedElements() >= (table->Capacity() >> 3)) {
+    table->Rehash(&dummy_key);
+  }
+  Handle<StringTable> shrunk = StringTable::Shrink(table, &dummy_key);
+  if (*shrunk != *table) isolate->heap()->SetRootStringTable(*shrunk);
+}
+
+
 Handle<String> StringTable::LookupString(Isolate* isolate,
                                          Handle<String> string) {
   if (string->IsConsString() && string->IsFlat()) {
@@ -17892,6 +18081,12 @@ void Dictionary<Derived, Shape, Key>::CopyEnumKeysTo(
     int index = Smi::cast(raw_storage->get(i))->value();
     raw_storage->set(i, raw_dictionary->KeyAt(index));
   }
+  if (length == raw_dictionary->NumberOfElements()) {
+    // Every live entry is an enumerable string-keyed property, so the result
+    // is independent of the collection mode and can be reused by the next key
+    // collection over this dictionary. Any mutation clears it again.
+    Shape::SetEnumCache(static_cast<Derived*>(raw_dictionary), raw_storage);
+  }
 }
 
 template <typename Derived, typename Shape, typename Key>
@@ -18217,6 +18412,12 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Clear(
   table->SetNextTable(*new_table);
   table->SetNumberOfDeletedElements(kClearedTableSentinel);
 
+  // Only the next table link and the cleared sentinel remain live for
+  // iterator transitions; return the buckets and entries to the heap
+  // right away.
+  table->GetHeap()->template RightTrimFixedArray<Heap::CONCURRENT_TO_SWEEPER>(
+      *table, table->length() - kHashTableStartIndex);
+
   return new_table;
 }
 
@@ -18328,6 +18529,13 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Rehash(
   new_table->SetNumberOfElements(nof);
   table->SetNextTable(*new_table);
 
+  // The old table is obsolete now: iterators still referencing it only read
+  // the next table link and the removed hole indexes when they transition.
+  // Return the rest of its storage to the heap right away instead of keeping
+  // both copies alive until the next GC.
+  isolate->heap()->template RightTrimFixedArray<Heap::CONCURRENT_TO_SWEEPER>(
+      *table, table->length() - (kRemovedHolesIndex + nod));
+
   return new_table;
 }
 
@@ -19074,6 +19282,12 @@ void JSArrayBuffer::Setup(Handle<JSArrayBuffer> array_buffer, Isolate* isolate,
   array_buffer->set_backing_store(data);
 
   if (data && !is_external) {
+    // Shared backing stores may be mapped by buffers in several isolates; the
+    // process-wide registry reference-counts them so the store is only freed
+    // together with the last mapping buffer.
+    if (shared == SharedFlag::kShared) {
+      SharedBackingStoreRegistry::Acquire(data, allocated_length);
+    }
     isolate->heap()->RegisterNewArrayBuffer(*array_buffer);
   }
 }
@@ -1496,6 +1496,10 @@ class Smi: public Object {
 
   DECLARE_CAST(Smi)
 
+  // Compares two smi values as if they were converted to strings and then
+  // compared lexicographically; returns LESS, EQUAL or GREATER.
+  static int LexicographicCompare(int x_value, int y_value);
+
   // Dispatched behavior.
   void SmiPrint(std::ostream& os) const;  // NOLINT
   DECLARE_VERIFIER(Smi)
@@ -3513,6 +3517,11 @@ class StringTable: public HashTable<StringTable,
 
   static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
 
+  // Removes the holes that the mark-compact string table cleanup leaves
+  // behind and releases excess capacity. Runs from a task posted after the
+  // GC so that probe-chain repair stays off the pause's critical path.
+  static void CompactDeadEntries(Isolate* isolate);
+
   DECLARE_CAST(StringTable)
 
  private:
@@ -3565,6 +3574,7 @@ class Dictionary: public HashTable<Derived, Shape, Key> {
   // Set the details for entry.
   void DetailsAtPut(int entry, PropertyDetails value) {
     Shape::DetailsAtPut(static_cast<Derived*>(this), entry, value);
+    Shape::InvalidateEnumCache(static_cast<Derived*>(this));
   }
 
   // Returns true if property at given entry is deleted.
@@ -3715,6 +3725,18 @@ class BaseDictionaryShape : public BaseShape<Key> {
   template <typename Dictionary>
   static inline void SetEntry(Dictionary* dict, int entry, Handle<Object> key,
                               Handle<Object> value, PropertyDetails details);
+
+  // Enum cache support. Most dictionaries do not carry an enum cache; shapes
+  // that do override these to store the keys of the last computed enumeration
+  // on the dictionary and to clear them again on mutation.
+  template <typename Dictionary>
+  static inline FixedArray* GetEnumCache(Dictionary* dict) { return nullptr; }
+
+  template <typename Dictionary>
+  static inline void SetEnumCache(Dictionary* dict, FixedArray* keys) {}
+
+  template <typename Dictionary>
+  static inline void InvalidateEnumCache(Dictionary* dict) {}
 };
 
 
@@ -3724,11 +3746,20 @@ class NameDictionaryShape : public BaseDictionaryShape<Handle<Name> > {
   static inline uint32_t Hash(Handle<Name> key);
   static inline uint32_t HashForObject(Handle<Name> key, Object* object);
   static inline Handle<Object> AsHandle(Isolate* isolate, Handle<Name> key);
-  static const int kPrefixSize = 2;
+  static const int kPrefixSize = 3;
   static const int kEntrySize = 3;
   static const int kEntryValueIndex = 1;
   static const int kEntryDetailsIndex = 2;
   static const bool kIsEnumerable = true;
+
+  template <typename Dictionary>
+  static inline FixedArray* GetEnumCache(Dictionary* dict);
+
+  template <typename Dictionary>
+  static inline void SetEnumCache(Dictionary* dict, FixedArray* keys);
+
+  template <typename Dictionary>
+  static inline void InvalidateEnumCache(Dictionary* dict);
 };
 
 
@@ -3745,12 +3776,35 @@ class NameDictionary
 
   static const int kEntryValueIndex = 1;
   static const int kEntryDetailsIndex = 2;
+
+  // Slot holding the keys of the last computed enumeration in enumeration
+  // order, or a non-FixedArray if no valid cache exists. The cache is cleared
+  // whenever an entry or its details are written.
+  static const int kEnumCacheIndex = kNextEnumerationIndexIndex + 1;
+
+  inline bool HasEnumCache();
+  inline FixedArray* GetEnumCache();
+  inline void SetEnumCache(FixedArray* keys);
+  inline void ClearEnumCache();
 };
 
 
 class GlobalDictionaryShape : public NameDictionaryShape {
  public:
   static const int kEntrySize = 2;  // Overrides NameDictionaryShape::kEntrySize
+  static const int kPrefixSize = 2;  // No enum cache slot: enumerability lives
+                                     // in the property cells, which are
+                                     // written without going through the
+                                     // dictionary.
+
+  template <typename Dictionary>
+  static inline FixedArray* GetEnumCache(Dictionary* dict) { return nullptr; }
+
+  template <typename Dictionary>
+  static inline void SetEnumCache(Dictionary* dict, FixedArray* keys) {}
+
+  template <typename Dictionary>
+  static inline void InvalidateEnumCache(Dictionary* dict) {}
 
   template <typename Dictionary>
   static inline PropertyDetails DetailsAt(Dictionary* dict, int entry);
@@ -4668,6 +4722,16 @@ class ByteArray: public FixedArrayBase {
 
 
 // BytecodeArray represents a sequence of interpreter bytecodes.
+//
+// Although the bytecodes are immutable once generated, the array cannot move
+// off the managed heap: the bytecode handlers address operands relative to
+// the tagged BytecodeArray pointer held in the interpreter frame, and the
+// header itself is mutated by the runtime (interrupt budget, OSR nesting
+// level, bytecode age). The GC cost of keeping it on-heap is kept small
+// instead: bytecode arrays and their metadata (constant pool, handler table,
+// source position table) are always pretenured, so they are never copied by
+// scavenges, and the marking visitor only inspects the few tagged header
+// slots, not the bytecodes themselves.
 class BytecodeArray : public FixedArrayBase {
  public:
   static int SizeFor(int length) {
@@ -4692,6 +4756,13 @@ class BytecodeArray : public FixedArrayBase {
   inline int parameter_count() const;
   inline void set_parameter_count(int number_of_parameters);
 
+  // Accessors for the number of registers that have to be saved and restored
+  // when suspending this function. Only registers below this count can be
+  // live across a suspend point; for non-resumable functions it simply equals
+  // the register count.
+  inline int suspended_register_count() const;
+  inline void set_suspended_register_count(int count);
+
   // Accessors for profiling count.
   inline int interrupt_budget() const;
   inline void set_interrupt_budget(int interrupt_budget);
@@ -4700,6 +4771,14 @@ class BytecodeArray : public FixedArrayBase {
   inline int osr_loop_nesting_level() const;
   inline void set_osr_loop_nesting_level(int depth);
 
+  // Accessors for the bytecode age, which counts the number of mark-compact
+  // collections since the function was last executed. The interpreter entry
+  // trampoline resets the age on every invocation.
+  inline int bytecode_age() const;
+  inline void set_bytecode_age(int age);
+  inline void MakeOlder();
+  inline bool IsOld() const;
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4741,9 +4820,17 @@ class BytecodeArray : public FixedArrayBase {
       kHandlerTableOffset + kPointerSize;
   static const int kFrameSizeOffset = kSourcePositionTableOffset + kPointerSize;
   static const int kParameterSizeOffset = kFrameSizeOffset + kIntSize;
-  static const int kInterruptBudgetOffset = kParameterSizeOffset + kIntSize;
+  static const int kSuspendedRegisterCountOffset =
+      kParameterSizeOffset + kIntSize;
+  static const int kInterruptBudgetOffset =
+      kSuspendedRegisterCountOffset + kIntSize;
   static const int kOSRNestingLevelOffset = kInterruptBudgetOffset + kIntSize;
-  static const int kHeaderSize = kOSRNestingLevelOffset + kCharSize;
+  static const int kBytecodeAgeOffset = kOSRNestingLevelOffset + kCharSize;
+  static const int kHeaderSize = kBytecodeAgeOffset + kCharSize;
+
+  // Age of bytecode that was never executed or was executed since the last
+  // mark-compact collection.
+  static const int kNoAgeBytecodeAge = 0;
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -6222,6 +6309,18 @@ class Map: public HeapObject {
                                               Handle<Object> value,
                                               PropertyAttributes attributes,
                                               StoreFromKeyed store_mode);
+  // Builds the final map and full transition chain for an object literal
+  // boilerplate with the given names and values in one pass, starting from
+  // |map| (typically a fresh literal map from the map cache). All
+  // descriptors are accumulated into one descriptor array shared by the
+  // whole chain instead of re-copying the array at every transition.
+  // Returns an empty handle when the shape cannot be built this way (a
+  // transition for the first name already exists, duplicate names, not
+  // enough in-object slack), in which case the properties have to be added
+  // one at a time.
+  MUST_USE_RESULT static MaybeHandle<Map> CreateForLiteral(
+      Handle<Map> map, Handle<FixedArray> names, Handle<FixedArray> values,
+      int number_of_properties);
   static Handle<Map> TransitionToAccessorProperty(
       Isolate* isolate, Handle<Map> map, Handle<Name> name, int descriptor,
       Handle<Object> getter, Handle<Object> setter,
@@ -7306,6 +7405,11 @@ class SharedFunctionInfo: public HeapObject {
   // Indicates that asm->wasm conversion failed and should not be re-attempted.
   DECL_BOOLEAN_ACCESSORS(is_asm_wasm_broken)
 
+  // Indicates that the embedder hinted this function for eager tier-up, so it
+  // should be handed to the optimizing compiler on its first call instead of
+  // waiting for the runtime profiler to observe it as hot.
+  DECL_BOOLEAN_ACCESSORS(marked_for_tier_up)
+
   inline FunctionKind kind();
   inline void set_kind(FunctionKind kind);
 
@@ -7579,6 +7683,7 @@ class SharedFunctionInfo: public HeapObject {
     kDeserialized,
     kIsDeclaration,
     kIsAsmWasmBroken,
+    kMarkedForTierUp,
     kCompilerHintsCount,  // Pseudo entry
   };
   // kFunctionKind has to be byte-aligned
@@ -10334,6 +10439,18 @@ class JSArrayBuffer: public JSObject {
   inline bool is_shared();
   inline void set_is_shared(bool value);
 
+  // [has_guard_region]: backing stores of wasm memories with guard regions
+  // are a single virtual memory reservation of kFullGuardRegionSize bytes
+  // with only the accessible prefix committed. A 32-bit index plus a 32-bit
+  // constant offset always computes an address inside the reservation, which
+  // lets generated code elide explicit bounds checks. Such backing stores
+  // are released as a whole region instead of through the array buffer
+  // allocator.
+  inline bool has_guard_region();
+  inline void set_has_guard_region(bool value);
+
+  static const uint64_t kFullGuardRegionSize = uint64_t{8} * GB;
+
   DECLARE_CAST(JSArrayBuffer)
 
   void Neuter();
@@ -10372,6 +10489,7 @@ class JSArrayBuffer: public JSObject {
   class IsNeuterable : public BitField<bool, 2, 1> {};
   class WasNeutered : public BitField<bool, 3, 1> {};
   class IsShared : public BitField<bool, 4, 1> {};
+  class HasGuardRegion : public BitField<bool, 5, 1> {};
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(JSArrayBuffer);
@@ -10767,6 +10885,7 @@ class InterceptorInfo: public Struct {
   DECL_BOOLEAN_ACCESSORS(can_intercept_symbols)
   DECL_BOOLEAN_ACCESSORS(all_can_read)
   DECL_BOOLEAN_ACCESSORS(non_masking)
+  DECL_BOOLEAN_ACCESSORS(stable_per_map)
 
   inline int flags() const;
   inline void set_flags(int flags);
@@ -10789,6 +10908,7 @@ class InterceptorInfo: public Struct {
   static const int kCanInterceptSymbolsBit = 0;
   static const int kAllCanReadBit = 1;
   static const int kNonMasking = 2;
+  static const int kStablePerMapBit = 3;
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(InterceptorInfo);
@@ -10859,6 +10979,10 @@ class FunctionTemplateInfo: public TemplateInfo {
   DECL_ACCESSORS(instance_call_handler, Object)
   DECL_ACCESSORS(access_check_info, Object)
   DECL_ACCESSORS(shared_function_info, Object)
+  // The instance map shape computed by the first instantiation, before it
+  // is bound to a prototype and constructor. Later instantiations (e.g. in
+  // other contexts) copy it instead of recomputing the shape.
+  DECL_ACCESSORS(cached_template_map, Object)
   DECL_ACCESSORS(js_function, Object)
   DECL_INT_ACCESSORS(flag)
 
@@ -10900,7 +11024,9 @@ class FunctionTemplateInfo: public TemplateInfo {
       kInstanceCallHandlerOffset + kPointerSize;
   static const int kSharedFunctionInfoOffset =
       kAccessCheckInfoOffset + kPointerSize;
-  static const int kFlagOffset = kSharedFunctionInfoOffset + kPointerSize;
+  static const int kCachedTemplateMapOffset =
+      kSharedFunctionInfoOffset + kPointerSize;
+  static const int kFlagOffset = kCachedTemplateMapOffset + kPointerSize;
   static const int kLengthOffset = kFlagOffset + kPointerSize;
   static const int kSize = kLengthOffset + kPointerSize;
 
@@ -10967,6 +11093,20 @@ class DebugInfo: public Struct {
   // Fixed array holding status information for each active break point.
   DECL_ACCESSORS(break_points, FixedArray)
 
+  // [inspection_count]: number of entries recorded while the function is
+  // under lightweight inspection, or undefined when inspection is off.
+  DECL_ACCESSORS(inspection_count, Object)
+  // [inspection_position]: source position of the instrumented entry
+  // location, or undefined when inspection is off.
+  DECL_ACCESSORS(inspection_position, Object)
+  // [inspection_arguments]: the arguments captured at the most recent
+  // recorded entry, or undefined when argument capture is off.
+  DECL_ACCESSORS(inspection_arguments, Object)
+
+  // Whether the function is under lightweight inspection (entry counting
+  // and optional argument capture without debugger attachment).
+  inline bool IsUnderInspection();
+
   // Check if there is a break point at a source position.
   bool HasBreakPoint(int source_position);
   // Attempt to clear a break point. Return true if successful.
@@ -11003,7 +11143,13 @@ class DebugInfo: public Struct {
       kSharedFunctionInfoIndex + kPointerSize;
   static const int kBreakPointsStateIndex =
       kDebugBytecodeArrayIndex + kPointerSize;
-  static const int kSize = kBreakPointsStateIndex + kPointerSize;
+  static const int kInspectionCountIndex =
+      kBreakPointsStateIndex + kPointerSize;
+  static const int kInspectionPositionIndex =
+      kInspectionCountIndex + kPointerSize;
+  static const int kInspectionArgumentsIndex =
+      kInspectionPositionIndex + kPointerSize;
+  static const int kSize = kInspectionArgumentsIndex + kPointerSize;
 
   static const int kEstimatedNofBreakPointsInFunction = 4;
 
@@ -57,6 +57,7 @@ class ParseInfo {
   FLAG_ACCESSOR(kIsNamedExpression, is_named_expression,
                 set_is_named_expression)
   FLAG_ACCESSOR(kCallsEval, calls_eval, set_calls_eval)
+  FLAG_ACCESSOR(kStreamedScript, is_streamed_script, set_streamed_script)
 
 #undef FLAG_ACCESSOR
 
@@ -200,8 +201,9 @@ class ParseInfo {
     kAllowLazyParsing = 1 << 8,
     kIsNamedExpression = 1 << 9,
     kCallsEval = 1 << 10,
+    kStreamedScript = 1 << 11,
     // ---------- Output flags --------------------------
-    kAstValueFactoryOwned = 1 << 11
+    kAstValueFactoryOwned = 1 << 12
   };
 
   //------------- Inputs to parsing and scope analysis -----------------------
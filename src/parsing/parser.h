@@ -75,6 +75,7 @@ class ParseData {
   int FunctionCount();
 
   bool HasError();
+  unsigned SourceHash();
 
   unsigned* Data() {  // Writable data as unsigned int array.
     return reinterpret_cast<unsigned*>(const_cast<byte*>(script_data_->data()));
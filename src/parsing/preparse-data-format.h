@@ -14,14 +14,18 @@ struct PreparseDataConstants {
  public:
   // Layout and constants of the preparse data exchange format.
   static const unsigned kMagicNumber = 0xBadDead;
-  static const unsigned kCurrentVersion = 11;
+  static const unsigned kCurrentVersion = 12;
 
   static const int kMagicOffset = 0;
   static const int kVersionOffset = 1;
   static const int kHasErrorOffset = 2;
-  static const int kFunctionsSizeOffset = 3;
-  static const int kSizeOffset = 4;
-  static const int kHeaderSize = 5;
+  // Hash of the source the data was produced from, so that persisted data
+  // fed back by the embedder is rejected wholesale when it does not match
+  // the script it is used with.
+  static const int kSourceHashOffset = 3;
+  static const int kFunctionsSizeOffset = 4;
+  static const int kSizeOffset = 5;
+  static const int kHeaderSize = 6;
 
   // If encoding a message, the following positions are fixed.
   static const int kMessageStartPos = 0;
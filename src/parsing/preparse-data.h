@@ -187,6 +187,12 @@ class CompleteParserRecorder : public ParserRecorder {
                           const char* argument_opt, ParseErrorType error_type);
   ScriptData* GetScriptData();
 
+  // Records the hash of the source the data is produced from, so consumers
+  // can match persisted data against the script it is fed back with.
+  void SetSourceHash(unsigned hash) {
+    preamble_[PreparseDataConstants::kSourceHashOffset] = hash;
+  }
+
   bool HasError() {
     return static_cast<bool>(preamble_[PreparseDataConstants::kHasErrorOffset]);
   }
@@ -19,11 +19,29 @@ size_t CopyUtf8CharsToUtf16Chars(uint16_t* dest, size_t length, const byte* src,
                                  size_t* src_pos, size_t src_length) {
   static const unibrow::uchar kMaxUtf16Character =
       unibrow::Utf16::kMaxNonSurrogateCharCode;
+  // Mask selecting the high bit of each byte in a word; a word that masks
+  // to zero is a run of one-byte (ASCII) characters.
+  static const uintptr_t kOneByteMask =
+      static_cast<uintptr_t>(V8_UINT64_C(0x8080808080808080));
   size_t i = 0;
   // Because of the UTF-16 lead and trail surrogates, we stop filling the buffer
   // one character early (in the normal case), because we need to have at least
   // two free spaces in the buffer to be sure that the next character will fit.
   while (i < length - 1) {
+    if (*src_pos == src_length) break;
+    // Fast path: bulk-widen whole words of one-byte characters. The widening
+    // loop is simple enough for the compiler to vectorize on SSE2/NEON.
+    while (i + sizeof(uintptr_t) < length - 1 &&
+           *src_pos + sizeof(uintptr_t) <= src_length &&
+           IsAligned(reinterpret_cast<uintptr_t>(src + *src_pos),
+                     sizeof(uintptr_t)) &&
+           (*reinterpret_cast<const uintptr_t*>(src + *src_pos) &
+            kOneByteMask) == 0) {
+      for (size_t j = 0; j < sizeof(uintptr_t); j++) {
+        dest[i++] = src[*src_pos + j];
+      }
+      *src_pos = *src_pos + sizeof(uintptr_t);
+    }
     if (*src_pos == src_length) break;
     unibrow::uchar c = src[*src_pos];
     if (c <= unibrow::Utf8::kMaxOneByteChar) {
@@ -199,6 +217,58 @@ size_t GenericStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
 }
 
 
+// ----------------------------------------------------------------------------
+// SeqOneByteStringUtf16CharacterStream
+
+
+SeqOneByteStringUtf16CharacterStream::SeqOneByteStringUtf16CharacterStream(
+    Handle<String> data, size_t start_position, size_t end_position)
+    : GenericStringUtf16CharacterStream(data, start_position, end_position) {
+  DCHECK(data->IsSeqOneByteString());
+}
+
+
+SeqOneByteStringUtf16CharacterStream::~SeqOneByteStringUtf16CharacterStream() {}
+
+
+size_t SeqOneByteStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
+  if (from_pos >= length_) return 0;
+  size_t length = kBufferSize;
+  if (from_pos + length > length_) {
+    length = length_ - from_pos;
+  }
+  DisallowHeapAllocation no_gc;
+  CopyChars(buffer_, SeqOneByteString::cast(*string_)->GetChars() + from_pos,
+            length);
+  return length;
+}
+
+
+// ----------------------------------------------------------------------------
+// ScannerStream
+
+
+Utf16CharacterStream* ScannerStream::For(Handle<String> data,
+                                         size_t start_position,
+                                         size_t end_position) {
+  if (data->IsExternalTwoByteString()) {
+    return new ExternalTwoByteStringUtf16CharacterStream(
+        Handle<ExternalTwoByteString>::cast(data),
+        static_cast<int>(start_position), static_cast<int>(end_position));
+  } else if (data->IsExternalOneByteString()) {
+    return new ExternalOneByteStringUtf16CharacterStream(
+        Handle<ExternalOneByteString>::cast(data),
+        static_cast<int>(start_position), static_cast<int>(end_position));
+  } else if (data->IsSeqOneByteString()) {
+    return new SeqOneByteStringUtf16CharacterStream(data, start_position,
+                                                    end_position);
+  } else {
+    return new GenericStringUtf16CharacterStream(data, start_position,
+                                                 end_position);
+  }
+}
+
+
 // ----------------------------------------------------------------------------
 // ExternalStreamingStream
 
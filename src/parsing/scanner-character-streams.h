@@ -64,6 +64,33 @@ class GenericStringUtf16CharacterStream: public BufferedUtf16CharacterStream {
 };
 
 
+// Stream for flat sequential one-byte strings. Like the generic stream,
+// but fills its buffer with a straight widening copy out of the string
+// instead of going through String::WriteToFlat's shape dispatch. This is
+// the common shape for short eval and Function constructor sources.
+class SeqOneByteStringUtf16CharacterStream
+    : public GenericStringUtf16CharacterStream {
+ public:
+  SeqOneByteStringUtf16CharacterStream(Handle<String> data,
+                                       size_t start_position,
+                                       size_t end_position);
+  ~SeqOneByteStringUtf16CharacterStream() override;
+
+ protected:
+  size_t FillBuffer(size_t position) override;
+};
+
+
+// Creates the most specialized stream for a string source: external strings
+// get the streams that read off their raw data, flat one-byte strings the
+// widening-copy stream, everything else the generic stream.
+class ScannerStream : public AllStatic {
+ public:
+  static Utf16CharacterStream* For(Handle<String> data, size_t start_position,
+                                   size_t end_position);
+};
+
+
 // ExternalStreamingStream is a wrapper around an ExternalSourceStream (see
 // include/v8.h) subclass implemented by the embedder.
 class ExternalStreamingStream : public BufferedUtf16CharacterStream {
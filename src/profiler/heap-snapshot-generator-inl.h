@@ -39,7 +39,7 @@ int HeapEntry::set_children_index(int index) {
 }
 
 
-HeapGraphEdge** HeapEntry::children_arr() {
+int* HeapEntry::children_arr() {
   DCHECK(children_index_ >= 0);
   SLOW_DCHECK(children_index_ < snapshot_->children().length() ||
       (children_index_ == snapshot_->children().length() &&
@@ -48,6 +48,11 @@ HeapGraphEdge** HeapEntry::children_arr() {
 }
 
 
+HeapGraphEdge* HeapEntry::child(int i) {
+  return &snapshot_->edges()[children_arr()[i]];
+}
+
+
 Isolate* HeapEntry::isolate() const { return snapshot_->profiler()->isolate(); }
 
 }  // namespace internal
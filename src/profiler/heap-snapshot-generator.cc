@@ -97,9 +97,8 @@ void HeapEntry::Print(
     base::OS::Print("\"\n");
   }
   if (--max_depth == 0) return;
-  Vector<HeapGraphEdge*> ch = children();
-  for (int i = 0; i < ch.length(); ++i) {
-    HeapGraphEdge& edge = *ch[i];
+  for (int i = 0; i < children_count(); ++i) {
+    HeapGraphEdge& edge = *child(i);
     const char* edge_prefix = "";
     EmbeddedVector<char, 64> index;
     const char* edge_name = index.start();
@@ -281,7 +280,7 @@ void HeapSnapshot::FillChildren() {
   for (int i = 0; i < edges().length(); ++i) {
     HeapGraphEdge* edge = &edges()[i];
     edge->ReplaceToIndexWithEntry(this);
-    edge->from()->add_child(edge);
+    edge->from()->add_child(i);
   }
 }
 
@@ -1773,12 +1772,30 @@ bool V8HeapExplorer::IterateAndExtractReferences(
   heap_->IterateRoots(&extractor, VISIT_ALL);
   extractor.FillReferences(this);
 
+  // Collect the object list up front: constructing a filtering HeapIterator
+  // runs a full transitive marking pass over the heap, and the two
+  // extraction passes below must observe the same object set anyway.
+  List<HeapObject*> objects;
+  {
+    HeapIterator iterator(heap_, HeapIterator::kFilterUnreachable);
+    for (HeapObject* obj = iterator.next(); obj != NULL;
+         obj = iterator.next()) {
+      objects.Add(obj);
+    }
+  }
+
+  // The buffered object pointers stay valid only as long as the heap does
+  // not move objects; extraction never allocates on the heap.
+  DisallowHeapAllocation no_allocation;
+
   // We have to do two passes as sometimes FixedArrays are used
   // to weakly hold their items, and it's impossible to distinguish
   // between these cases without processing the array owner first.
   bool interrupted =
-      IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass1>() ||
-      IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass2>();
+      IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass1>(
+          objects) ||
+      IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass2>(
+          objects);
 
   if (interrupted) {
     filler_ = NULL;
@@ -1791,16 +1808,12 @@ bool V8HeapExplorer::IterateAndExtractReferences(
 
 
 template<V8HeapExplorer::ExtractReferencesMethod extractor>
-bool V8HeapExplorer::IterateAndExtractSinglePass() {
-  // Now iterate the whole heap.
+bool V8HeapExplorer::IterateAndExtractSinglePass(
+    const List<HeapObject*>& objects) {
   bool interrupted = false;
-  HeapIterator iterator(heap_, HeapIterator::kFilterUnreachable);
-  // Heap iteration with filtering must be finished in any case.
-  for (HeapObject* obj = iterator.next();
-       obj != NULL;
-       obj = iterator.next(), progress_->ProgressStep()) {
-    if (interrupted) continue;
-
+  for (int i = 0; i < objects.length() && !interrupted;
+       ++i, progress_->ProgressStep()) {
+    HeapObject* obj = objects[i];
     size_t max_pointer = obj->Size() / kPointerSize;
     if (max_pointer > marks_.size()) {
       // Clear the current bits.
@@ -2807,11 +2820,13 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
 
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
-  List<HeapGraphEdge*>& edges = snapshot_->children();
-  for (int i = 0; i < edges.length(); ++i) {
+  List<int>& children = snapshot_->children();
+  for (int i = 0; i < children.length(); ++i) {
+    HeapGraphEdge* edge = &snapshot_->edges()[children[i]];
     DCHECK(i == 0 ||
-           edges[i - 1]->from()->index() <= edges[i]->from()->index());
-    SerializeEdge(edges[i], i == 0);
+           snapshot_->edges()[children[i - 1]].from()->index() <=
+               edge->from()->index());
+    SerializeEdge(edge, i == 0);
     if (writer_->aborted()) return;
   }
 }
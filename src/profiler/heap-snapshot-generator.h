@@ -114,11 +114,10 @@ class HeapEntry BASE_EMBEDDED {
   INLINE(int index() const);
   int children_count() const { return children_count_; }
   INLINE(int set_children_index(int index));
-  void add_child(HeapGraphEdge* edge) {
-    children_arr()[children_count_++] = edge;
+  void add_child(int edge_index) {
+    children_arr()[children_count_++] = edge_index;
   }
-  Vector<HeapGraphEdge*> children() {
-    return Vector<HeapGraphEdge*>(children_arr(), children_count_); }
+  INLINE(HeapGraphEdge* child(int i));
   INLINE(Isolate* isolate() const);
 
   void SetIndexedReference(
@@ -130,7 +129,7 @@ class HeapEntry BASE_EMBEDDED {
       const char* prefix, const char* edge_name, int max_depth, int indent);
 
  private:
-  INLINE(HeapGraphEdge** children_arr());
+  INLINE(int* children_arr());
   const char* TypeAsString();
 
   unsigned type_: 4;
@@ -164,7 +163,8 @@ class HeapSnapshot {
   }
   List<HeapEntry>& entries() { return entries_; }
   List<HeapGraphEdge>& edges() { return edges_; }
-  List<HeapGraphEdge*>& children() { return children_; }
+  // Indices into edges_, bucketed per parent entry; see FillChildren().
+  List<int>& children() { return children_; }
   void RememberLastJSObjectId();
   SnapshotObjectId max_snapshot_js_object_id() const {
     return max_snapshot_js_object_id_;
@@ -193,7 +193,8 @@ class HeapSnapshot {
   int gc_subroot_indexes_[VisitorSynchronization::kNumberOfSyncTags];
   List<HeapEntry> entries_;
   List<HeapGraphEdge> edges_;
-  List<HeapGraphEdge*> children_;
+  // Stored as edge indices rather than pointers to halve the side table.
+  List<int> children_;
   List<HeapEntry*> sorted_entries_;
   SnapshotObjectId max_snapshot_js_object_id_;
 
@@ -366,7 +367,7 @@ class V8HeapExplorer : public HeapEntriesAllocator {
   const char* GetSystemEntryName(HeapObject* object);
 
   template<V8HeapExplorer::ExtractReferencesMethod extractor>
-  bool IterateAndExtractSinglePass();
+  bool IterateAndExtractSinglePass(const List<HeapObject*>& objects);
 
   bool ExtractReferencesPass1(int entry, HeapObject* obj);
   bool ExtractReferencesPass2(int entry, HeapObject* obj);
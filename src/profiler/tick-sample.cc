@@ -180,6 +180,16 @@ DISABLE_ASAN void TickSample::Init(Isolate* v8_isolate,
   }
 }
 
+// Samples are kept cheap on purpose: this function only records raw pc
+// values by walking the frame-pointer chain (V8-generated frames always
+// link fp, so no unwind tables are needed), and symbolization happens
+// later on the processor thread in ProfileGenerator::RecordTickSample.
+// TODO(profiler): The remaining per-sample cost is the frame-type
+// classification done by SafeStackFrameIterator. Replacing it with
+// per-code-object frame descriptors emitted at code generation time
+// would require the descriptors to be keyed by code addresses that GC
+// can move, i.e. a signal-safe side table updated on code relocation,
+// which the current code space bookkeeping does not provide.
 bool TickSample::GetStackSample(Isolate* v8_isolate, RegisterState* regs,
                                 RecordCEntryFrame record_c_entry_frame,
                                 void** frames, size_t frames_limit,
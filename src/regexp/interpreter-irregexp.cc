@@ -59,6 +59,15 @@ static bool BackRefMatchesNoCase(Isolate* isolate, int from, int current,
 }
 
 
+// Use token-threaded dispatch when the compiler supports computed gotos
+// (GCC and Clang).  Giving every bytecode handler its own indirect jump
+// lets the branch predictor key on the current bytecode instead of mixing
+// all dispatches in one branch at the top of a loop.  Other compilers fall
+// back to the plain switch.
+#if defined(V8_CC_GNU)
+#define V8_USE_COMPUTED_GOTO 1
+#endif  // defined(V8_CC_GNU)
+
 #ifdef DEBUG
 static void TraceInterpreter(const byte* code_base,
                              const byte* pc,
@@ -97,20 +106,43 @@ static void TraceInterpreter(const byte* code_base,
 }
 
 
-#define BYTECODE(name)                                                      \
-  case BC_##name:                                                           \
-    TraceInterpreter(code_base,                                             \
-                     pc,                                                    \
-                     static_cast<int>(backtrack_sp - backtrack_stack_base), \
-                     current,                                               \
-                     current_char,                                          \
-                     BC_##name##_LENGTH,                                    \
-                     #name);
+#define BYTECODE_TRACE(name)                                                \
+  TraceInterpreter(code_base,                                               \
+                   pc,                                                      \
+                   static_cast<int>(backtrack_sp - backtrack_stack_base),   \
+                   current,                                                 \
+                   current_char,                                            \
+                   BC_##name##_LENGTH,                                      \
+                   #name);
 #else
-#define BYTECODE(name)                                                      \
-  case BC_##name:
+#define BYTECODE_TRACE(name)
 #endif
 
+#if V8_USE_COMPUTED_GOTO
+
+// Every handler is a label; DISPATCH() decodes the next bytecode and jumps
+// straight to its handler.
+#define BC_LABEL(name) BC_##name:
+#define DISPATCH()                                                        \
+  do {                                                                    \
+    insn = Load32Aligned(pc);                                             \
+    DCHECK_LE(insn & BYTECODE_MASK, BC_SET_CURRENT_POSITION_FROM_END);    \
+    goto* dispatch_table[insn & BYTECODE_MASK];                           \
+  } while (false)
+
+#else  // V8_USE_COMPUTED_GOTO
+
+// The handlers are cases of a switch in a loop; ending a handler falls out
+// of the switch and the loop decodes the next bytecode.
+#define BC_LABEL(name) case BC_##name:
+#define DISPATCH() break
+
+#endif  // V8_USE_COMPUTED_GOTO
+
+#define BYTECODE(name) \
+  BC_LABEL(name)       \
+  BYTECODE_TRACE(name)
+
 
 static int32_t Load32Aligned(const byte* pc) {
   DCHECK((reinterpret_cast<intptr_t>(pc) & 3) == 0);
@@ -164,14 +196,30 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
   int* backtrack_stack_base = backtrack_stack.data();
   int* backtrack_sp = backtrack_stack_base;
   int backtrack_stack_space = backtrack_stack.max_size();
+  int32_t insn;
+#if V8_USE_COMPUTED_GOTO
+  // The table of handler addresses, indexed by bytecode.  BYTECODE_ITERATOR
+  // lists the bytecodes in numerical order.
+#define DECLARE_DISPATCH_TABLE_ENTRY(name, code, length) &&BC_##name,
+  static const void* const dispatch_table[] = {
+      BYTECODE_ITERATOR(DECLARE_DISPATCH_TABLE_ENTRY)};
+#undef DECLARE_DISPATCH_TABLE_ENTRY
+  STATIC_ASSERT(arraysize(dispatch_table) ==
+                BC_SET_CURRENT_POSITION_FROM_END + 1);
+#endif  // V8_USE_COMPUTED_GOTO
 #ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     PrintF("\n\nStart bytecode interpreter\n\n");
   }
 #endif
+#if V8_USE_COMPUTED_GOTO
+  DISPATCH();
+  {
+#else
   while (true) {
-    int32_t insn = Load32Aligned(pc);
+    insn = Load32Aligned(pc);
     switch (insn & BYTECODE_MASK) {
+#endif  // V8_USE_COMPUTED_GOTO
       BYTECODE(BREAK)
         UNREACHABLE();
         return RegExpImpl::RE_FAILURE;
@@ -181,65 +229,65 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         }
         *backtrack_sp++ = current;
         pc += BC_PUSH_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(PUSH_BT)
         if (--backtrack_stack_space < 0) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = Load32Aligned(pc + 4);
         pc += BC_PUSH_BT_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(PUSH_REGISTER)
         if (--backtrack_stack_space < 0) {
           return RegExpImpl::RE_EXCEPTION;
         }
         *backtrack_sp++ = registers[insn >> BYTECODE_SHIFT];
         pc += BC_PUSH_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER)
         registers[insn >> BYTECODE_SHIFT] = Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(ADVANCE_REGISTER)
         registers[insn >> BYTECODE_SHIFT] += Load32Aligned(pc + 4);
         pc += BC_ADVANCE_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER_TO_CP)
         registers[insn >> BYTECODE_SHIFT] = current + Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_TO_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_CP_TO_REGISTER)
         current = registers[insn >> BYTECODE_SHIFT];
         pc += BC_SET_CP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_REGISTER_TO_SP)
         registers[insn >> BYTECODE_SHIFT] =
             static_cast<int>(backtrack_sp - backtrack_stack_base);
         pc += BC_SET_REGISTER_TO_SP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(SET_SP_TO_REGISTER)
         backtrack_sp = backtrack_stack_base + registers[insn >> BYTECODE_SHIFT];
         backtrack_stack_space = backtrack_stack.max_size() -
             static_cast<int>(backtrack_sp - backtrack_stack_base);
         pc += BC_SET_SP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(POP_CP)
         backtrack_stack_space++;
         --backtrack_sp;
         current = *backtrack_sp;
         pc += BC_POP_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(POP_BT)
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
-        break;
+        DISPATCH();
       BYTECODE(POP_REGISTER)
         backtrack_stack_space++;
         --backtrack_sp;
         registers[insn >> BYTECODE_SHIFT] = *backtrack_sp;
         pc += BC_POP_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(FAIL)
         return RegExpImpl::RE_FAILURE;
       BYTECODE(SUCCEED)
@@ -247,14 +295,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
       BYTECODE(ADVANCE_CP)
         current += insn >> BYTECODE_SHIFT;
         pc += BC_ADVANCE_CP_LENGTH;
-        break;
+        DISPATCH();
       BYTECODE(GOTO)
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
       BYTECODE(ADVANCE_CP_AND_GOTO)
         current += insn >> BYTECODE_SHIFT;
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
       BYTECODE(CHECK_GREEDY)
         if (current == backtrack_sp[-1]) {
           backtrack_sp--;
@@ -263,7 +311,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GREEDY_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(LOAD_CURRENT_CHAR) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         if (pos >= subject.length() || pos < 0) {
@@ -272,13 +320,13 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           current_char = subject[pos];
           pc += BC_LOAD_CURRENT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_CURRENT_CHAR_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         current_char = subject[pos];
         pc += BC_LOAD_CURRENT_CHAR_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS) {
         int pos = current + (insn >> BYTECODE_SHIFT);
@@ -290,14 +338,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
               (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
           pc += BC_LOAD_2_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         Char next = subject[pos + 1];
         current_char = (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
         pc += BC_LOAD_2_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS) {
         DCHECK(sizeof(Char) == 1);
@@ -314,7 +362,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                           (next3 << 24));
           pc += BC_LOAD_4_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS_UNCHECKED) {
         DCHECK(sizeof(Char) == 1);
@@ -327,7 +375,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                         (next2 << 16) |
                         (next3 << 24));
         pc += BC_LOAD_4_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -336,7 +384,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -345,7 +393,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -354,7 +402,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -363,7 +411,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -372,7 +420,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -381,7 +429,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -390,7 +438,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -399,7 +447,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(MINUS_AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -410,7 +458,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_MINUS_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -420,7 +468,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_NOT_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -430,7 +478,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_NOT_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_BIT_IN_TABLE) {
         int mask = RegExpMacroAssembler::kTableMask;
@@ -441,7 +489,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_BIT_IN_TABLE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_LT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -450,7 +498,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_GT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -459,7 +507,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_REGISTER_LT)
         if (registers[insn >> BYTECODE_SHIFT] < Load32Aligned(pc + 4)) {
@@ -467,21 +515,21 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_REGISTER_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_REGISTER_GE)
         if (registers[insn >> BYTECODE_SHIFT] >= Load32Aligned(pc + 4)) {
           pc = code_base + Load32Aligned(pc + 8);
         } else {
           pc += BC_CHECK_REGISTER_GE_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_REGISTER_EQ_POS)
         if (registers[insn >> BYTECODE_SHIFT] == current) {
           pc = code_base + Load32Aligned(pc + 4);
         } else {
           pc += BC_CHECK_REGISTER_EQ_POS_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_REGS_EQUAL)
         if (registers[insn >> BYTECODE_SHIFT] ==
             registers[Load32Aligned(pc + 4)]) {
@@ -489,7 +537,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc = code_base + Load32Aligned(pc + 8);
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_BACK_REF) {
         int from = registers[insn >> BYTECODE_SHIFT];
         int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
@@ -497,12 +545,12 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           if (current + len > subject.length() ||
               CompareChars(&subject[from], &subject[current], len) != 0) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current += len;
         }
         pc += BC_CHECK_NOT_BACK_REF_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF_BACKWARD) {
         int from = registers[insn >> BYTECODE_SHIFT];
@@ -511,12 +559,12 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           if (current - len < 0 ||
               CompareChars(&subject[from], &subject[current - len], len) != 0) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current -= len;
         }
         pc += BC_CHECK_NOT_BACK_REF_BACKWARD_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE)
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE) {
@@ -529,12 +577,12 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
               !BackRefMatchesNoCase(isolate, from, current, len, subject,
                                     unicode)) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current += len;
         }
         pc += BC_CHECK_NOT_BACK_REF_NO_CASE_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD)
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_BACKWARD) {
@@ -547,12 +595,12 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
               !BackRefMatchesNoCase(isolate, from, current - len, len, subject,
                                     unicode)) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current -= len;
         }
         pc += BC_CHECK_NOT_BACK_REF_NO_CASE_BACKWARD_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_AT_START)
         if (current == 0) {
@@ -560,14 +608,14 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_AT_START_LENGTH;
         }
-        break;
+        DISPATCH();
       BYTECODE(CHECK_NOT_AT_START)
         if (current + (insn >> BYTECODE_SHIFT) == 0) {
           pc += BC_CHECK_NOT_AT_START_LENGTH;
         } else {
           pc = code_base + Load32Aligned(pc + 4);
         }
-        break;
+        DISPATCH();
       BYTECODE(SET_CURRENT_POSITION_FROM_END) {
         int by = static_cast<uint32_t>(insn) >> BYTECODE_SHIFT;
         if (subject.length() - current > by) {
@@ -575,13 +623,21 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
           current_char = subject[current - 1];
         }
         pc += BC_SET_CURRENT_POSITION_FROM_END_LENGTH;
-        break;
+        DISPATCH();
       }
+#if V8_USE_COMPUTED_GOTO
+  }
+  // Every handler dispatches directly to the next one, so this point is
+  // never reached.
+  UNREACHABLE();
+  return RegExpImpl::RE_EXCEPTION;
+#else
       default:
         UNREACHABLE();
         break;
     }
   }
+#endif  // V8_USE_COMPUTED_GOTO
 }
 
 
@@ -401,6 +401,11 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
   }
 
+  // The data array now holds compiled code, which is the expensive part to
+  // lose; refresh the compilation cache entry so the code survives cache
+  // aging and is found by regexps created in other contexts.
+  isolate->compilation_cache()->PutRegExp(pattern, flags, data);
+
   return true;
 }
 
@@ -3821,6 +3826,15 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
+    // A vectorized scan in C beats the character-at-a-time loop below, but
+    // it can only be used when every character is probed, and not every
+    // assembler provides one.
+    unsigned mask = String::kMaxUtf16CodeUnit;
+    if (max_char_ > kSize) mask = RegExpMacroAssembler::kTableMask;
+    if (lookahead_width == 1 &&
+        masm->SkipUntilCharacter(max_lookahead, single_character, mask)) {
+      return;
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
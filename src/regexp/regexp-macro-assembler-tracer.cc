@@ -288,6 +288,22 @@ void RegExpMacroAssemblerTracer::CheckNotCharacterAfterAnd(
 }
 
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacter(int cp_offset,
+                                                    unsigned character,
+                                                    unsigned mask) {
+  bool emitted = assembler_->SkipUntilCharacter(cp_offset, character, mask);
+  if (emitted) {
+    PrintablePrinter printable(character);
+    PrintF(" SkipUntilCharacter(cp_offset=%d, c=0x%04x%s, mask=0x%04x);\n",
+           cp_offset,
+           character,
+           *printable,
+           mask);
+  }
+  return emitted;
+}
+
+
 void RegExpMacroAssemblerTracer::CheckNotCharacterAfterMinusAnd(
     uc16 c,
     uc16 minus,
@@ -4,6 +4,8 @@
 
 #include "src/regexp/regexp-macro-assembler.h"
 
+#include <string.h>
+
 #include "src/assembler.h"
 #include "src/isolate-inl.h"
 #include "src/regexp/regexp-stack.h"
@@ -110,6 +112,11 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+bool RegExpMacroAssembler::SkipUntilCharacter(int cp_offset, unsigned character,
+                                              unsigned mask) {
+  return false;
+}
+
 #ifndef V8_INTERPRETED_REGEXP  // Avoid unused code, e.g., on ARM.
 
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
@@ -289,6 +296,57 @@ NativeRegExpMacroAssembler::Result NativeRegExpMacroAssembler::Execute(
 }
 
 
+Address NativeRegExpMacroAssembler::SkipUntilCharacterLatin1(
+    Address start, Address end, uint32_t character, uint32_t mask) {
+  // This function is not allowed to cause a garbage collection.
+  // A GC might move the calling generated code and invalidate the
+  // return address on the stack.
+  if (start >= end) return start;
+  size_t length = end - start;
+  if ((mask & String::kMaxOneByteCharCode) == String::kMaxOneByteCharCode) {
+    // The mask keeps every bit of a one-byte character, so this is a search
+    // for an exact character value.
+    const void* match = memchr(start, character, length);
+    return match == NULL ? end
+                         : reinterpret_cast<Address>(const_cast<void*>(match));
+  }
+  // Generated code compares characters after and-ing them with the mask, so
+  // a one-byte character matches both with and without the masked-out bits
+  // set.  Search for both values and take the nearer match.
+  DCHECK_EQ(static_cast<uint32_t>(RegExpMacroAssembler::kTableMask), mask);
+  const void* low = memchr(start, character, length);
+  const void* high =
+      memchr(start, character | (~mask & String::kMaxOneByteCharCode), length);
+  const void* match = low;
+  if (match == NULL || (high != NULL && high < match)) match = high;
+  return match == NULL ? end
+                       : reinterpret_cast<Address>(const_cast<void*>(match));
+}
+
+
+Address NativeRegExpMacroAssembler::SkipUntilCharacterUC16(Address start,
+                                                           Address end,
+                                                           uint32_t character,
+                                                           uint32_t mask) {
+  // This function is not allowed to cause a garbage collection.
+  // A GC might move the calling generated code and invalidate the
+  // return address on the stack.
+  if (start >= end) return start;
+  DCHECK((end - start) % sizeof(uc16) == 0);
+  const uc16* cursor = reinterpret_cast<const uc16*>(start);
+  const uc16* limit = reinterpret_cast<const uc16*>(end);
+  // A plain comparison loop; with the mask and character loop-invariant the
+  // compiler turns this into vector code where that pays off.
+  while (cursor < limit) {
+    if ((*cursor & mask) == character) {
+      return reinterpret_cast<Address>(const_cast<uc16*>(cursor));
+    }
+    cursor++;
+  }
+  return end;
+}
+
+
 const byte NativeRegExpMacroAssembler::word_character_map[] = {
     0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
     0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
@@ -148,6 +148,13 @@ class RegExpMacroAssembler {
   virtual void ReadStackPointerFromRegister(int reg) = 0;
   virtual void SetCurrentPositionFromEnd(int by) = 0;
   virtual void SetRegister(int register_index, int to) = 0;
+  // Emits a scan that advances the current position until the character
+  // |cp_offset| past it equals |character| after and-ing with |mask|, or
+  // until that character would be outside the input.  Returns false if the
+  // assembler has no support for such a scan, in which case the caller must
+  // emit an explicit character-by-character loop instead.
+  virtual bool SkipUntilCharacter(int cp_offset, unsigned character,
+                                  unsigned mask);
   // Return whether the matching (with a global regexp) will be restarted.
   virtual bool Succeed() = 0;
   virtual void WriteCurrentPositionToRegister(int reg, int cp_offset) = 0;
@@ -232,6 +239,16 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
 
   static const byte* StringCharacterPosition(String* subject, int start_index);
 
+  // Scans [start, end) for the first character that equals |character| after
+  // and-ing with |mask|.  Returns the address of the match, |end| if there is
+  // none, or |start| if the range is empty.
+  // Called from generated RegExp code.
+  // These functions must not trigger a garbage collection.
+  static Address SkipUntilCharacterLatin1(Address start, Address end,
+                                          uint32_t character, uint32_t mask);
+  static Address SkipUntilCharacterUC16(Address start, Address end,
+                                        uint32_t character, uint32_t mask);
+
   static int CheckStackGuardState(Isolate* isolate, int start_index,
                                   bool is_direct_call, Address* return_address,
                                   Code* re_code, String** subject,
@@ -1140,6 +1140,73 @@ void RegExpMacroAssemblerX64::SetRegister(int register_index, int to) {
 }
 
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacter(int cp_offset,
+                                                 unsigned character,
+                                                 unsigned mask) {
+  // Scan for the character in C code, which uses vectorized comparisons
+  // instead of probing one character per loop iteration.
+  // Save important/volatile registers before calling C function.
+#ifndef _WIN64
+  // Caller save on Linux and callee save in Windows.
+  __ pushq(rsi);
+  __ pushq(rdi);
+#endif
+  __ pushq(backtrack_stackpointer());
+
+  static const int num_arguments = 4;
+  __ PrepareCallCFunction(num_arguments);
+
+  // Put arguments into parameter registers. Parameters are
+  //   Address start - Address of the first character to scan.
+  //   Address end - Address of the end of the input string.
+  //   uint32_t character - The character to scan for.
+  //   uint32_t mask - Mask and-ed onto each character before comparing.
+#ifdef _WIN64
+  DCHECK(rcx.is(arg_reg_1));
+  DCHECK(rdx.is(arg_reg_2));
+  // Compute and set the scan start (current position + cp_offset).
+  __ leap(rcx, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+  // Set the end of the input string.
+  __ movp(rdx, rsi);
+#else  // AMD64 calling convention
+  DCHECK(rdi.is(arg_reg_1));
+  DCHECK(rsi.is(arg_reg_2));
+  // Compute and set the scan start (current position + cp_offset).
+  // rsi already holds the end of the input string.
+  __ leap(rdi, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+#endif
+  __ movp(arg_reg_3, Immediate(character));
+  __ movp(arg_reg_4, Immediate(mask));
+
+  { // NOLINT: Can't find a way to open this scope without confusing the
+    // linter.
+    AllowExternalCallThatCantCauseGC scope(&masm_);
+    ExternalReference skip =
+        mode_ == LATIN1
+            ? ExternalReference::re_skip_until_character_latin1(isolate())
+            : ExternalReference::re_skip_until_character_uc16(isolate());
+    __ CallCFunction(skip, num_arguments);
+  }
+
+  // Restore original values before reacting on result value.
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  __ popq(backtrack_stackpointer());
+#ifndef _WIN64
+  __ popq(rdi);
+  __ popq(rsi);
+#endif
+
+  // The result is the address of the match, the end of the input if there
+  // was none, or the scan start if the scan began outside the input.  Turn
+  // it back into an offset of the current position from the end of the
+  // input; the bounds check of the next character load detects the
+  // no-match case.
+  __ subp(rax, rsi);
+  __ leap(rdi, Operand(rax, -cp_offset * char_size()));
+  return true;
+}
+
+
 bool RegExpMacroAssemblerX64::Succeed() {
   __ jmp(&success_label_);
   return global();
@@ -4,6 +4,9 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/arguments.h"
 #include "src/code-stubs.h"
 #include "src/conversions-inl.h"
@@ -124,6 +127,175 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+namespace {
+
+// TimSort for smi values in the lexicographic order of their string
+// representations, i.e. the order the default Array.prototype.sort
+// comparator produces for smi-only arrays. Runs are detected and kept,
+// short runs are extended by binary insertion sort, and adjacent runs are
+// merged with a scratch buffer; the galloping mode of the original
+// algorithm is omitted.
+
+inline bool SmiLexicographicLess(int x, int y) {
+  return Smi::LexicographicCompare(x, y) < 0;
+}
+
+// Short runs are extended to this length (or less, at the end of the
+// array) before being merged, as in the original algorithm.
+int ComputeMinRunLength(int length) {
+  int r = 0;
+  while (length >= 64) {
+    r |= length & 1;
+    length >>= 1;
+  }
+  return length + r;
+}
+
+// Sorts [from, to), assuming [from, start) is already sorted.
+void BinaryInsertionSort(int* a, int from, int start, int to) {
+  for (int i = start; i < to; i++) {
+    int pivot = a[i];
+    int left = from;
+    int right = i;
+    while (left < right) {
+      int mid = left + ((right - left) >> 1);
+      if (SmiLexicographicLess(pivot, a[mid])) {
+        right = mid;
+      } else {
+        left = mid + 1;
+      }
+    }
+    for (int j = i; j > left; j--) a[j] = a[j - 1];
+    a[left] = pivot;
+  }
+}
+
+// Returns the length of the maximal ascending or strictly descending run
+// starting at |from|; descending runs are reversed in place.
+int CountRunAndMakeAscending(int* a, int from, int to) {
+  int run_end = from + 1;
+  if (run_end == to) return 1;
+  if (SmiLexicographicLess(a[run_end++], a[from])) {
+    while (run_end < to && SmiLexicographicLess(a[run_end], a[run_end - 1])) {
+      run_end++;
+    }
+    std::reverse(a + from, a + run_end);
+  } else {
+    while (run_end < to && !SmiLexicographicLess(a[run_end], a[run_end - 1])) {
+      run_end++;
+    }
+  }
+  return run_end - from;
+}
+
+// Merges the adjacent sorted runs [from, mid) and [mid, to).
+void MergeRuns(int* a, int from, int mid, int to, std::vector<int>* scratch) {
+  scratch->assign(a + from, a + mid);
+  int i = 0;
+  int i_end = mid - from;
+  int j = mid;
+  int k = from;
+  while (i < i_end && j < to) {
+    // Take from the right run only on strict less-than to keep the merge
+    // stable.
+    a[k++] = SmiLexicographicLess(a[j], (*scratch)[i]) ? a[j++]
+                                                       : (*scratch)[i++];
+  }
+  while (i < i_end) a[k++] = (*scratch)[i++];
+}
+
+void TimSort(int* a, int length) {
+  if (length < 2) return;
+  int min_run_length = ComputeMinRunLength(length);
+  std::vector<int> scratch;
+  // The merge invariants below bound the number of pending runs
+  // logarithmically in the array length; 40 entries cover any smi length.
+  struct {
+    int base;
+    int length;
+  } runs[40];
+  int stack_size = 0;
+  int from = 0;
+  while (from < length) {
+    int run_length = CountRunAndMakeAscending(a, from, length);
+    if (run_length < min_run_length) {
+      int forced = Min(min_run_length, length - from);
+      BinaryInsertionSort(a, from, from + run_length, from + forced);
+      run_length = forced;
+    }
+    DCHECK_LT(stack_size, static_cast<int>(arraysize(runs)));
+    runs[stack_size].base = from;
+    runs[stack_size].length = run_length;
+    stack_size++;
+    from += run_length;
+    // Restore the invariants runs[n - 1].length > runs[n].length +
+    // runs[n + 1].length and runs[n].length > runs[n + 1].length by
+    // merging, preferring the smaller neighbor of the violating run.
+    while (stack_size > 1) {
+      int n = stack_size - 2;
+      if ((n > 0 &&
+           runs[n - 1].length <= runs[n].length + runs[n + 1].length) ||
+          (n > 1 &&
+           runs[n - 2].length <= runs[n - 1].length + runs[n].length)) {
+        if (runs[n - 1].length < runs[n + 1].length) n--;
+      } else if (runs[n].length > runs[n + 1].length) {
+        break;
+      }
+      MergeRuns(a, runs[n].base, runs[n + 1].base,
+                runs[n + 1].base + runs[n + 1].length, &scratch);
+      runs[n].length += runs[n + 1].length;
+      if (n == stack_size - 3) runs[n + 1] = runs[n + 2];
+      stack_size--;
+    }
+  }
+  while (stack_size > 1) {
+    int n = stack_size - 2;
+    MergeRuns(a, runs[n].base, runs[n + 1].base,
+              runs[n + 1].base + runs[n + 1].length, &scratch);
+    runs[n].length += runs[n + 1].length;
+    stack_size--;
+  }
+}
+
+}  // namespace
+
+
+// Sorts the first |length| elements of a smi-only array in the order the
+// default Array.prototype.sort comparator produces. Returns true on success
+// and false if the array is not eligible, in which case the caller falls
+// back to the self-hosted sort.
+RUNTIME_FUNCTION(Runtime_SortSmiElements) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSObject, object, 0);
+  CONVERT_SMI_ARG_CHECKED(length, 1);
+  if (!object->IsJSArray() || !object->HasFastSmiElements() || length < 0) {
+    return isolate->heap()->false_value();
+  }
+  JSObject::EnsureWritableFastElements(object);
+  Handle<FixedArray> elements(FixedArray::cast(object->elements()), isolate);
+  if (length > elements->length()) return isolate->heap()->false_value();
+  std::vector<int> values;
+  values.reserve(length);
+  {
+    DisallowHeapAllocation no_gc;
+    for (int i = 0; i < length; i++) {
+      Object* element = elements->get(i);
+      // Holes have been moved past |length| by %RemoveArrayHoles, but be
+      // defensive about other callers.
+      if (!element->IsSmi()) return isolate->heap()->false_value();
+      values.push_back(Smi::cast(element)->value());
+    }
+  }
+  TimSort(values.data(), length);
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < length; i++) {
+    elements->set(i, Smi::FromInt(values[i]), SKIP_WRITE_BARRIER);
+  }
+  return isolate->heap()->true_value();
+}
+
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
@@ -169,6 +169,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
 
   Handle<JSFunction> function = deoptimizer->function();
   Handle<Code> optimized_code = deoptimizer->compiled_code();
+  DeoptimizeReason deopt_reason = deoptimizer->deopt_reason();
 
   DCHECK(optimized_code->kind() == Code::OPTIMIZED_FUNCTION);
   DCHECK(type == deoptimizer->bailout_type());
@@ -183,6 +184,11 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  // Aggregate the executed deoptimization now that the isolate is back in a
+  // consistent state; this may invoke the embedder's hot-deopt callback.
+  isolate->deoptimizer_data()->statistics()->RecordDeopt(
+      isolate, handle(function->shared(), isolate), deopt_reason);
+
   if (type == Deoptimizer::LAZY) {
     return isolate->heap()->undefined_value();
   }
@@ -321,6 +321,58 @@ RUNTIME_FUNCTION(Runtime_DebugGetInternalProperties) {
 }
 
 
+// Start lightweight inspection of the given function: count its entries
+// and, if requested, capture the arguments of the most recent entry.
+// Returns whether inspection was started.
+RUNTIME_FUNCTION(Runtime_DebugStartFunctionInspection) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(capture_arguments, 1);
+  return isolate->heap()->ToBoolean(
+      isolate->debug()->StartFunctionInspection(function, capture_arguments));
+}
+
+
+RUNTIME_FUNCTION(Runtime_DebugStopFunctionInspection) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  isolate->debug()->StopFunctionInspection(function);
+  return isolate->heap()->undefined_value();
+}
+
+
+// Get the data recorded for a function under lightweight inspection, in the
+// following format:
+// 0: Number of recorded entries
+// 1: Arguments of the most recent entry, or undefined when argument capture
+//    is off
+// Returns undefined if the function is not under inspection.
+RUNTIME_FUNCTION(Runtime_DebugGetFunctionInspectionData) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (!shared->HasDebugInfo()) return isolate->heap()->undefined_value();
+  Handle<DebugInfo> debug_info(shared->GetDebugInfo());
+  if (!debug_info->IsUnderInspection()) {
+    return isolate->heap()->undefined_value();
+  }
+  Handle<FixedArray> details = isolate->factory()->NewFixedArray(2);
+  details->set(0, debug_info->inspection_count());
+  if (debug_info->inspection_arguments()->IsFixedArray()) {
+    Handle<FixedArray> arguments(
+        FixedArray::cast(debug_info->inspection_arguments()));
+    // Hand out a copy; the stored array is replaced on the next entry.
+    Handle<JSArray> argument_array = isolate->factory()->NewJSArrayWithElements(
+        isolate->factory()->CopyFixedArray(arguments));
+    details->set(1, *argument_array);
+  }
+  return *isolate->factory()->NewJSArrayWithElements(details);
+}
+
+
 // Get debugger related details for an object property, in the following format:
 // 0: Property value
 // 1: Property details
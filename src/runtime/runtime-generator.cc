@@ -24,7 +24,7 @@ RUNTIME_FUNCTION(Runtime_CreateJSGeneratorObject) {
   if (function->shared()->HasBytecodeArray()) {
     // New-style generators.
     DCHECK(!function->shared()->HasBaselineCode());
-    int size = function->shared()->bytecode_array()->register_count();
+    int size = function->shared()->bytecode_array()->suspended_register_count();
     operand_stack = isolate->factory()->NewFixedArray(size);
   } else {
     // Old-style generators.
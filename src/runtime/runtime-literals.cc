@@ -52,6 +52,56 @@ MUST_USE_RESULT static MaybeHandle<Object> CreateObjectLiteralBoilerplate(
   PretenureFlag pretenure_flag =
       isolate->heap()->InNewSpace(*literals) ? NOT_TENURED : TENURED;
 
+  // For a fresh shape with only named properties, build the final map and
+  // its transition chain in one pass with a single shared descriptor array,
+  // instead of copying maps and descriptor arrays one property at a time.
+  // Nested literals are materialized up front since the boilerplate values
+  // reference them.
+  if (is_result_from_cache) {
+    int number_of_properties = constant_properties->length() / 2;
+    Handle<FixedArray> names =
+        isolate->factory()->NewFixedArray(number_of_properties);
+    Handle<FixedArray> values =
+        isolate->factory()->NewFixedArray(number_of_properties);
+    bool all_named = true;
+    for (int index = 0; index < constant_properties->length(); index += 2) {
+      Handle<Object> key(constant_properties->get(index + 0), isolate);
+      uint32_t element_index = 0;
+      if (key->ToArrayIndex(&element_index)) {
+        all_named = false;
+        break;
+      }
+      Handle<Object> value(constant_properties->get(index + 1), isolate);
+      if (value->IsFixedArray()) {
+        // The value contains the constant_properties of a
+        // simple object or array literal.
+        Handle<FixedArray> array = Handle<FixedArray>::cast(value);
+        ASSIGN_RETURN_ON_EXCEPTION(
+            isolate, value, CreateLiteralBoilerplate(isolate, literals, array),
+            Object);
+      }
+      names->set(index / 2, *key);
+      values->set(index / 2, *value);
+    }
+    Handle<Map> final_map;
+    if (all_named &&
+        Map::CreateForLiteral(map, names, values, number_of_properties)
+            .ToHandle(&final_map)) {
+      Handle<JSObject> boilerplate =
+          isolate->factory()->NewJSObjectFromMap(final_map, pretenure_flag);
+      if (!should_have_fast_elements) JSObject::NormalizeElements(boilerplate);
+      DisallowHeapAllocation no_gc;
+      DescriptorArray* descriptors = final_map->instance_descriptors();
+      for (int i = 0; i < number_of_properties; i++) {
+        PropertyDetails details = descriptors->GetDetails(i);
+        // Constant function values already live in the descriptor array.
+        if (details.type() != DATA) continue;
+        boilerplate->WriteToField(i, details, values->get(i));
+      }
+      return boilerplate;
+    }
+  }
+
   Handle<JSObject> boilerplate =
       isolate->factory()->NewJSObjectFromMap(map, pretenure_flag);
 
@@ -6,6 +6,7 @@
 
 #include "src/arguments.h"
 #include "src/assembler.h"
+#include "src/base/ieee754.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
@@ -13,6 +14,73 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Operations understood by Runtime_MathMapFloat64Array. Callers pass the
+// matching small integer as the third argument.
+enum MapOperation {
+  kMapExp = 0,
+  kMapLog = 1,
+  kMapSin = 2,
+  kMapCos = 3,
+  kMapTan = 4,
+  kLastMapOperation = kMapTan
+};
+
+}  // namespace
+
+// Applies a math kernel elementwise to a Float64Array, writing the results
+// into another (or the same) Float64Array. This turns the per-element call
+// overhead of mapping e.g. Math.exp over a typed array from JS into one
+// runtime call and a streaming loop over the backing stores.
+RUNTIME_FUNCTION(Runtime_MathMapFloat64Array) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 3);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, target, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, source, 1);
+  CONVERT_SMI_ARG_CHECKED(operation, 2);
+  CHECK(operation >= 0 && operation <= kLastMapOperation);
+  CHECK(target->type() == kExternalFloat64Array);
+  CHECK(source->type() == kExternalFloat64Array);
+  CHECK(!target->WasNeutered());
+  CHECK(!source->WasNeutered());
+  size_t length = NumberToSize(source->length());
+  CHECK(NumberToSize(target->length()) >= length);
+
+  // Materialize the backing stores before taking raw pointers; GetBuffer()
+  // may allocate for on-heap typed arrays.
+  Handle<JSArrayBuffer> target_buffer = target->GetBuffer();
+  Handle<JSArrayBuffer> source_buffer = source->GetBuffer();
+
+  DisallowHeapAllocation no_gc;
+  const double* input = reinterpret_cast<const double*>(
+      static_cast<uint8_t*>(source_buffer->backing_store()) +
+      NumberToSize(source->byte_offset()));
+  double* output = reinterpret_cast<double*>(
+      static_cast<uint8_t*>(target_buffer->backing_store()) +
+      NumberToSize(target->byte_offset()));
+  switch (operation) {
+    case kMapExp:
+      base::ieee754::exp(input, output, length);
+      break;
+    case kMapLog:
+      base::ieee754::log(input, output, length);
+      break;
+    case kMapSin:
+      base::ieee754::sin(input, output, length);
+      break;
+    case kMapCos:
+      base::ieee754::cos(input, output, length);
+      break;
+    case kMapTan:
+      base::ieee754::tan(input, output, length);
+      break;
+    default:
+      UNREACHABLE();
+  }
+  return *target;
+}
+
 RUNTIME_FUNCTION(Runtime_GenerateRandomNumbers) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
@@ -464,6 +464,90 @@ MUST_USE_RESULT static Object* StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Two-pass version of StringReplaceGlobalRegExpWithString for replacement
+// strings without '$' substitutions: collect the match extents into a zone
+// list first, then build the result with a single exact-size allocation and
+// bulk copies instead of accumulating a part per segment.
+template <typename ResultSeqString>
+MUST_USE_RESULT static Object* StringReplaceGlobalSimpleRegExpWithString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<JSObject> last_match_info,
+    RegExpImpl::GlobalCache* global_cache, int32_t* current_match, Zone* zone) {
+  int subject_length = subject->length();
+  int replacement_len = replacement->length();
+
+  // Collect the extents of all matches.
+  ZoneList<int> extents(8, zone);
+  int64_t matched_chars = 0;
+  do {
+    int start = current_match[0];
+    int end = current_match[1];
+    extents.Add(start, zone);
+    extents.Add(end, zone);
+    matched_chars += end - start;
+    current_match = global_cache->FetchNext();
+  } while (current_match != NULL);
+
+  if (global_cache->HasException()) return isolate->heap()->exception();
+
+  int matches = extents.length() / 2;
+
+  // Detect integer overflow.
+  int64_t result_len_64 = static_cast<int64_t>(subject_length) - matched_chars +
+                          static_cast<int64_t>(replacement_len) * matches;
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    STATIC_ASSERT(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, untyped_res, maybe_res);
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  int prev = 0;
+  int position = 0;
+  for (int i = 0; i < matches; i++) {
+    int start = extents.at(2 * i);
+    int end = extents.at(2 * i + 1);
+
+    // Copy non-matched subject content.
+    if (prev < start) {
+      String::WriteToFlat(*subject, result->GetChars() + position, prev, start);
+      position += start - prev;
+    }
+
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars() + position, 0,
+                          replacement_len);
+      position += replacement_len;
+    }
+
+    prev = end;
+  }
+  // Add remaining subject content at the end.
+  if (prev < subject_length) {
+    String::WriteToFlat(*subject, result->GetChars() + position, prev,
+                        subject_length);
+    position += subject_length - prev;
+  }
+  DCHECK_EQ(result_len, position);
+
+  RegExpImpl::SetLastMatchInfo(last_match_info, subject, regexp->CaptureCount(),
+                               global_cache->LastSuccessfulMatch());
+
+  return *result;
+}
+
 MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<JSObject> last_match_info) {
@@ -499,6 +583,21 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
     return *subject;
   }
 
+  if (simple_replace) {
+    // The replacement is a literal string, so the result length is known
+    // once all match extents have been collected and the result can be
+    // filled with bulk copies.
+    if (subject->HasOnlyOneByteChars() && replacement->HasOnlyOneByteChars()) {
+      return StringReplaceGlobalSimpleRegExpWithString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info, &global_cache,
+          current_match, zone_scope.zone());
+    } else {
+      return StringReplaceGlobalSimpleRegExpWithString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info, &global_cache,
+          current_match, zone_scope.zone());
+    }
+  }
+
   // Guessing the number of parts that the final result string is built
   // from. Global regexps can match any number of times, so we guess
   // conservatively.
@@ -522,11 +621,7 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
       builder.AddSubjectSlice(prev, start);
     }
 
-    if (simple_replace) {
-      builder.AddString(replacement);
-    } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
-    }
+    compiled_replacement.Apply(&builder, start, end, current_match);
     prev = end;
 
     current_match = global_cache.FetchNext();
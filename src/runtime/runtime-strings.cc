@@ -4,6 +4,10 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "src/arguments.h"
 #include "src/regexp/jsregexp-inl.h"
 #include "src/string-builder.h"
@@ -932,6 +936,30 @@ static bool FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(dst), sizeof(uintptr_t)));
+#if defined(__SSE2__)
+  // Process 16 bytes at a time with unaligned loads. This also covers
+  // sources that are not word-aligned and would otherwise fall through to
+  // the byte-wise loop below.
+  const __m128i lo_v = _mm_set1_epi8(lo);
+  const __m128i hi_v = _mm_set1_epi8(hi);
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  __m128i or_acc_v = _mm_setzero_si128();
+  while (src <= limit - 16) {
+    const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    or_acc_v = _mm_or_si128(or_acc_v, w);
+    // Bytes that need conversion compare as 0xff; non-ASCII bytes are
+    // negative in the signed comparison and never match.
+    const __m128i m =
+        _mm_and_si128(_mm_cmpgt_epi8(w, lo_v), _mm_cmplt_epi8(w, hi_v));
+    if (_mm_movemask_epi8(m) != 0) changed = true;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_xor_si128(w, _mm_and_si128(m, case_bit)));
+    src += 16;
+    dst += 16;
+  }
+  // The high bit of any byte is only set for non-ASCII input.
+  if (_mm_movemask_epi8(or_acc_v) != 0) return false;
+#endif
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<intptr_t>(src), sizeof(uintptr_t))) {
     // Process the prefix of the input that requires no conversion one aligned
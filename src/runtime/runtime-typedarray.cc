@@ -4,6 +4,10 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
 #include "src/arguments.h"
 #include "src/factory.h"
 #include "src/messages.h"
@@ -368,6 +372,148 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
 }
 
 
+namespace {
+
+// Sorts |length| elements of type |ElementType| in ascending order. The
+// floating point overloads sort with -0 before +0 and all NaNs at the end,
+// matching the default comparison function in typedarray.js.
+bool LessThanNaNsLast(double x, double y) {
+  if (std::isnan(y)) return !std::isnan(x);
+  if (x == 0 && y == 0) return std::signbit(x) && !std::signbit(y);
+  return x < y;
+}
+
+template <typename ElementType>
+void SortElements(ElementType* data, size_t length) {
+  std::sort(data, data + length);
+}
+
+void SortElements(float* data, size_t length) {
+  std::sort(data, data + length, LessThanNaNsLast);
+}
+
+void SortElements(double* data, size_t length) {
+  std::sort(data, data + length, LessThanNaNsLast);
+}
+
+}  // namespace
+
+
+// Fills the elements in [start, end) with value. The index arguments have
+// been clamped against the array length by the caller, but the argument
+// conversions there can have neutered the buffer, so they are clamped once
+// more against the current length.
+RUNTIME_FUNCTION(Runtime_TypedArrayFill) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_DOUBLE_ARG_CHECKED(value, 1);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(start_obj, 2);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(end_obj, 3);
+
+  size_t start = 0;
+  size_t end = 0;
+  CHECK(TryNumberToSize(*start_obj, &start));
+  CHECK(TryNumberToSize(*end_obj, &end));
+  size_t length = array->length_value();
+  if (end > length) end = length;
+  if (start > end) start = end;
+
+  DisallowHeapAllocation no_gc;
+  uint8_t* data = static_cast<uint8_t*>(
+      FixedTypedArrayBase::cast(array->elements())->DataPtr());
+  switch (array->type()) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)             \
+  case kExternal##Type##Array: {                                    \
+    ctype* base = reinterpret_cast<ctype*>(data);                   \
+    std::fill(base + start, base + end,                             \
+              Fixed##Type##Array::from_double(value));              \
+    break;                                                          \
+  }
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+  return *array;
+}
+
+
+// Moves count elements starting at index from to index to. The index
+// arguments have been clamped against the array length by the caller, but
+// the argument conversions there can have neutered the buffer, so they are
+// clamped once more against the current length.
+RUNTIME_FUNCTION(Runtime_TypedArrayCopyWithin) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(to_obj, 1);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(from_obj, 2);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(count_obj, 3);
+
+  size_t to = 0;
+  size_t from = 0;
+  size_t count = 0;
+  CHECK(TryNumberToSize(*to_obj, &to));
+  CHECK(TryNumberToSize(*from_obj, &from));
+  CHECK(TryNumberToSize(*count_obj, &count));
+  size_t length = array->length_value();
+  if (to > length) to = length;
+  if (from > length) from = length;
+  count = Min(count, Min(length - to, length - from));
+  if (count == 0) return *array;
+
+  DisallowHeapAllocation no_gc;
+  uint8_t* data = static_cast<uint8_t*>(
+      FixedTypedArrayBase::cast(array->elements())->DataPtr());
+  size_t element_size = array->element_size();
+  memmove(data + to * element_size, data + from * element_size,
+          count * element_size);
+  return *array;
+}
+
+
+// Sorts the elements in ascending order, like the self-hosted sort with the
+// default comparison function but without calling back into JavaScript for
+// every comparison.
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+
+  size_t length = array->length_value();
+  if (length < 2) return *array;
+
+  // Sorting the backing store of a SharedArrayBuffer in place would let
+  // writes from another thread violate the strict weak ordering that
+  // std::sort relies on, which is undefined behavior. Sort a private copy
+  // instead and write the result back.
+  bool needs_private_copy = JSArrayBuffer::cast(array->buffer())->is_shared();
+
+  DisallowHeapAllocation no_gc;
+  uint8_t* array_data = static_cast<uint8_t*>(
+      FixedTypedArrayBase::cast(array->elements())->DataPtr());
+  uint8_t* data = array_data;
+  size_t byte_length = length * array->element_size();
+  std::unique_ptr<uint8_t[]> copy;
+  if (needs_private_copy) {
+    copy.reset(NewArray<uint8_t>(byte_length));
+    memcpy(copy.get(), array_data, byte_length);
+    data = copy.get();
+  }
+  switch (array->type()) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)  \
+  case kExternal##Type##Array:                           \
+    SortElements(reinterpret_cast<ctype*>(data), length); \
+    break;
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+  if (needs_private_copy) {
+    memcpy(array_data, data, byte_length);
+  }
+  return *array;
+}
+
+
 RUNTIME_FUNCTION(Runtime_TypedArrayMaxSizeInHeap) {
   DCHECK(args.length() == 0);
   DCHECK_OBJECT_SIZE(FLAG_typed_array_max_size_in_heap +
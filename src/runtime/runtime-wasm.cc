@@ -6,6 +6,7 @@
 
 #include "src/arguments.h"
 #include "src/assembler.h"
+#include "src/base/platform/platform.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/conversions.h"
 #include "src/debug/debug.h"
@@ -46,6 +47,7 @@ RUNTIME_FUNCTION(Runtime_WasmGrowMemory) {
 
   Address old_mem_start, new_mem_start;
   uint32_t old_size, new_size;
+  Handle<JSArrayBuffer> buffer;
 
   // Get mem buffer associated with module object
   Handle<Object> obj(module_object->GetInternalField(kWasmMemArrayBuffer),
@@ -60,18 +62,12 @@ RUNTIME_FUNCTION(Runtime_WasmGrowMemory) {
     new_size = delta_pages * wasm::WasmModule::kPageSize;
     // The code generated in the wasm compiler guarantees this precondition.
     DCHECK(delta_pages <= wasm::WasmModule::kMaxMemPages);
-    new_mem_start =
-        static_cast<Address>(isolate->array_buffer_allocator()->Allocate(
-            static_cast<uint32_t>(new_size)));
-    if (new_mem_start == NULL) {
+    buffer =
+        wasm::NewArrayBuffer(isolate, new_size, wasm::EnableGuardRegions());
+    if (buffer.is_null()) {
       return *isolate->factory()->NewNumberFromInt(-1);
     }
-#if DEBUG
-    // Double check the API allocator actually zero-initialized the memory.
-    for (size_t i = old_size; i < new_size; i++) {
-      DCHECK_EQ(0, new_mem_start[i]);
-    }
-#endif
+    new_mem_start = static_cast<Address>(buffer->backing_store());
   } else {
     Handle<JSArrayBuffer> old_buffer = Handle<JSArrayBuffer>::cast(obj);
     old_mem_start = static_cast<Address>(old_buffer->backing_store());
@@ -86,19 +82,30 @@ RUNTIME_FUNCTION(Runtime_WasmGrowMemory) {
         wasm::WasmModule::kMaxMemPages * wasm::WasmModule::kPageSize) {
       return *isolate->factory()->NewNumberFromInt(-1);
     }
-    new_mem_start = static_cast<Address>(realloc(old_mem_start, new_size));
-    if (new_mem_start == NULL) {
-      return *isolate->factory()->NewNumberFromInt(-1);
+    if (old_buffer->has_guard_region()) {
+      // The memory sits at the start of a full guard region; grow in place
+      // by committing the next pages of the reservation.
+      if (!base::VirtualMemory::CommitRegion(old_mem_start + old_size,
+                                             new_size - old_size, false)) {
+        return *isolate->factory()->NewNumberFromInt(-1);
+      }
+      new_mem_start = old_mem_start;
+    } else {
+      new_mem_start = static_cast<Address>(realloc(old_mem_start, new_size));
+      if (new_mem_start == NULL) {
+        return *isolate->factory()->NewNumberFromInt(-1);
+      }
+      // Zero initializing uninitialized memory from realloc
+      memset(new_mem_start + old_size, 0, new_size - old_size);
     }
     old_buffer->set_is_external(true);
     isolate->heap()->UnregisterArrayBuffer(*old_buffer);
-    // Zero initializing uninitialized memory from realloc
-    memset(new_mem_start + old_size, 0, new_size - old_size);
-  }
 
-  Handle<JSArrayBuffer> buffer = isolate->factory()->NewJSArrayBuffer();
-  JSArrayBuffer::Setup(buffer, isolate, false, new_mem_start, new_size);
-  buffer->set_is_neuterable(false);
+    buffer = isolate->factory()->NewJSArrayBuffer();
+    JSArrayBuffer::Setup(buffer, isolate, false, new_mem_start, new_size);
+    buffer->set_is_neuterable(false);
+    buffer->set_has_guard_region(old_buffer->has_guard_region());
+  }
 
   // Set new buffer to be wasm memory
   module_object->SetInternalField(kWasmMemArrayBuffer, *buffer);
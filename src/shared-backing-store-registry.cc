@@ -0,0 +1,57 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/shared-backing-store-registry.h"
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+base::LazyMutex SharedBackingStoreRegistry::mutex_ = LAZY_MUTEX_INITIALIZER;
+base::LazyInstance<SharedBackingStoreRegistry::RegistryMap>::type
+    SharedBackingStoreRegistry::registry_ = LAZY_INSTANCE_INITIALIZER;
+
+
+void SharedBackingStoreRegistry::Acquire(void* backing_store,
+                                         size_t byte_length) {
+  if (backing_store == nullptr) return;
+  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  RegistryMap* registry = registry_.Pointer();
+  RegistryMap::iterator it = registry->find(backing_store);
+  if (it == registry->end()) {
+    Entry entry = {byte_length, 1};
+    registry->insert(std::make_pair(backing_store, entry));
+  } else {
+    DCHECK_EQ(byte_length, it->second.byte_length);
+    it->second.ref_count++;
+  }
+}
+
+
+bool SharedBackingStoreRegistry::Release(void* backing_store) {
+  if (backing_store == nullptr) return true;
+  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  RegistryMap* registry = registry_.Pointer();
+  RegistryMap::iterator it = registry->find(backing_store);
+  DCHECK(it != registry->end());
+  DCHECK_LT(0, it->second.ref_count);
+  if (--it->second.ref_count > 0) return false;
+  registry->erase(it);
+  return true;
+}
+
+
+bool SharedBackingStoreRegistry::Lookup(void* backing_store,
+                                        size_t* byte_length) {
+  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  RegistryMap* registry = registry_.Pointer();
+  RegistryMap::iterator it = registry->find(backing_store);
+  if (it == registry->end()) return false;
+  *byte_length = it->second.byte_length;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
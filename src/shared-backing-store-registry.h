@@ -0,0 +1,55 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SHARED_BACKING_STORE_REGISTRY_H_
+#define V8_SHARED_BACKING_STORE_REGISTRY_H_
+
+#include <map>
+
+#include "src/allocation.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+
+// A process-wide, reference-counted registry of SharedArrayBuffer backing
+// stores. It allows several isolates to map the same backing store: each
+// isolate's |JSArrayBuffer| holds one reference, and the store is freed only
+// when the last referencing buffer is collected, no matter which isolate it
+// lived in.
+
+namespace v8 {
+namespace internal {
+
+class SharedBackingStoreRegistry : public AllStatic {
+ public:
+  // Adds a reference to |backing_store|, registering it with a reference
+  // count of one if it is not yet known. Called when a shared backing store
+  // is allocated, and again for every further |JSArrayBuffer| that maps it.
+  static void Acquire(void* backing_store, size_t byte_length);
+
+  // Drops a reference to |backing_store|. Returns whether this was the last
+  // reference, in which case the caller is responsible for actually freeing
+  // the memory.
+  static bool Release(void* backing_store);
+
+  // Returns whether |backing_store| is registered, and if so stores its
+  // length in |byte_length|.
+  static bool Lookup(void* backing_store, size_t* byte_length);
+
+ private:
+  struct Entry {
+    size_t byte_length;
+    int ref_count;
+  };
+
+  typedef std::map<void*, Entry> RegistryMap;
+
+  static base::LazyMutex mutex_;
+  static base::LazyInstance<RegistryMap>::type registry_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SHARED_BACKING_STORE_REGISTRY_H_
@@ -23,6 +23,9 @@ namespace {
 v8::StartupData g_natives;
 v8::StartupData g_snapshot;
 
+base::OS::MemoryMappedFile* g_natives_mapping = nullptr;
+base::OS::MemoryMappedFile* g_snapshot_mapping = nullptr;
+
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
@@ -30,24 +33,47 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 
-void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+void DeleteStartupData(v8::StartupData* data,
+                       base::OS::MemoryMappedFile** mapping) {
+  if (*mapping != nullptr) {
+    delete *mapping;
+    *mapping = nullptr;
+  } else {
+    delete[] data->data;
+  }
   ClearStartupData(data);
 }
 
 
 void FreeStartupData() {
-  DeleteStartupData(&g_natives);
-  DeleteStartupData(&g_snapshot);
+  DeleteStartupData(&g_natives, &g_natives_mapping);
+  DeleteStartupData(&g_snapshot, &g_snapshot_mapping);
 }
 
 
 void Load(const char* blob_file, v8::StartupData* startup_data,
+          base::OS::MemoryMappedFile** mapping,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
+  // Map the blob instead of copying it, so that its pages are shared across
+  // isolates and are only faulted in when the deserializer actually reads
+  // them. The mapping must be read-only and private: blobs are typically
+  // installed without write permission, and a writable shared mapping would
+  // let a stray write corrupt the blob on disk for the whole machine.
+  *mapping = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (*mapping != nullptr) {
+    startup_data->data = static_cast<const char*>((*mapping)->memory());
+    startup_data->raw_size = static_cast<int>((*mapping)->size());
+    (*setter_fn)(startup_data);
+    return;
+  }
+
+  // Fall back to reading the blob into a heap-allocated buffer, e.g. on
+  // platforms without memory-mapped files.
   FILE* file = fopen(blob_file, "rb");
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
@@ -72,8 +98,10 @@ void Load(const char* blob_file, v8::StartupData* startup_data,
 
 
 void LoadFromFiles(const char* natives_blob, const char* snapshot_blob) {
-  Load(natives_blob, &g_natives, v8::V8::SetNativesDataBlob);
-  Load(snapshot_blob, &g_snapshot, v8::V8::SetSnapshotDataBlob);
+  Load(natives_blob, &g_natives, &g_natives_mapping,
+       v8::V8::SetNativesDataBlob);
+  Load(snapshot_blob, &g_snapshot, &g_snapshot_mapping,
+       v8::V8::SetSnapshotDataBlob);
 
   atexit(&FreeStartupData);
 }
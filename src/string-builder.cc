@@ -45,11 +45,13 @@ MaybeHandle<String> ReplacementStringBuilder::ToString() {
 }
 
 
-IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
+IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate,
+                                                   int initial_part_length)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       overflowed_(false),
-      part_length_(kInitialPartLength),
+      part_length_(
+          Max(Min(initial_part_length, kMaxPartLength), kInitialPartLength)),
       current_index_(0) {
   // Create an accumulator handle starting with the empty string.
   accumulator_ = Handle<String>::New(isolate->heap()->empty_string(), isolate);
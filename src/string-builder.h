@@ -269,10 +269,16 @@ class ReplacementStringBuilder {
 
 class IncrementalStringBuilder {
  public:
-  explicit IncrementalStringBuilder(Isolate* isolate);
+  // The initial part length may be raised above the default when the caller
+  // can estimate the size of the result, e.g. from a previous run. It is
+  // clamped to [kInitialPartLength, kMaxPartLength].
+  explicit IncrementalStringBuilder(Isolate* isolate,
+                                    int initial_part_length = 0);
 
   INLINE(String::Encoding CurrentEncoding()) { return encoding_; }
 
+  INLINE(int part_length()) const { return part_length_; }
+
   template <typename SrcChar, typename DestChar>
   INLINE(void Append(SrcChar c));
 
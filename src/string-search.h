@@ -155,8 +155,44 @@ class StringSearch : private StringSearchBase {
   }
 
   // The following tables are shared by all searches.
-  // TODO(lrn): Introduce a way for a pattern to keep its tables
-  // between searches (e.g., for an Atom RegExp).
+  // The isolate remembers which pattern they were last populated for, so
+  // repeated searches for the same pattern (e.g., for an Atom RegExp) keep
+  // their tables between searches.
+
+  // Checks whether the isolate's shift tables were last built for this
+  // pattern.
+  bool TablesCachedForPattern() {
+    int pattern_length = pattern_.length();
+    if (isolate_->string_search_cached_pattern_length() != pattern_length) {
+      return false;
+    }
+    if (isolate_->string_search_cached_pattern_char_size() !=
+        static_cast<int>(sizeof(PatternChar))) {
+      return false;
+    }
+    // The tables only cover the last kBMMaxShift characters of the pattern,
+    // so only those participate in the key.
+    const uc16* cached_pattern = isolate_->string_search_cached_pattern();
+    for (int i = start_; i < pattern_length; i++) {
+      if (cached_pattern[i - start_] != pattern_[i]) return false;
+    }
+    return true;
+  }
+
+  // Records the pattern the bad char shift table was just built for. The
+  // characters are copied since the backing string may move during a garbage
+  // collection between searches.
+  void CachePattern() {
+    int pattern_length = pattern_.length();
+    uc16* cached_pattern = isolate_->string_search_cached_pattern();
+    for (int i = start_; i < pattern_length; i++) {
+      cached_pattern[i - start_] = pattern_[i];
+    }
+    isolate_->set_string_search_cached_pattern_length(pattern_length);
+    isolate_->set_string_search_cached_pattern_char_size(
+        static_cast<int>(sizeof(PatternChar)));
+    isolate_->set_string_search_good_suffix_table_valid(false);
+  }
 
   // Store for the BoyerMoore(Horspool) bad char shift table.
   // Return a table covering the last kBMMaxShift+1 positions of
@@ -356,6 +392,12 @@ int StringSearch<PatternChar, SubjectChar>::BoyerMooreSearch(
 
 template <typename PatternChar, typename SubjectChar>
 void StringSearch<PatternChar, SubjectChar>::PopulateBoyerMooreTable() {
+  // The good suffix table is only flagged as valid while the cached pattern
+  // matches, i.e., while the bad char table built alongside it survives.
+  if (TablesCachedForPattern()) {
+    if (isolate_->string_search_good_suffix_table_valid()) return;
+    isolate_->set_string_search_good_suffix_table_valid(true);
+  }
   int pattern_length = pattern_.length();
   const PatternChar* pattern = pattern_.start();
   // Only look at the last kBMMaxShift characters of pattern (from start_
@@ -477,6 +519,9 @@ int StringSearch<PatternChar, SubjectChar>::BoyerMooreHorspoolSearch(
 
 template <typename PatternChar, typename SubjectChar>
 void StringSearch<PatternChar, SubjectChar>::PopulateBoyerMooreHorspoolTable() {
+  // Reuse the table when it was last populated for this very pattern by an
+  // earlier search.
+  if (TablesCachedForPattern()) return;
   int pattern_length = pattern_.length();
 
   int* bad_char_occurrence = bad_char_table();
@@ -501,6 +546,7 @@ void StringSearch<PatternChar, SubjectChar>::PopulateBoyerMooreHorspoolTable() {
     int bucket = (sizeof(PatternChar) == 1) ? c : c % AlphabetSize();
     bad_char_occurrence[bucket] = i;
   }
+  CachePattern();
 }
 
 //---------------------------------------------------------------------
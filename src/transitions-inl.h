@@ -99,6 +99,20 @@ void TransitionArray::SetTarget(int transition_number, Map* value) {
 }
 
 
+int TransitionArray::search_cache() {
+  Object* value = get(kSearchCacheIndex);
+  // Freshly allocated arrays hold undefined here and zapped arrays the hole.
+  if (!value->IsSmi()) return kNotFound;
+  return Smi::cast(value)->value();
+}
+
+
+void TransitionArray::set_search_cache(int transition_number) {
+  DCHECK(transition_number < number_of_transitions());
+  set(kSearchCacheIndex, Smi::FromInt(transition_number));
+}
+
+
 int TransitionArray::SearchName(Name* name, int* out_insertion_index) {
   DCHECK(name->IsUniqueName());
   return internal::Search<ALL_ENTRIES>(this, name, number_of_entries(),
@@ -99,6 +99,7 @@ void TransitionArray::Insert(Handle<Map> map, Handle<Name> name,
       }
       array->SetKey(index, *name);
       array->SetTarget(index, *target);
+      array->set_search_cache(index);
       SLOW_DCHECK(array->IsSortedNoDuplicates());
       return;
     }
@@ -150,6 +151,7 @@ void TransitionArray::Insert(Handle<Map> map, Handle<Name> name,
   for (int i = insertion_index; i < number_of_transitions; ++i) {
     result->Set(i + 1, array->GetKey(i), array->GetTarget(i));
   }
+  result->set_search_cache(insertion_index);
 
   SLOW_DCHECK(result->IsSortedNoDuplicates());
   ReplaceTransitions(map, *result);
@@ -397,6 +399,7 @@ Handle<TransitionArray> TransitionArray::Allocate(Isolate* isolate,
       LengthFor(number_of_transitions + slack));
   array->set(kPrototypeTransitionsIndex, Smi::FromInt(0));
   array->set(kTransitionLengthIndex, Smi::FromInt(number_of_transitions));
+  array->set(kSearchCacheIndex, Smi::FromInt(kNotFound));
   return Handle<TransitionArray>::cast(array);
 }
 
@@ -545,9 +548,23 @@ int TransitionArray::SearchDetails(int transition, PropertyKind kind,
 int TransitionArray::Search(PropertyKind kind, Name* name,
                             PropertyAttributes attributes,
                             int* out_insertion_index) {
+  // Repeated construction of the same object shape looks up the same
+  // transition over and over; check the most recently found entry before
+  // falling back to binary search. The cached entry number may be stale, so
+  // it only counts as a hit if key and details still match.
+  int cached = search_cache();
+  if (cached != kNotFound && cached < number_of_transitions() &&
+      GetKey(cached) == name) {
+    PropertyDetails details = GetTargetDetails(name, GetTarget(cached));
+    if (details.kind() == kind && details.attributes() == attributes) {
+      return cached;
+    }
+  }
   int transition = SearchName(name, out_insertion_index);
   if (transition == kNotFound) return kNotFound;
-  return SearchDetails(transition, kind, attributes, out_insertion_index);
+  int result = SearchDetails(transition, kind, attributes, out_insertion_index);
+  if (result != kNotFound) set_search_cache(result);
+  return result;
 }
 }  // namespace internal
 }  // namespace v8
@@ -28,10 +28,12 @@ namespace internal {
 // and handles the distinction between simple and full transitions storage.
 //
 // The full format is:
-// [0] Smi(0) or fixed array of prototype transitions
-// [1] Number of transitions
-// [2] First transition
-// [2 + number of transitions * kTransitionSize]: start of slack
+// [0] Link to the next encountered transition array (used by GC)
+// [1] Smi(0) or fixed array of prototype transitions
+// [2] Number of transitions
+// [3] Entry number of the most recently found transition, or Smi(-1)
+// [4] First transition
+// [4 + number of transitions * kTransitionSize]: start of slack
 class TransitionArray: public FixedArray {
  public:
   // Insert a new transition into |map|'s transition array, extending it
@@ -211,7 +213,8 @@ class TransitionArray: public FixedArray {
   static const int kNextLinkIndex = 0;
   static const int kPrototypeTransitionsIndex = 1;
   static const int kTransitionLengthIndex = 2;
-  static const int kFirstIndex = 3;
+  static const int kSearchCacheIndex = 3;
+  static const int kFirstIndex = 4;
 
   // Layout of map transition entries in full transition arrays.
   static const int kTransitionKey = 0;
@@ -262,6 +265,12 @@ class TransitionArray: public FixedArray {
   int SearchDetails(int transition, PropertyKind kind,
                     PropertyAttributes attributes, int* out_insertion_index);
 
+  // Entry number of the most recently found transition, or kNotFound. The
+  // cached entry may have been shifted by an insertion or by GC compaction,
+  // so readers must re-validate key and details before trusting it.
+  inline int search_cache();
+  inline void set_search_cache(int transition_number);
+
   int number_of_transitions() {
     if (length() < kFirstIndex) return 0;
     return Smi::cast(get(kTransitionLengthIndex))->value();
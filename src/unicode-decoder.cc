@@ -7,9 +7,50 @@
 #include "src/unicode-decoder.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include "src/utils.h"
 
 namespace unibrow {
 
+namespace {
+
+// Returns the length of the leading run of one-byte (ASCII) characters,
+// checking a word at a time once the stream is aligned, in the style of
+// String::NonAsciiStart. These characters convert to UTF-16 by a plain
+// widening copy, so runs of them decode at memory bandwidth.
+size_t AsciiRunLength(const uint8_t* stream, size_t stream_length) {
+  const uint8_t* start = stream;
+  const uint8_t* limit = stream + stream_length;
+
+  if (stream_length >= sizeof(uintptr_t)) {
+    // Check unaligned bytes.
+    while (!v8::internal::IsAligned(reinterpret_cast<intptr_t>(stream),
+                                    sizeof(uintptr_t))) {
+      if (*stream > Utf8::kMaxOneByteChar) {
+        return static_cast<size_t>(stream - start);
+      }
+      ++stream;
+    }
+    // Check aligned words.
+    DCHECK(Utf8::kMaxOneByteChar == 0x7F);
+    const uintptr_t non_one_byte_mask =
+        v8::internal::kUintptrAllBitsSet / 0xFF * 0x80;
+    while (stream + sizeof(uintptr_t) <= limit) {
+      if (*reinterpret_cast<const uintptr_t*>(stream) & non_one_byte_mask) {
+        break;
+      }
+      stream += sizeof(uintptr_t);
+    }
+  }
+  // Check remaining unaligned bytes.
+  while (stream < limit && *stream <= Utf8::kMaxOneByteChar) {
+    ++stream;
+  }
+
+  return static_cast<size_t>(stream - start);
+}
+
+}  // namespace
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const uint8_t* stream, size_t stream_length) {
   // Assume everything will fit in the buffer and stream won't be needed.
@@ -20,6 +61,26 @@ void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
   // Loop until stream is read, writing to buffer as long as buffer has space.
   size_t utf16_length = 0;
   while (stream_length != 0) {
+    // Bulk-process runs of one-byte characters; note that while writing to
+    // the buffer utf16_length is always less than buffer_length.
+    size_t ascii_length = AsciiRunLength(stream, stream_length);
+    if (ascii_length > 0) {
+      if (writing_to_buffer) {
+        size_t space = buffer_length - utf16_length;
+        size_t write_length = ascii_length < space ? ascii_length : space;
+        v8::internal::CopyChars(buffer, stream, write_length);
+        buffer += write_length;
+        if (write_length == space) {
+          writing_to_buffer = false;
+          unbuffered_start_ = stream + write_length;
+          unbuffered_length_ = stream_length - write_length;
+        }
+      }
+      utf16_length += ascii_length;
+      stream += ascii_length;
+      stream_length -= ascii_length;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     DCHECK(cursor > 0 && cursor <= stream_length);
@@ -62,6 +123,17 @@ void Utf8DecoderBase::WriteUtf16Slow(const uint8_t* stream,
                                      size_t stream_length, uint16_t* data,
                                      size_t data_length) {
   while (data_length != 0) {
+    // Bulk-process runs of one-byte characters.
+    size_t ascii_length = AsciiRunLength(stream, stream_length);
+    if (ascii_length > 0) {
+      if (ascii_length > data_length) ascii_length = data_length;
+      v8::internal::CopyChars(data, stream, ascii_length);
+      data += ascii_length;
+      data_length -= ascii_length;
+      stream += ascii_length;
+      stream_length -= ascii_length;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     // There's a total lack of bounds checking for stream
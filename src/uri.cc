@@ -132,14 +132,41 @@ bool IntoTwoByte(int index, bool is_uri, int uri_length,
   return true;
 }
 
+// Bulk-copies the run of plain ASCII characters starting at |k| into the
+// buffer and returns the index of the first character that needs actual
+// decoding, i.e. a '%' escape or a non-ASCII character.
+int AddAsciiRunToBuffer(Vector<const uint8_t> vector, int k,
+                        List<uint8_t>* buffer) {
+  int run_start = k;
+  int length = vector.length();
+  while (k < length) {
+    uint8_t code = vector[k];
+    if (code == '%' || code > unibrow::Utf8::kMaxOneByteChar) break;
+    k++;
+  }
+  if (k > run_start) {
+    Vector<uint8_t> dest = buffer->AddBlock(0, k - run_start);
+    CopyChars(dest.start(), vector.start() + run_start, k - run_start);
+  }
+  return k;
+}
+
 bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
                        List<uint8_t>* one_byte_buffer,
                        List<uc16>* two_byte_buffer) {
   DisallowHeapAllocation no_gc;
   String::FlatContent uri_content = uri->GetFlatContent();
+  bool is_one_byte = uri_content.IsOneByte();
 
   int uri_length = uri->length();
   for (int k = 0; k < uri_length; k++) {
+    if (is_one_byte) {
+      // Characters that decode to themselves are copied wholesale, so the
+      // per-character path below only runs at escape points.
+      k = AddAsciiRunToBuffer(uri_content.ToOneByteVector(), k,
+                              one_byte_buffer);
+      if (k == uri_length) break;
+    }
     uc16 code = uri_content.Get(k);
     if (code == '%') {
       int two_digits;
@@ -266,6 +293,32 @@ void EncodePair(uc16 cc1, uc16 cc2, List<uint8_t>* buffer) {
   }
 }
 
+// Encodes one-byte string contents. One-byte strings contain no surrogates,
+// so no pairing checks are needed, and runs of characters that encode to
+// themselves are copied wholesale; only escape points take the
+// per-character path.
+void EncodeOneByte(Vector<const uint8_t> vector, bool is_uri,
+                   List<uint8_t>* buffer) {
+  int length = vector.length();
+  int k = 0;
+  while (k < length) {
+    int run_start = k;
+    while (k < length) {
+      uint8_t c = vector[k];
+      if (!(IsUnescapePredicateInUriComponent(c) ||
+            (is_uri && IsUriSeparator(c)))) {
+        break;
+      }
+      k++;
+    }
+    if (k > run_start) {
+      Vector<uint8_t> dest = buffer->AddBlock(0, k - run_start);
+      CopyChars(dest.start(), vector.start() + run_start, k - run_start);
+    }
+    if (k < length) EncodeSingle(vector[k++], buffer);
+  }
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
@@ -278,29 +331,33 @@ MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
     DisallowHeapAllocation no_gc;
     String::FlatContent uri_content = uri->GetFlatContent();
 
-    for (int k = 0; k < uri_length; k++) {
-      uc16 cc1 = uri_content.Get(k);
-      if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
-        k++;
-        if (k < uri_length) {
-          uc16 cc2 = uri->Get(k);
-          if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
-            EncodePair(cc1, cc2, &buffer);
-            continue;
+    if (uri_content.IsOneByte()) {
+      EncodeOneByte(uri_content.ToOneByteVector(), is_uri, &buffer);
+    } else {
+      for (int k = 0; k < uri_length; k++) {
+        uc16 cc1 = uri_content.Get(k);
+        if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
+          k++;
+          if (k < uri_length) {
+            uc16 cc2 = uri->Get(k);
+            if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
+              EncodePair(cc1, cc2, &buffer);
+              continue;
+            }
           }
+        } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
+          if (IsUnescapePredicateInUriComponent(cc1) ||
+              (is_uri && IsUriSeparator(cc1))) {
+            buffer.Add(cc1);
+          } else {
+            EncodeSingle(cc1, &buffer);
+          }
+          continue;
         }
-      } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
-        if (IsUnescapePredicateInUriComponent(cc1) ||
-            (is_uri && IsUriSeparator(cc1))) {
-          buffer.Add(cc1);
-        } else {
-          EncodeSingle(cc1, &buffer);
-        }
-        continue;
-      }
 
-      AllowHeapAllocation allocate_error_and_return;
-      THROW_NEW_ERROR(isolate, NewURIError(), String);
+        AllowHeapAllocation allocate_error_and_return;
+        THROW_NEW_ERROR(isolate, NewURIError(), String);
+      }
     }
   }
 
@@ -4,6 +4,7 @@
 
 #include "src/v8.h"
 
+#include "src/api-trace.h"
 #include "src/assembler.h"
 #include "src/base/once.h"
 #include "src/base/platform/platform.h"
@@ -42,6 +43,9 @@ bool V8::Initialize() {
 
 
 void V8::TearDown() {
+#ifdef V8_ENABLE_API_TRACING
+  ApiTraceWriter::TearDown();
+#endif  // V8_ENABLE_API_TRACING
   Bootstrapper::TearDownExtensions();
   ElementsAccessor::TearDown();
   LOperand::TearDownCaches();
@@ -429,6 +429,8 @@
         'api-arguments.h',
         'api-natives.cc',
         'api-natives.h',
+        'api-trace.cc',
+        'api-trace.h',
         'arguments.cc',
         'arguments.h',
         'asmjs/asm-js.cc',
@@ -741,6 +743,8 @@
         'compiler/zone-pool.h',
         'compiler-dispatcher/compiler-dispatcher-job.cc',
         'compiler-dispatcher/compiler-dispatcher-job.h',
+        'compiler-dispatcher/compiler-dispatcher.cc',
+        'compiler-dispatcher/compiler-dispatcher.h',
         'compiler-dispatcher/optimizing-compile-dispatcher.cc',
         'compiler-dispatcher/optimizing-compile-dispatcher.h',
         'compiler.cc',
@@ -863,6 +867,8 @@
         'extensions/gc-extension.h',
         'extensions/ignition-statistics-extension.cc',
         'extensions/ignition-statistics-extension.h',
+        'extensions/regexp-flat-exec-extension.cc',
+        'extensions/regexp-flat-exec-extension.h',
         'extensions/statistics-extension.cc',
         'extensions/statistics-extension.h',
         'extensions/trigger-failure-extension.cc',
@@ -905,8 +911,12 @@
         'heap/array-buffer-tracker.h',
         'heap/code-stats.cc',
         'heap/code-stats.h',
+        'heap/concurrent-marking.cc',
+        'heap/concurrent-marking.h',
         'heap/memory-reducer.cc',
         'heap/memory-reducer.h',
+        'heap/gc-decision-log.cc',
+        'heap/gc-decision-log.h',
         'heap/gc-idle-time-handler.cc',
         'heap/gc-idle-time-handler.h',
         'heap/gc-tracer.cc',
@@ -1162,6 +1172,8 @@
         'runtime/runtime.h',
         'safepoint-table.cc',
         'safepoint-table.h',
+        'shared-backing-store-registry.cc',
+        'shared-backing-store-registry.h',
         'signature.h',
         'simulator.h',
         'small-pointer-list.h',
@@ -1762,6 +1774,7 @@
         'base/atomicops_internals_x86_msvc.h',
         'base/bits.cc',
         'base/bits.h',
+        'base/bounded-mpmc-queue.h',
         'base/build_config.h',
         'base/compiler-specific.h',
         'base/cpu.cc',
@@ -2194,7 +2207,8 @@
           'js/harmony-atomics.js',
           'js/harmony-simd.js',
           'js/harmony-string-padding.js',
-          'js/harmony-async-await.js'
+          'js/harmony-async-await.js',
+          'js/array-pipeline.js'
         ],
         'libraries_bin_file': '<(SHARED_INTERMEDIATE_DIR)/libraries.bin',
         'libraries_experimental_bin_file': '<(SHARED_INTERMEDIATE_DIR)/libraries-experimental.bin',
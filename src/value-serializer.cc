@@ -128,10 +128,19 @@ ValueSerializer::ValueSerializer(Isolate* isolate)
     : isolate_(isolate),
       zone_(isolate->allocator()),
       id_map_(isolate->heap(), &zone_),
-      array_buffer_transfer_map_(isolate->heap(), &zone_) {}
+      array_buffer_transfer_map_(isolate->heap(), &zone_) {
+  buffer_.reserve(isolate->value_serializer_buffer_hint());
+}
 
 ValueSerializer::~ValueSerializer() {}
 
+std::vector<uint8_t> ValueSerializer::ReleaseBuffer() {
+  // Remember the message size, so that the next serializer for this isolate
+  // can allocate its buffer in one step.
+  isolate_->set_value_serializer_buffer_hint(buffer_.size());
+  return std::move(buffer_);
+}
+
 void ValueSerializer::WriteHeader() {
   WriteTag(SerializationTag::kVersion);
   WriteVarint(kLatestVersion);
@@ -58,7 +58,7 @@ class ValueSerializer {
    * Returns the stored data. This serializer should not be used once the buffer
    * is released. The contents are undefined if a previous write has failed.
    */
-  std::vector<uint8_t> ReleaseBuffer() { return std::move(buffer_); }
+  std::vector<uint8_t> ReleaseBuffer();
 
   /*
    * Marks an ArrayBuffer as havings its contents transferred out of band.
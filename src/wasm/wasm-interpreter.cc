@@ -678,11 +678,21 @@ static const int kRunSteps = 1000;
 // be directly executed without the need to dynamically track blocks.
 class ControlTransfers : public ZoneObject {
  public:
-  ControlTransferMap map_;
+  // Control transfers are looked up on every branch, else and end during
+  // execution, so they are stored as a flat table indexed by pc offset
+  // rather than as a map. A valid entry always has a nonzero pcdiff, since
+  // a control transfer always moves the pc; zero-initialized entries mark
+  // pcs without a transfer.
+  ZoneVector<ControlTransfer> table_;
+  // Maximum operand stack depth of the function, used to reserve operand
+  // stack space once per call.
+  sp_t max_stack_depth_;
 
   ControlTransfers(Zone* zone, size_t locals_encoded_size, const byte* start,
                    const byte* end)
-      : map_(zone) {
+      : table_(static_cast<size_t>(end - start),
+               ControlTransfer{0, 0, ControlTransfer::kNoAction}, zone),
+        max_stack_depth_(0) {
     // A control reference including from PC, from value depth, and whether
     // a value is explicitly passed (e.g. br/br_if/br_table with value).
     struct CRef {
@@ -701,8 +711,8 @@ class ControlTransfers : public ZoneObject {
           : target(nullptr), value_depth(v), refs(zone) {}
 
       // Bind this label to the given PC.
-      void Bind(ControlTransferMap* map, const byte* start, const byte* pc,
-                bool expect_value) {
+      void Bind(ZoneVector<ControlTransfer>* table, const byte* start,
+                const byte* pc, bool expect_value) {
         DCHECK_NULL(target);
         target = pc;
         for (auto from : refs) {
@@ -714,18 +724,18 @@ class ControlTransfers : public ZoneObject {
                                  : ControlTransfer::kPopAndRepush;
           }
           pc_t offset = static_cast<size_t>(from.pc - start);
-          (*map)[offset] = {pcdiff, spdiff, action};
+          (*table)[offset] = {pcdiff, spdiff, action};
         }
       }
 
       // Reference this label from the given location.
-      void Ref(ControlTransferMap* map, const byte* start, CRef from) {
+      void Ref(ZoneVector<ControlTransfer>* table, const byte* start, CRef from) {
         DCHECK_GE(from.value_depth, value_depth);
         if (target) {
           auto pcdiff = static_cast<pcdiff_t>(target - from.pc);
           auto spdiff = static_cast<spdiff_t>(from.value_depth - value_depth);
           pc_t offset = static_cast<size_t>(from.pc - start);
-          (*map)[offset] = {pcdiff, spdiff, ControlTransfer::kNoAction};
+          (*table)[offset] = {pcdiff, spdiff, ControlTransfer::kNoAction};
         } else {
           refs.push_back(from);
         }
@@ -738,9 +748,10 @@ class ControlTransfers : public ZoneObject {
       CLabel* end_label;
       CLabel* else_label;
 
-      void Ref(ControlTransferMap* map, const byte* start, const byte* from_pc,
-               size_t from_value_depth, bool explicit_value) {
-        end_label->Ref(map, start, {from_pc, from_value_depth, explicit_value});
+      void Ref(ZoneVector<ControlTransfer>* table, const byte* start,
+               const byte* from_pc, size_t from_value_depth,
+               bool explicit_value) {
+        end_label->Ref(table, start, {from_pc, from_value_depth, explicit_value});
       }
     };
 
@@ -758,6 +769,7 @@ class ControlTransfers : public ZoneObject {
     for (BytecodeIterator i(start + locals_encoded_size, end); i.has_next();
          i.next()) {
       WasmOpcode opcode = i.current();
+      if (value_depth > max_stack_depth_) max_stack_depth_ = value_depth;
       TRACE("@%u: control %s (depth = %zu)\n", i.pc_offset(),
             WasmOpcodes::OpcodeName(opcode), value_depth);
       switch (opcode) {
@@ -773,7 +785,7 @@ class ControlTransfers : public ZoneObject {
           CLabel* label2 = new (zone) CLabel(zone, value_depth);
           control_stack.push_back({i.pc(), label1, nullptr});
           control_stack.push_back({i.pc(), label2, nullptr});
-          label2->Bind(&map_, start, i.pc(), false);
+          label2->Bind(&table_, start, i.pc(), false);
           break;
         }
         case kExprIf: {
@@ -782,16 +794,16 @@ class ControlTransfers : public ZoneObject {
           CLabel* end_label = new (zone) CLabel(zone, value_depth);
           CLabel* else_label = new (zone) CLabel(zone, value_depth);
           control_stack.push_back({i.pc(), end_label, else_label});
-          else_label->Ref(&map_, start, {i.pc(), value_depth, false});
+          else_label->Ref(&table_, start, {i.pc(), value_depth, false});
           break;
         }
         case kExprElse: {
           Control* c = &control_stack.back();
           TRACE("control @%u $%zu: Else\n", i.pc_offset(), value_depth);
-          c->end_label->Ref(&map_, start, {i.pc(), value_depth, false});
+          c->end_label->Ref(&table_, start, {i.pc(), value_depth, false});
           value_depth = c->end_label->value_depth;
           DCHECK_NOT_NULL(c->else_label);
-          c->else_label->Bind(&map_, start, i.pc() + 1, false);
+          c->else_label->Bind(&table_, start, i.pc() + 1, false);
           c->else_label = nullptr;
           break;
         }
@@ -805,9 +817,9 @@ class ControlTransfers : public ZoneObject {
             c = &control_stack.back();
           }
           if (c->else_label)
-            c->else_label->Bind(&map_, start, i.pc() + 1, true);
-          c->end_label->Ref(&map_, start, {i.pc(), value_depth, false});
-          c->end_label->Bind(&map_, start, i.pc() + 1, true);
+            c->else_label->Bind(&table_, start, i.pc() + 1, true);
+          c->end_label->Ref(&table_, start, {i.pc(), value_depth, false});
+          c->end_label->Bind(&table_, start, i.pc() + 1, true);
           value_depth = c->end_label->value_depth + 1;
           control_stack.pop_back();
           break;
@@ -818,7 +830,7 @@ class ControlTransfers : public ZoneObject {
                 value_depth, operand.arity, operand.depth);
           value_depth -= operand.arity;
           control_stack[control_stack.size() - operand.depth - 1].Ref(
-              &map_, start, i.pc(), value_depth, operand.arity > 0);
+              &table_, start, i.pc(), value_depth, operand.arity > 0);
           value_depth++;
           break;
         }
@@ -828,7 +840,7 @@ class ControlTransfers : public ZoneObject {
                 value_depth, operand.arity, operand.depth);
           value_depth -= (operand.arity + 1);
           control_stack[control_stack.size() - operand.depth - 1].Ref(
-              &map_, start, i.pc(), value_depth, operand.arity > 0);
+              &table_, start, i.pc(), value_depth, operand.arity > 0);
           value_depth++;
           break;
         }
@@ -840,7 +852,7 @@ class ControlTransfers : public ZoneObject {
           for (uint32_t j = 0; j < operand.table_count + 1; ++j) {
             uint32_t target = operand.read_entry(&i, j);
             control_stack[control_stack.size() - target - 1].Ref(
-                &map_, start, i.pc() + j, value_depth, operand.arity > 0);
+                &table_, start, i.pc() + j, value_depth, operand.arity > 0);
           }
           value_depth++;
           break;
@@ -854,11 +866,12 @@ class ControlTransfers : public ZoneObject {
   }
 
   ControlTransfer Lookup(pc_t from) {
-    auto result = map_.find(from);
-    if (result == map_.end()) {
+    DCHECK_LT(from, table_.size());
+    ControlTransfer result = table_[from];
+    if (result.pcdiff == 0) {
       V8_Fatal(__FILE__, __LINE__, "no control target for pc %zu", from);
     }
-    return result->second;
+    return result;
   }
 };
 
@@ -1086,6 +1099,12 @@ class ThreadImpl : public WasmInterpreter::Thread {
     frames_.back().ret_pc = ret_pc;
     size_t arity = code->function->sig->parameter_count();
     DCHECK_GE(stack_.size(), arity);
+    DCHECK_NOT_NULL(code->targets);
+    // Reserve space for the locals and the maximal operand stack depth of
+    // this function in one step, so that pushes within the frame never
+    // reallocate the stack.
+    stack_.reserve(stack_.size() + code->locals.total_local_count +
+                   code->targets->max_stack_depth_ + 1);
     // The parameters will overlap the arguments already on the stack.
     frames_.push_back({code, 0, 0, stack_.size() - arity});
     frames_.back().ret_pc = InitLocals(code);
@@ -1805,7 +1824,12 @@ bool WasmInterpreter::SetFunctionCodeForTesting(const WasmFunction* function,
 ControlTransferMap WasmInterpreter::ComputeControlTransfersForTesting(
     Zone* zone, const byte* start, const byte* end) {
   ControlTransfers targets(zone, 0, start, end);
-  return targets.map_;
+  // Convert the flat table into a map for ease of testing.
+  ControlTransferMap map(zone);
+  for (pc_t pc = 0; pc < targets.table_.size(); ++pc) {
+    if (targets.table_[pc].pcdiff != 0) map[pc] = targets.table_[pc];
+  }
+  return map;
 }
 
 }  // namespace wasm
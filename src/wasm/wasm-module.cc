@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "src/base/atomic-utils.h"
+#include "src/base/platform/platform.h"
 #include "src/code-stubs.h"
 
 #include "src/macro-assembler.h"
@@ -305,18 +306,49 @@ void PatchFunctionTable(Handle<Code> code,
   }
 }
 
-Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size) {
+bool EnableGuardRegions() {
+  // Only 64-bit targets have enough address space to reserve a full guard
+  // region per memory.
+#if V8_TARGET_ARCH_X64
+  return FLAG_wasm_guard_pages;
+#else
+  return false;
+#endif
+}
+
+Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
+                                     bool enable_guard_regions) {
   if (size > (WasmModule::kMaxMemPages * WasmModule::kPageSize)) {
     // TODO(titzer): lift restriction on maximum memory allocated here.
     return Handle<JSArrayBuffer>::null();
   }
-  void* memory = isolate->array_buffer_allocator()->Allocate(size);
-  if (memory == nullptr) {
-    return Handle<JSArrayBuffer>::null();
+  void* memory;
+  if (enable_guard_regions) {
+    // Reserve a full guard region and commit only the accessible prefix.
+    // Any access at a 32-bit index plus a 32-bit constant offset computes
+    // an address inside the reservation, so out-of-bounds accesses fault
+    // instead of requiring an explicit check in generated code.
+    base::VirtualMemory reservation(
+        static_cast<size_t>(JSArrayBuffer::kFullGuardRegionSize));
+    if (!reservation.IsReserved()) {
+      return Handle<JSArrayBuffer>::null();
+    }
+    memory = reservation.address();
+    if (size > 0 && !reservation.Commit(memory, size, false)) {
+      return Handle<JSArrayBuffer>::null();
+    }
+    // The array buffer takes over the reservation; the backing store is
+    // released as a whole region when the buffer dies.
+    reservation.Reset();
+  } else {
+    memory = isolate->array_buffer_allocator()->Allocate(size);
+    if (memory == nullptr) {
+      return Handle<JSArrayBuffer>::null();
+    }
   }
 
 #if DEBUG
-  // Double check the API allocator actually zero-initialized the memory.
+  // Double check the allocator actually zero-initialized the memory.
   const byte* bytes = reinterpret_cast<const byte*>(memory);
   for (size_t i = 0; i < size; ++i) {
     DCHECK_EQ(0, bytes[i]);
@@ -326,6 +358,7 @@ Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size) {
   Handle<JSArrayBuffer> buffer = isolate->factory()->NewJSArrayBuffer();
   JSArrayBuffer::Setup(buffer, isolate, false, memory, static_cast<int>(size));
   buffer->set_is_neuterable(false);
+  buffer->set_has_guard_region(enable_guard_regions);
   return buffer;
 }
 
@@ -352,8 +385,8 @@ Handle<JSArrayBuffer> AllocateMemory(ErrorThrower* thrower, Isolate* isolate,
     thrower->Error("Out of memory: wasm memory too large");
     return Handle<JSArrayBuffer>::null();
   }
-  Handle<JSArrayBuffer> mem_buffer =
-      NewArrayBuffer(isolate, min_mem_pages * WasmModule::kPageSize);
+  Handle<JSArrayBuffer> mem_buffer = NewArrayBuffer(
+      isolate, min_mem_pages * WasmModule::kPageSize, EnableGuardRegions());
 
   if (mem_buffer.is_null()) {
     thrower->Error("Out of memory: wasm memory");
@@ -752,14 +785,11 @@ void InitializeParallelCompilation(
 }
 
 uint32_t* StartCompilationTasks(
-    Isolate* isolate,
+    Isolate* isolate, size_t num_tasks,
     std::vector<compiler::WasmCompilationUnit*>& compilation_units,
     std::queue<compiler::WasmCompilationUnit*>& executed_units,
     base::Semaphore* pending_tasks, base::Mutex& result_mutex,
     base::AtomicNumber<size_t>& next_unit) {
-  const size_t num_tasks =
-      Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
-          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
   uint32_t* task_ids = new uint32_t[num_tasks];
   for (size_t i = 0; i < num_tasks; ++i) {
     WasmCompilationTask* task =
@@ -772,11 +802,9 @@ uint32_t* StartCompilationTasks(
   return task_ids;
 }
 
-void WaitForCompilationTasks(Isolate* isolate, uint32_t* task_ids,
+void WaitForCompilationTasks(Isolate* isolate, size_t num_tasks,
+                             uint32_t* task_ids,
                              base::Semaphore* pending_tasks) {
-  const size_t num_tasks =
-      Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
-          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
   for (size_t i = 0; i < num_tasks; ++i) {
     // If the task has not started yet, then we abort it. Otherwise we wait for
     // it to finish.
@@ -844,10 +872,15 @@ void CompileInParallel(Isolate* isolate, const WasmModule* module,
       static_cast<size_t>(FLAG_skip_compiling_wasm_funcs));
 
   // 2) The main thread spawns {WasmCompilationTask} instances which run on
-  //    the background threads.
+  //    the background threads. The number of tasks is computed once so that
+  //    step 4) waits for exactly the tasks that were started, independent of
+  //    how many background threads the platform reports later on.
+  const size_t num_tasks =
+      Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
   std::unique_ptr<uint32_t[]> task_ids(StartCompilationTasks(
-      isolate, compilation_units, executed_units, module->pending_tasks.get(),
-      result_mutex, next_unit));
+      isolate, num_tasks, compilation_units, executed_units,
+      module->pending_tasks.get(), result_mutex, next_unit));
 
   // 3.a) The background threads and the main thread pick one compilation
   //      unit at a time and execute the parallel phase of the compilation
@@ -864,7 +897,8 @@ void CompileInParallel(Isolate* isolate, const WasmModule* module,
   }
   // 4) After the parallel phase of all compilation units has started, the
   //    main thread waits for all {WasmCompilationTask} instances to finish.
-  WaitForCompilationTasks(isolate, task_ids.get(), module->pending_tasks.get());
+  WaitForCompilationTasks(isolate, num_tasks, task_ids.get(),
+                          module->pending_tasks.get());
   // Finish the compilation of the remaining compilation units.
   FinishCompilationUnits(executed_units, functions, result_mutex);
 }
@@ -918,7 +952,7 @@ bool SetupGlobals(Isolate* isolate, Handle<FixedArray> compiled_module,
       Smi::cast(compiled_module->get(kGlobalsSize))->value());
   if (globals_size > 0) {
     Handle<JSArrayBuffer> globals_buffer =
-        NewArrayBuffer(isolate, globals_size);
+        NewArrayBuffer(isolate, globals_size, false);
     if (globals_buffer.is_null()) {
       thrower->Error("Out of memory: wasm globals");
       return false;
@@ -938,6 +972,18 @@ bool SetupInstanceHeap(Isolate* isolate, Handle<FixedArray> compiled_module,
   isolate->counters()->wasm_min_mem_pages_count()->AddSample(min_mem_pages);
   // TODO(wasm): re-enable counter for max_mem_pages when we use that field.
 
+  ModuleOrigin origin = static_cast<ModuleOrigin>(
+      Smi::cast(compiled_module->get(kOrigin))->value());
+  if (!memory.is_null() && origin == kWasmOrigin && EnableGuardRegions() &&
+      !memory->has_guard_region()) {
+    // The code was compiled without explicit bounds checks, relying on the
+    // memory being allocated with a guard region.
+    thrower->Error(
+        "Imported memory lacks guard regions, "
+        "which --wasm-guard-pages requires");
+    return false;
+  }
+
   if (memory.is_null() && min_mem_pages > 0) {
     memory = AllocateMemory(thrower, isolate, min_mem_pages);
     if (memory.is_null()) {
@@ -1138,6 +1184,12 @@ MaybeHandle<FixedArray> WasmModule::CompileFunctions(
   }
   isolate->counters()->wasm_functions_per_module()->AddSample(
       static_cast<int>(functions.size()));
+  // TODO(wasm): compile functions lazily on first call instead of eagerly
+  // here. That needs a per-function entry stub that can reach the runtime
+  // without clobbering the wasm argument registers, and an interpreter tier
+  // that can execute import calls (kExprCallImport is currently
+  // unimplemented in WasmInterpreter), so that cold functions never occupy
+  // code space.
   if (FLAG_wasm_num_compilation_tasks != 0) {
     CompileInParallel(isolate, this,
                       temp_instance_for_compilation.function_code, thrower,
@@ -1640,6 +1692,11 @@ Handle<JSObject> CreateCompiledModuleObject(
   return module_obj;
 }
 
+MaybeHandle<String> GetCompiledModuleBytes(Isolate* isolate,
+                                           Handle<FixedArray> compiled_module) {
+  return compiled_module->GetValue<String>(isolate, kModuleBytes);
+}
+
 namespace testing {
 
 int32_t CompileAndRunWasmModule(Isolate* isolate, const byte* module_start,
@@ -401,6 +401,21 @@ void PopulateFunctionTable(Handle<FixedArray> table, uint32_t table_size,
 Handle<JSObject> CreateCompiledModuleObject(Isolate* isolate,
                                             Handle<FixedArray> compiled_module);
 
+// Returns the wire bytes of the module stored in a compiled module, if
+// present.
+MaybeHandle<String> GetCompiledModuleBytes(Isolate* isolate,
+                                           Handle<FixedArray> compiled_module);
+
+// Whether wasm linear memory should be allocated inside a full guard region
+// (see JSArrayBuffer::kFullGuardRegionSize), allowing generated code to elide
+// explicit bounds checks. Controlled by --wasm-guard-pages; 64-bit only.
+bool EnableGuardRegions();
+
+// Allocates a new array buffer for use as wasm memory, with a guard region
+// around the accessible part if requested. Returns a null handle on failure.
+Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
+                                     bool enable_guard_regions);
+
 // Assumed to be called with a code object associated to a wasm module instance.
 // Intended to be called from runtime functions.
 // Returns undefined if the runtime support was not setup, nullptr if the
@@ -398,6 +398,41 @@ TEST(OldSpace) {
 }
 
 
+TEST(RefillLabBackgroundFromFreeList) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  // Create free-list entries in old space by letting a batch of tenured
+  // arrays die and sweeping them.
+  {
+    HandleScope scope(isolate);
+    for (int i = 0; i < 10; i++) {
+      isolate->factory()->NewFixedArray(10000, TENURED);
+    }
+  }
+  heap->CollectAllGarbage(Heap::kFinalizeIncrementalMarkingMask,
+                          "refill lab background test");
+  if (heap->mark_compact_collector()->sweeping_in_progress()) {
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+  }
+
+  const int kLabSize = 4 * KB;
+  LocalAllocationBuffer lab = LocalAllocationBuffer::InvalidBuffer();
+  CHECK(heap->old_space()->RefillLabBackground(&lab, kLabSize));
+  CHECK(lab.IsValid());
+
+  // Bump allocation out of the buffer requires no synchronization.
+  const int kObjectSize = 2 * kPointerSize;
+  AllocationResult result = lab.AllocateRawAligned(kObjectSize, kWordAligned);
+  HeapObject* object = nullptr;
+  CHECK(result.To(&object));
+  // Make the raw memory iterable; a real consumer would install a map.
+  heap->CreateFillerObjectAt(object->address(), kObjectSize,
+                             ClearRecordedSlots::kNo);
+}
+
+
 TEST(CompactionSpace) {
   Isolate* isolate = CcTest::i_isolate();
   Heap* heap = isolate->heap();
@@ -479,6 +514,41 @@ TEST(LargeObjectSpace) {
 }
 
 
+TEST(RecycleLargePagesFromPool) {
+  FLAG_large_page_pool_size = 8;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  const int kArrayLength = 300000;  // ~2.4MB payload, well into large space.
+  Address chunk_address = nullptr;
+  {
+    HandleScope scope(isolate);
+    Handle<FixedArray> array =
+        isolate->factory()->NewFixedArray(kArrayLength, TENURED);
+    CHECK(heap->lo_space()->Contains(*array));
+    chunk_address = MemoryChunk::FromAddress(array->address())->address();
+  }
+  // Two full GCs: the first one queues the dead large page with the
+  // unmapper, the second one processes the queue and diverts the page into
+  // the pool.
+  heap->CollectAllGarbage(Heap::kFinalizeIncrementalMarkingMask,
+                          "recycle large pages test");
+  heap->CollectAllGarbage(Heap::kFinalizeIncrementalMarkingMask,
+                          "recycle large pages test");
+  heap->memory_allocator()->unmapper()->WaitUntilCompleted();
+
+  // An allocation of the same size class must reuse the pooled page.
+  HandleScope scope(isolate);
+  Handle<FixedArray> array =
+      isolate->factory()->NewFixedArray(kArrayLength, TENURED);
+  CHECK(heap->lo_space()->Contains(*array));
+  CHECK_EQ(chunk_address,
+           MemoryChunk::FromAddress(array->address())->address());
+  FLAG_large_page_pool_size = 0;
+}
+
+
 TEST(SizeOfFirstPageIsLargeEnough) {
   if (i::FLAG_always_opt) return;
   // Bootstrapping without a snapshot causes more allocations.
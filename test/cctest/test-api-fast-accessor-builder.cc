@@ -445,6 +445,53 @@ TEST(FastAccessorToSmi) {
   ExpectInt32("load_smi()", 123456789);
 }
 
+struct RawGetterTarget {
+  int32_t value;
+};
+
+int32_t RawIntGetter(void* data) {
+  return reinterpret_cast<RawGetterTarget*>(data)->value;
+}
+
+TEST(FastAccessorCallIntGetter) {
+  // Crankshaft support for fast accessors is not implemented; crankshafted
+  // code uses the slow accessor which breaks this test's expectations.
+  v8::internal::FLAG_always_opt = false;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<v8::ObjectTemplate> foo = v8::ObjectTemplate::New(isolate);
+  foo->SetInternalFieldCount(1);
+
+  {
+    // Accessor raw_int: call a raw getter with the embedder object from
+    // internal field 0.
+    auto builder = v8::experimental::FastAccessorBuilder::New(isolate);
+    auto target = builder->LoadInternalField(builder->GetReceiver(), 0);
+    builder->ReturnValue(
+        builder->ToSmi(builder->CallIntGetter(&RawIntGetter, target)));
+    foo->SetAccessorProperty(v8_str("raw_int"),
+                             v8::FunctionTemplate::NewWithFastHandler(
+                                 isolate, NativePropertyAccessor, builder));
+  }
+
+  // Create an instance.
+  v8::Local<v8::Object> obj = foo->NewInstance(env.local()).ToLocalChecked();
+
+  RawGetterTarget target;
+  obj->SetAlignedPointerInInternalField(0, &target);
+  CHECK(env->Global()->Set(env.local(), v8_str("obj"), obj).FromJust());
+
+  CompileRun(FN_WARMUP("raw_int", "return obj.raw_int"));
+
+  target.value = 12345;
+  ExpectInt32("raw_int()", 12345);
+
+  target.value = -1;
+  ExpectInt32("raw_int()", -1);
+}
+
 TEST(FastAccessorGoto) {
   // Crankshaft support for fast accessors is not implemented; crankshafted
   // code uses the slow accessor which breaks this test's expectations.
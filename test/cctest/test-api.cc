@@ -902,6 +902,25 @@ THREADED_TEST(StringConcat) {
 }
 
 
+THREADED_TEST(StringBuilder) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::StringBuilder builder(env->GetIsolate(), 64);
+  builder.Append(v8_str("2 + "));
+  builder.Append(v8_str("3 * "));
+  for (int i = 0; i < 1000; i++) {
+    builder.Append(v8_str("1 * "));
+  }
+  builder.Append(v8_str("7"));
+  Local<String> source = builder.Finish().ToLocalChecked();
+  CHECK_EQ(4 + 4 + 1000 * 4 + 1, source->Length());
+  Local<Script> script = v8_compile(source);
+  Local<Value> value = script->Run(env.local()).ToLocalChecked();
+  CHECK(value->IsNumber());
+  CHECK_EQ(23, value->Int32Value(env.local()).FromJust());
+}
+
+
 THREADED_TEST(GlobalProperties) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -5533,6 +5552,53 @@ THREADED_TEST(FunctionCall) {
 }
 
 
+THREADED_TEST(FunctionCallBatch) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "function Add(a, b) { return a + b; }"
+      "function Throw() { throw 'unhappy'; }");
+  Local<Function> Add = Local<Function>::Cast(
+      context->Global()->Get(context.local(), v8_str("Add")).ToLocalChecked());
+  Local<Function> Throw = Local<Function>::Cast(
+      context->Global()
+          ->Get(context.local(), v8_str("Throw"))
+          .ToLocalChecked());
+
+  v8::Local<Value> args0[] = {v8_num(1), v8_num(2)};
+  v8::Local<Value> args1[] = {v8_num(3), v8_num(4)};
+  v8::Function::Invocation invocations[] = {
+      {Add, v8::Undefined(isolate), 2, args0},
+      {Add, v8::Undefined(isolate), 2, args1}};
+  v8::MaybeLocal<Value> results[2];
+  CHECK_EQ(2u, v8::Function::CallBatch(context.local(), invocations, 2,
+                                       results));
+  CHECK_EQ(3.0, results[0]
+                    .ToLocalChecked()
+                    ->NumberValue(context.local())
+                    .FromJust());
+  CHECK_EQ(7.0, results[1]
+                    .ToLocalChecked()
+                    ->NumberValue(context.local())
+                    .FromJust());
+
+  // A throwing call stops the batch and reports its index.
+  v8::TryCatch try_catch(isolate);
+  v8::Function::Invocation failing[] = {
+      {Add, v8::Undefined(isolate), 2, args0},
+      {Throw, v8::Undefined(isolate), 0, NULL},
+      {Add, v8::Undefined(isolate), 2, args1}};
+  v8::MaybeLocal<Value> failing_results[3];
+  CHECK_EQ(1u, v8::Function::CallBatch(context.local(), failing, 3,
+                                       failing_results));
+  CHECK(try_catch.HasCaught());
+  CHECK(!failing_results[0].IsEmpty());
+  CHECK(failing_results[1].IsEmpty());
+  CHECK(failing_results[2].IsEmpty());
+}
+
+
 THREADED_TEST(ConstructCall) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -19204,6 +19270,34 @@ TEST(GCCallbacks) {
 }
 
 
+static int gc_cycle_statistics_count = 0;
+
+static void CycleStatisticsCallback(
+    v8::Isolate* isolate, const v8::GCCycleStatistics& statistics) {
+  ++gc_cycle_statistics_count;
+  CHECK_EQ(v8::GCCycleStatistics::kCurrentVersion, statistics.version());
+  CHECK_NOT_NULL(statistics.gc_reason());
+  CHECK_GE(statistics.end_time(), statistics.start_time());
+  CHECK_GT(statistics.end_object_size(), 0u);
+  CHECK_GT(statistics.end_memory_size(), 0u);
+}
+
+
+TEST(GCCycleStatisticsCallback) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  isolate->SetGCCycleStatisticsCallback(CycleStatisticsCallback);
+  CHECK_EQ(0, gc_cycle_statistics_count);
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(1, gc_cycle_statistics_count);
+  CcTest::heap()->CollectGarbage(i::NEW_SPACE);
+  CHECK_EQ(2, gc_cycle_statistics_count);
+  isolate->SetGCCycleStatisticsCallback(nullptr);
+  CcTest::heap()->CollectAllGarbage();
+  CHECK_EQ(2, gc_cycle_statistics_count);
+}
+
+
 THREADED_TEST(TwoByteStringInOneByteCons) {
   // See Chromium issue 47824.
   LocalContext context;
@@ -25168,6 +25262,29 @@ TEST(EstimatedContextSize) {
 }
 
 
+TEST(ContextAllocationAccounting) {
+  i::FLAG_track_context_allocation = true;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  size_t before = env->GetAllocatedBytes();
+  CompileRun("var a = []; for (var i = 0; i < 1000; i++) a.push({});");
+  CHECK_LT(before, env->GetAllocatedBytes());
+
+  // A limit just above the current counter must terminate further
+  // allocation in a catchable way.
+  env->SetAllocationLimit(env->GetAllocatedBytes() + 1);
+  v8::TryCatch try_catch(isolate);
+  CompileRun("var b = []; for (;;) b.push({});");
+  CHECK(try_catch.HasTerminated());
+
+  env->SetAllocationLimit(0);
+  isolate->CancelTerminateExecution();
+  i::FLAG_track_context_allocation = false;
+}
+
+
 static int nb_uncaught_exception_callback_calls = 0;
 
 
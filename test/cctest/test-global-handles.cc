@@ -386,6 +386,46 @@ TEST(EternalHandles) {
 }
 
 
+TEST(PersistentHandleGroup) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
+
+  // Cross a block boundary.
+  const int kArrayLength = 2048 - 1;
+
+  v8::PersistentHandleGroup group(v8_isolate);
+  // Two rounds, to check that Reset() recycles the arena.
+  for (int round = 0; round < 2; round++) {
+    v8::Local<v8::Value> handles[kArrayLength];
+    {
+      HandleScope scope(isolate);
+      for (int i = 0; i < kArrayLength; i++) {
+        v8::Local<v8::Object> object = v8::Object::New(v8_isolate);
+        object->Set(v8_isolate->GetCurrentContext(), 0,
+                    v8::Integer::New(v8_isolate, i))
+            .FromJust();
+        handles[i] = group.Add(object);
+      }
+    }
+
+    // The group's handles must survive both the HandleScope and a full GC.
+    isolate->heap()->CollectAllAvailableGarbage();
+
+    for (int i = 0; i < kArrayLength; i++) {
+      HandleScope scope(isolate);
+      v8::Local<v8::Object> object = v8::Local<v8::Object>::Cast(handles[i]);
+      v8::Local<v8::Value> value =
+          object->Get(v8_isolate->GetCurrentContext(), 0).ToLocalChecked();
+      CHECK_EQ(i,
+               value->Int32Value(v8_isolate->GetCurrentContext()).FromJust());
+    }
+
+    group.Reset();
+  }
+}
+
+
 TEST(PersistentBaseGetLocal) {
   CcTest::InitializeVM();
   v8::Isolate* isolate = CcTest::isolate();
@@ -2007,6 +2007,44 @@ TEST(SnapshotCreatorMultipleContexts) {
   delete[] blob.data;
 }
 
+TEST(SnapshotCreatorKeepFunctionCode) {
+  DisableTurbofan();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      // Compile and run a prelude, so that its code is live when the context
+      // is captured.
+      CompileRun(
+          "function square(x) { return x * x; }"
+          "var nine = square(3);");
+      CHECK_EQ(0, creator.AddContext(context));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context =
+        v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+    v8::Context::Scope context_scope(context);
+    ExpectInt32("nine", 9);
+    ExpectInt32("square(4)", 16);
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+}
+
 static void SerializedCallback(
     const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(v8_num(42));
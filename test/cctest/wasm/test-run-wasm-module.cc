@@ -236,8 +236,10 @@ TEST(Run_WasmModule_Serialization) {
     v8::Local<v8::Context> new_ctx = v8::Context::New(v8_isolate);
     new_ctx->Enter();
 
+    v8::WasmCompiledModule::CallerOwnedBuffer wire_bytes(buffer.begin(),
+                                                         buffer.size());
     v8::MaybeLocal<v8::WasmCompiledModule> deserialized =
-        v8::WasmCompiledModule::Deserialize(v8_isolate, data);
+        v8::WasmCompiledModule::Deserialize(v8_isolate, data, wire_bytes);
     v8::Local<v8::WasmCompiledModule> compiled_module;
     CHECK(deserialized.ToLocal(&compiled_module));
     Handle<JSObject> module_object =
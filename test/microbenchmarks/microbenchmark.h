@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MICROBENCHMARKS_MICROBENCHMARK_H_
+#define V8_MICROBENCHMARKS_MICROBENCHMARK_H_
+
+#include <stdio.h>
+
+#include "src/base/platform/elapsed-timer.h"
+
+namespace v8 {
+namespace internal {
+
+// Runs |body| for |iterations| iterations after one untimed warm-up pass and
+// prints the average cost per iteration. Benchmarks never fail; the gtest
+// machinery is only used for fixtures and test selection, so a single
+// regressed primitive can be re-run with --gtest_filter.
+template <typename Callback>
+void RunMicrobenchmark(const char* name, int iterations, Callback body) {
+  body();
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (int i = 0; i < iterations; i++) {
+    body();
+  }
+  base::TimeDelta elapsed = timer.Elapsed();
+  printf("%-40s %8d iterations %12.1f ns/op %10.3f ms total\n", name,
+         iterations, elapsed.InNanoseconds() / static_cast<double>(iterations),
+         elapsed.InMillisecondsF());
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MICROBENCHMARKS_MICROBENCHMARK_H_
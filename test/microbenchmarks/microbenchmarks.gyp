@@ -0,0 +1,61 @@
+# Copyright 2016 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+# The sources are kept automatically in sync with BUILD.gn.
+
+{
+  'variables': {
+    'v8_code': 1,
+    'microbenchmarks_sources': [
+      '../unittests/test-utils.cc',
+      '../unittests/test-utils.h',
+      'microbenchmark.h',
+      'run-all-microbenchmarks.cc',
+      'runtime-primitives-microbenchmark.cc',
+    ],
+  },
+  'includes': ['../../gypfiles/toolchain.gypi', '../../gypfiles/features.gypi'],
+  'targets': [
+    {
+      'target_name': 'microbenchmarks',
+      'type': 'executable',
+      'variables': {
+        'optimize': 'max',
+      },
+      'dependencies': [
+        '../../testing/gmock.gyp:gmock',
+        '../../testing/gtest.gyp:gtest',
+        '../../src/v8.gyp:v8_libplatform',
+      ],
+      'include_dirs': [
+        '../..',
+      ],
+      'sources': [
+        '<@(microbenchmarks_sources)',
+      ],
+      'conditions': [
+        ['component=="shared_library"', {
+          # Benchmarks reach into internal classes and can't be built against
+          # a shared library, so we need to depend on the underlying static
+          # target in that case.
+          'dependencies': ['../../src/v8.gyp:v8_maybe_snapshot'],
+        }, {
+          'dependencies': ['../../src/v8.gyp:v8'],
+        }],
+        ['os_posix == 1', {
+          # TODO(svenpanne): This is a temporary work-around to fix the warnings
+          # that show up because we use -std=gnu++0x instead of -std=c++11.
+          'cflags!': [
+            '-pedantic',
+          ],
+          'direct_dependent_settings': {
+            'cflags!': [
+              '-pedantic',
+            ],
+          },
+        }],
+      ],
+    },
+  ],
+}
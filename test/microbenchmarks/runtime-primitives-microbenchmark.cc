@@ -0,0 +1,104 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/elements.h"
+#include "src/factory.h"
+#include "src/json-parser.h"
+#include "src/objects-inl.h"
+#include "src/string-search.h"
+#include "src/utils.h"
+#include "src/zone.h"
+#include "test/microbenchmarks/microbenchmark.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+
+typedef TestWithIsolateAndZone RuntimePrimitivesMicrobenchmark;
+
+TEST_F(RuntimePrimitivesMicrobenchmark, StringSearch) {
+  // A 64K one-byte subject with the pattern placed at the very end forces a
+  // full scan per search, so this measures the steady-state inner loop.
+  std::string subject_string(64 * KB - 6, 'a');
+  subject_string += "needle";
+  std::string pattern_string("needle");
+  Vector<const uint8_t> subject(
+      reinterpret_cast<const uint8_t*>(subject_string.data()),
+      static_cast<int>(subject_string.size()));
+  Vector<const uint8_t> pattern(
+      reinterpret_cast<const uint8_t*>(pattern_string.data()),
+      static_cast<int>(pattern_string.size()));
+  StringSearch<uint8_t, uint8_t> search(isolate(), pattern);
+  RunMicrobenchmark("StringSearch/OneByte64K", 2000, [&]() {
+    CHECK_LT(0, search.Search(subject, 0));
+  });
+}
+
+TEST_F(RuntimePrimitivesMicrobenchmark, JsonParser) {
+  // 1000 numeric array elements; re-parsed from the same sequential
+  // one-byte string every iteration.
+  std::string json = "[0";
+  for (int i = 1; i < 1000; i++) {
+    char number[16];
+    SNPrintF(Vector<char>(number, sizeof(number)), ",%d", i);
+    json += number;
+  }
+  json += "]";
+  Handle<String> source =
+      factory()->NewStringFromAsciiChecked(json.c_str());
+  Handle<Object> undefined = factory()->undefined_value();
+  Isolate* i_isolate = isolate();
+  RunMicrobenchmark("JsonParser/NumberArray1K", 500, [&]() {
+    HandleScope scope(i_isolate);
+    CHECK(!JsonParser<true>::Parse(i_isolate, source, undefined).is_null());
+  });
+}
+
+TEST_F(RuntimePrimitivesMicrobenchmark, ElementsAccessorCopy) {
+  const int kLength = 1000;
+  Handle<FixedArray> source_elements = factory()->NewFixedArray(kLength);
+  for (int i = 0; i < kLength; i++) {
+    source_elements->set(i, Smi::FromInt(i));
+  }
+  Handle<JSArray> source =
+      factory()->NewJSArrayWithElements(source_elements, FAST_SMI_ELEMENTS);
+  Handle<FixedArrayBase> destination(factory()->NewFixedArray(kLength));
+  ElementsAccessor* accessor = source->GetElementsAccessor();
+  RunMicrobenchmark("ElementsAccessor/CopySmi1K", 20000, [&]() {
+    accessor->CopyElements(*source, 0, FAST_SMI_ELEMENTS, destination, 0,
+                           kLength);
+  });
+}
+
+TEST_F(RuntimePrimitivesMicrobenchmark, OrderedHashSetGrowth) {
+  // Grows a table from the minimal capacity to 1000 entries, covering the
+  // rehash-on-grow path several times per iteration.
+  Isolate* i_isolate = isolate();
+  RunMicrobenchmark("OrderedHashSet/Grow1K", 200, [&]() {
+    HandleScope scope(i_isolate);
+    Handle<OrderedHashSet> table = OrderedHashSet::Allocate(i_isolate, 4);
+    for (int i = 0; i < 1000; i++) {
+      Handle<Object> key(Smi::FromInt(i), i_isolate);
+      table = OrderedHashSet::Add(table, key);
+    }
+    CHECK_EQ(1000, table->NumberOfElements());
+  });
+}
+
+TEST_F(RuntimePrimitivesMicrobenchmark, ZoneAllocation) {
+  // A fresh zone per iteration so segment acquisition and release are part
+  // of the measured cost, as they are for short-lived compilation zones.
+  base::AccountingAllocator allocator;
+  RunMicrobenchmark("Zone/Allocate1Kx64", 5000, [&]() {
+    Zone zone(&allocator);
+    for (int i = 0; i < 1024; i++) {
+      USE(zone.New(64));
+    }
+  });
+}
+
+}  // namespace internal
+}  // namespace v8
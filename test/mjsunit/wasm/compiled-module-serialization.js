@@ -36,11 +36,12 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
   builder.appendToTable([0, 1]);
 
 
-  var module = new WebAssembly.Module(builder.toBuffer());
+  var wire_bytes = builder.toBuffer();
+  var module = new WebAssembly.Module(wire_bytes);
   var buff = %SerializeWasmModule(module);
   module = null;
   gc();
-  module = %DeserializeWasmModule(buff);
+  module = %DeserializeWasmModule(buff, wire_bytes);
 
   var mem_1 = new ArrayBuffer(4);
   var view_1 = new Int32Array(mem_1);
@@ -59,7 +60,26 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
 (function DeserializeInvalidObject() {
   var invalid_buffer = new ArrayBuffer(10);
 
-  module = %DeserializeWasmModule(invalid_buffer);
+  module = %DeserializeWasmModule(invalid_buffer, invalid_buffer);
+  assertEquals(module, undefined);
+})();
+
+(function DeserializeWrongWireBytes() {
+  let builder = new WasmModuleBuilder();
+  builder.addFunction("main", kSig_i)
+    .addBody([kExprI8Const, 42])
+    .exportFunc();
+
+  var wire_bytes = builder.toBuffer();
+  var module = new WebAssembly.Module(wire_bytes);
+  var serialized = %SerializeWasmModule(module);
+
+  var other_builder = new WasmModuleBuilder();
+  other_builder.addFunction("main", kSig_i)
+    .addBody([kExprI8Const, 23])
+    .exportFunc();
+
+  module = %DeserializeWasmModule(serialized, other_builder.toBuffer());
   assertEquals(module, undefined);
 })();
 
@@ -69,9 +89,10 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
     .addBody([kExprI8Const, 42])
     .exportFunc();
 
-  var compiled_module = new WebAssembly.Module(builder.toBuffer());
+  var wire_bytes = builder.toBuffer();
+  var compiled_module = new WebAssembly.Module(wire_bytes);
   var serialized = %SerializeWasmModule(compiled_module);
-  var clone = %DeserializeWasmModule(serialized);
+  var clone = %DeserializeWasmModule(serialized, wire_bytes);
 
   assertNotNull(clone);
   assertFalse(clone == undefined);
@@ -0,0 +1,69 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/bounded-mpmc-queue.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+typedef int Record;
+const size_t kCapacity = 4;
+
+}  // namespace
+
+namespace v8 {
+namespace base {
+
+TEST(BoundedMpmcQueue, ConstructorEmpty) {
+  BoundedMpmcQueue<Record, kCapacity> queue;
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+
+TEST(BoundedMpmcQueue, SingleRecordEnqueueDequeue) {
+  BoundedMpmcQueue<Record, kCapacity> queue;
+  EXPECT_TRUE(queue.Enqueue(1));
+  EXPECT_FALSE(queue.IsEmpty());
+  Record a = -1;
+  EXPECT_TRUE(queue.Dequeue(&a));
+  EXPECT_EQ(1, a);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+
+TEST(BoundedMpmcQueue, DequeueOnEmpty) {
+  BoundedMpmcQueue<Record, kCapacity> queue;
+  Record a = -1;
+  EXPECT_FALSE(queue.Dequeue(&a));
+  EXPECT_EQ(-1, a);
+}
+
+
+TEST(BoundedMpmcQueue, EnqueueOnFull) {
+  BoundedMpmcQueue<Record, kCapacity> queue;
+  for (size_t i = 0; i < kCapacity; i++) {
+    EXPECT_TRUE(queue.Enqueue(static_cast<Record>(i)));
+  }
+  EXPECT_FALSE(queue.Enqueue(100));
+  Record a = -1;
+  EXPECT_TRUE(queue.Dequeue(&a));
+  EXPECT_EQ(0, a);
+  EXPECT_TRUE(queue.Enqueue(100));
+  EXPECT_FALSE(queue.Enqueue(101));
+}
+
+
+TEST(BoundedMpmcQueue, FifoOrderAcrossWrapAround) {
+  BoundedMpmcQueue<Record, kCapacity> queue;
+  Record a = -1;
+  for (Record i = 0; i < static_cast<Record>(4 * kCapacity); i++) {
+    EXPECT_TRUE(queue.Enqueue(i));
+    EXPECT_TRUE(queue.Dequeue(&a));
+    EXPECT_EQ(i, a);
+  }
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+}  // namespace base
+}  // namespace v8
@@ -87,5 +87,22 @@ TEST(Mutex, MultipleRecursiveMutexes) {
   recursive_mutex1.Unlock();
 }
 
+TEST(Mutex, LockGuardAdaptiveMutex) {
+  AdaptiveMutex adaptive_mutex;
+  { LockGuard<AdaptiveMutex> lock_guard(&adaptive_mutex); }
+  { LockGuard<AdaptiveMutex> lock_guard(&adaptive_mutex); }
+}
+
+
+TEST(Mutex, AdaptiveMutexTryLock) {
+  AdaptiveMutex adaptive_mutex;
+  EXPECT_TRUE(adaptive_mutex.TryLock());
+  EXPECT_FALSE(adaptive_mutex.TryLock());
+  adaptive_mutex.Unlock();
+  EXPECT_TRUE(adaptive_mutex.TryLock());
+  adaptive_mutex.Unlock();
+  EXPECT_EQ(0, adaptive_mutex.contended_acquires());
+}
+
 }  // namespace base
 }  // namespace v8
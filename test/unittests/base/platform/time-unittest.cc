@@ -168,20 +168,32 @@ TEST(TimeTicks, HighResolutionNowResolution) {
 }
 
 
+TEST(TimeTicks, CoarseNowResolution) {
+  // We assume that TimeTicks::CoarseNow() has at least 16ms resolution.
+  static const TimeDelta kTargetGranularity = TimeDelta::FromMilliseconds(16);
+  ResolutionTest<TimeTicks>(&TimeTicks::CoarseNow, kTargetGranularity);
+}
+
+
 TEST(TimeTicks, IsMonotonic) {
   TimeTicks previous_normal_ticks;
   TimeTicks previous_highres_ticks;
+  TimeTicks previous_coarse_ticks;
   ElapsedTimer timer;
   timer.Start();
   while (!timer.HasExpired(TimeDelta::FromMilliseconds(100))) {
     TimeTicks normal_ticks = TimeTicks::Now();
     TimeTicks highres_ticks = TimeTicks::HighResolutionNow();
+    TimeTicks coarse_ticks = TimeTicks::CoarseNow();
     EXPECT_GE(normal_ticks, previous_normal_ticks);
     EXPECT_GE((normal_ticks - previous_normal_ticks).InMicroseconds(), 0);
     EXPECT_GE(highres_ticks, previous_highres_ticks);
     EXPECT_GE((highres_ticks - previous_highres_ticks).InMicroseconds(), 0);
+    EXPECT_GE(coarse_ticks, previous_coarse_ticks);
+    EXPECT_GE((coarse_ticks - previous_coarse_ticks).InMicroseconds(), 0);
     previous_normal_ticks = normal_ticks;
     previous_highres_ticks = highres_ticks;
+    previous_coarse_ticks = coarse_ticks;
   }
 }
 
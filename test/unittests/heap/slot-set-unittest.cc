@@ -43,6 +43,20 @@ TEST(SlotSet, InsertAndLookup2) {
   }
 }
 
+TEST(SlotSet, InlineBucketUpgrade) {
+  SlotSet set;
+  set.SetPageStart(0);
+  // Fill a single bucket well past the inline capacity so that it upgrades
+  // to a bitmap, then check that no slot was lost on the way.
+  for (int i = 0; i < 64; i++) {
+    set.Insert(i * kPointerSize);
+    for (int j = 0; j <= i; j++) {
+      EXPECT_TRUE(set.Lookup(j * kPointerSize));
+    }
+  }
+  EXPECT_FALSE(set.Lookup(64 * kPointerSize));
+}
+
 TEST(SlotSet, Iterate) {
   SlotSet set;
   set.SetPageStart(0);
@@ -10,6 +10,7 @@
     'unittests_sources': [  ### gcmole(all) ###
       'base/atomic-utils-unittest.cc',
       'base/bits-unittest.cc',
+      'base/bounded-mpmc-queue-unittest.cc',
       'base/cpu-unittest.cc',
       'base/division-by-constant-unittest.cc',
       'base/flags-unittest.cc',